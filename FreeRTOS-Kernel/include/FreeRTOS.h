@@ -76,6 +76,18 @@ extern "C" {
 #if ( configUSE_NEWLIB_REENTRANT == 1 )
 	#include <reent.h>
 #endif
+#ifndef configUSE_PICOLIBC_TLS
+	#define configUSE_PICOLIBC_TLS 0
+#endif
+
+/* Set to 1 by ports that give each task its own Picolibc TLS block and thread
+pointer when the task's stack is initialised, so the thread pointer is switched
+with the rest of the task context.  Otherwise the TLS block is held in the TCB
+and set by the kernel on each context switch. */
+#ifndef portTLS_IN_TASK_CONTEXT
+	#define portTLS_IN_TASK_CONTEXT 0
+#endif
+
 #if ( configUSE_PICOLIBC_TLS == 1 )
 	#include <picotls.h>
 #endif
@@ -558,6 +570,30 @@ extern "C" {
 	#define traceTASK_PRIORITY_SET( pxTask, uxNewPriority )
 #endif
 
+#ifndef traceTASK_BUDGET_EXHAUSTED
+	#define traceTASK_BUDGET_EXHAUSTED( pxTask )
+#endif
+
+#ifndef traceTASK_BUDGET_REPLENISHED
+	#define traceTASK_BUDGET_REPLENISHED( pxTask )
+#endif
+
+#ifndef traceTASK_PERIOD_OVERRUN
+	#define traceTASK_PERIOD_OVERRUN( pxTask, xResponseTime )
+#endif
+
+#ifndef traceTASK_RENDEZVOUS_CALL
+	#define traceTASK_RENDEZVOUS_CALL( pxReceiver )
+#endif
+
+#ifndef traceTASK_RENDEZVOUS_RECEIVE
+	#define traceTASK_RENDEZVOUS_RECEIVE( pxCaller )
+#endif
+
+#ifndef traceTASK_RENDEZVOUS_REPLY
+	#define traceTASK_RENDEZVOUS_REPLY( pxCaller )
+#endif
+
 #ifndef traceTASK_SUSPEND
 	#define traceTASK_SUSPEND( pxTaskToSuspend )
 #endif
@@ -780,8 +816,141 @@ extern "C" {
 	#define portPRIVILEGE_BIT ( ( UBaseType_t ) 0x00 )
 #endif
 
+#ifndef configNUM_CORES
+	#define configNUM_CORES 1
+#endif
+
+#if configNUM_CORES < 1
+	#error configNUM_CORES must be set to a minimum of 1 in FreeRTOSConfig.h
+#endif
+
+#ifndef configUSE_CORE_AFFINITY
+	#define configUSE_CORE_AFFINITY 0
+#endif
+
+#if ( ( configUSE_CORE_AFFINITY == 1 ) && ( configNUM_CORES == 1 ) )
+	#error configUSE_CORE_AFFINITY is only meaningful when configNUM_CORES is greater than 1
+#endif
+
+#if ( configNUM_CORES > 1 )
+	#ifndef portGET_CORE_ID
+		#error portGET_CORE_ID() must be defined by the port when configNUM_CORES is greater than 1
+	#endif
+
+	#ifndef portYIELD_CORE
+		#error portYIELD_CORE() must be defined by the port when configNUM_CORES is greater than 1
+	#endif
+
+	#if !defined( portGET_TASK_LOCK ) || !defined( portRELEASE_TASK_LOCK ) || !defined( portGET_ISR_LOCK ) || !defined( portRELEASE_ISR_LOCK )
+		#error The port must provide the task and ISR spinlock macros when configNUM_CORES is greater than 1
+	#endif
+#else
+	#ifndef portGET_CORE_ID
+		#define portGET_CORE_ID() 0
+	#endif
+#endif
+
+#ifndef configUSE_AMP
+	#define configUSE_AMP 0
+#endif
+
+#if ( configUSE_AMP == 1 )
+	#if ( configNUM_CORES > 1 )
+		#error configUSE_AMP runs one kernel instance per hart and cannot be combined with configNUM_CORES > 1
+	#endif
+
+	#if !defined( portGET_HART_ID ) || !defined( portAMP_RING_DOORBELL ) || !defined( portAMP_MEMORY_FENCE )
+		#error The port must provide portGET_HART_ID(), portAMP_RING_DOORBELL() and portAMP_MEMORY_FENCE() when configUSE_AMP is 1
+	#endif
+
+	#ifndef configAMP_MAX_CHANNELS
+		#define configAMP_MAX_CHANNELS 4
+	#endif
+
+	/* Window of memory shared between the kernel instances.  When a size is
+	given the inter-hart channels are checked to lie inside it. */
+	#ifndef configAMP_SHARED_MEMORY_BASE
+		#define configAMP_SHARED_MEMORY_BASE 0
+	#endif
+
+	#ifndef configAMP_SHARED_MEMORY_SIZE
+		#define configAMP_SHARED_MEMORY_SIZE 0
+	#endif
+#endif
+
+#ifndef configUSE_DELAYED_TASK_WHEEL
+	#define configUSE_DELAYED_TASK_WHEEL 0
+#endif
+
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+	/* Number of slots of the delayed task wheel.  A power of 2 no larger than
+	32 so the occupied slots fit in one 32-bit map. */
+	#ifndef configDELAYED_TASK_WHEEL_SIZE
+		#define configDELAYED_TASK_WHEEL_SIZE 32
+	#endif
+
+	#if ( ( configDELAYED_TASK_WHEEL_SIZE < 2 ) || ( configDELAYED_TASK_WHEEL_SIZE > 32 ) || ( ( configDELAYED_TASK_WHEEL_SIZE & ( configDELAYED_TASK_WHEEL_SIZE - 1 ) ) != 0 ) )
+		#error configDELAYED_TASK_WHEEL_SIZE must be a power of 2 between 2 and 32
+	#endif
+#endif
+
+#ifndef configUSE_64_BIT_TICK_COUNT
+	#define configUSE_64_BIT_TICK_COUNT 0
+#endif
+
+/* TickCount_t is the type of the tick count maintained by the kernel, and of
+the wake and expiry times delayed tasks and timers are ordered on - and so of
+list item values.  With configUSE_64_BIT_TICK_COUNT set to 1 it is 64 bits wide
+and never overflows, so no overflow lists are needed.  TickType_t remains the
+type used by the API and is then a truncated view of the tick count. */
+#if ( configUSE_64_BIT_TICK_COUNT == 1 )
+	#if ( configUSE_16_BIT_TICKS == 1 )
+		#error configUSE_64_BIT_TICK_COUNT cannot be used with configUSE_16_BIT_TICKS
+	#endif
+
+	typedef uint64_t TickType64_t;
+	typedef TickType64_t TickCount_t;
+	#define portMAX_TICK_COUNT ( ( TickCount_t ) 0xffffffffffffffffULL )
+#else
+	typedef TickType_t TickCount_t;
+	#define portMAX_TICK_COUNT portMAX_DELAY
+#endif
+
+#ifndef configUSE_EDF_SCHEDULING
+	#define configUSE_EDF_SCHEDULING 0
+#endif
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+	/* Priority of the band EDF tasks run at.  Fixed priority tasks above it
+	preempt them, fixed priority tasks below it only run when no EDF task is
+	ready. */
+	#ifndef configEDF_PRIORITY
+		#define configEDF_PRIORITY 1
+	#endif
+
+	/* Maximum number of EDF tasks, which sets the size of the deadline heap. */
+	#ifndef configEDF_MAX_TASKS
+		#define configEDF_MAX_TASKS 8
+	#endif
+
+	#if ( configEDF_PRIORITY >= configMAX_PRIORITIES )
+		#error configEDF_PRIORITY must be less than configMAX_PRIORITIES
+	#endif
+
+	#if ( configNUM_CORES > 1 )
+		#error configUSE_EDF_SCHEDULING is only supported when configNUM_CORES is 1
+	#endif
+#endif
+
 #ifndef portYIELD_WITHIN_API
-	#define portYIELD_WITHIN_API portYIELD
+	#if ( configNUM_CORES > 1 )
+		/* A yield requested from inside a critical section must be deferred
+		until the section is exited, otherwise the spinlocks would be held
+		across the context switch. */
+		#define portYIELD_WITHIN_API vTaskYieldWithinAPI
+	#else
+		#define portYIELD_WITHIN_API portYIELD
+	#endif
 #endif
 
 #ifndef portSUPPRESS_TICKS_AND_SLEEP
@@ -832,6 +1001,50 @@ extern "C" {
 	#define configUSE_TIME_SLICING 1
 #endif
 
+#ifndef configUSE_TIME_SLICE_QUANTA
+	#define configUSE_TIME_SLICE_QUANTA 0
+#endif
+
+#if ( configUSE_TIME_SLICE_QUANTA == 1 )
+	/* Number of ticks a task runs before an equal priority task is selected,
+	unless changed by vTaskSetTimeSliceQuantum(). */
+	#ifndef configDEFAULT_TIME_SLICE_QUANTUM
+		#define configDEFAULT_TIME_SLICE_QUANTUM 1
+	#endif
+
+	#if ( configDEFAULT_TIME_SLICE_QUANTUM < 1 )
+		#error configDEFAULT_TIME_SLICE_QUANTUM must be at least 1
+	#endif
+#endif
+
+#ifndef configUSE_TASK_BUDGETS
+	#define configUSE_TASK_BUDGETS 0
+#endif
+
+#if ( configUSE_TASK_BUDGETS == 1 )
+	/* Priority a task runs at from the time it has used its budget until the
+	budget is replenished. */
+	#ifndef configTASK_BUDGET_EXHAUSTED_PRIORITY
+		#define configTASK_BUDGET_EXHAUSTED_PRIORITY 0
+	#endif
+
+	#if ( configTASK_BUDGET_EXHAUSTED_PRIORITY >= configMAX_PRIORITIES )
+		#error configTASK_BUDGET_EXHAUSTED_PRIORITY must be less than configMAX_PRIORITIES
+	#endif
+
+	#if ( configGENERATE_RUN_TIME_STATS != 1 )
+		#error configUSE_TASK_BUDGETS requires configGENERATE_RUN_TIME_STATS to be 1 as budgets are measured with the run time counter
+	#endif
+
+	#if ( configUSE_PREEMPTION != 1 )
+		#error configUSE_TASK_BUDGETS requires configUSE_PREEMPTION to be 1
+	#endif
+
+	#if ( configNUM_CORES > 1 )
+		#error configUSE_TASK_BUDGETS is only supported when configNUM_CORES is 1
+	#endif
+#endif
+
 #ifndef configINCLUDE_APPLICATION_DEFINED_PRIVILEGED_FUNCTIONS
 	#define configINCLUDE_APPLICATION_DEFINED_PRIVILEGED_FUNCTIONS 0
 #endif
@@ -872,6 +1085,14 @@ extern "C" {
 	#define configUSE_TASK_NOTIFICATIONS 1
 #endif
 
+#ifndef configTASK_NOTIFICATION_ARRAY_ENTRIES
+	#define configTASK_NOTIFICATION_ARRAY_ENTRIES 1
+#endif
+
+#if ( configTASK_NOTIFICATION_ARRAY_ENTRIES < 1 )
+	#error configTASK_NOTIFICATION_ARRAY_ENTRIES must be at least 1
+#endif
+
 #ifndef configUSE_POSIX_ERRNO
 	#define configUSE_POSIX_ERRNO 0
 #endif
@@ -890,6 +1111,200 @@ extern "C" {
 	#define configSUPPORT_DYNAMIC_ALLOCATION 1
 #endif
 
+#ifndef configUSE_WORK_QUEUES
+	#define configUSE_WORK_QUEUES 0
+#endif
+
+#if ( configUSE_WORK_QUEUES == 1 )
+	#if ( configUSE_TASK_NOTIFICATIONS != 1 )
+		#error configUSE_WORK_QUEUES requires configUSE_TASK_NOTIFICATIONS to be 1 as the worker tasks are woken by a notification
+	#endif
+
+	#if ( configSUPPORT_DYNAMIC_ALLOCATION != 1 )
+		#error configUSE_WORK_QUEUES requires configSUPPORT_DYNAMIC_ALLOCATION to be 1
+	#endif
+#endif
+
+#ifndef configUSE_TASK_POOLS
+	#define configUSE_TASK_POOLS 0
+#endif
+
+#if ( ( configUSE_TASK_POOLS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION != 1 ) )
+	#error configUSE_TASK_POOLS requires configSUPPORT_DYNAMIC_ALLOCATION to be 1 as pools are only used by xTaskCreate()
+#endif
+
+#ifndef configUSE_TASK_NAME_INDEX
+	#define configUSE_TASK_NAME_INDEX 0
+#endif
+
+#if ( configUSE_TASK_NAME_INDEX == 1 )
+	/* Number of hash buckets used to look tasks up by name. */
+	#ifndef configTASK_NAME_INDEX_SIZE
+		#define configTASK_NAME_INDEX_SIZE 16
+	#endif
+
+	#if ( ( configTASK_NAME_INDEX_SIZE < 1 ) || ( ( configTASK_NAME_INDEX_SIZE & ( configTASK_NAME_INDEX_SIZE - 1 ) ) != 0 ) )
+		#error configTASK_NAME_INDEX_SIZE must be a power of two
+	#endif
+
+	#if ( INCLUDE_xTaskGetHandle != 1 )
+		#error configUSE_TASK_NAME_INDEX requires INCLUDE_xTaskGetHandle to be 1 as the index is only used by xTaskGetHandle()
+	#endif
+#endif
+
+#ifndef configUSE_INCREMENTAL_STACK_HIGH_WATER_MARK
+	/* Off by default as the incremental high water mark is approximate - see
+	uxTaskGetStackHighWaterMark() in task.h. */
+	#define configUSE_INCREMENTAL_STACK_HIGH_WATER_MARK 0
+#endif
+
+#ifndef configUSE_TASK_SNAPSHOTS
+	#define configUSE_TASK_SNAPSHOTS 0
+#endif
+
+#if ( ( configUSE_TASK_SNAPSHOTS == 1 ) && ( configUSE_TRACE_FACILITY != 1 ) )
+	#error configUSE_TASK_SNAPSHOTS requires configUSE_TRACE_FACILITY to be 1
+#endif
+
+#ifndef configUSE_WAKEUP_LATENCY_STATS
+	#define configUSE_WAKEUP_LATENCY_STATS 0
+#endif
+
+#if ( configUSE_WAKEUP_LATENCY_STATS == 1 )
+	#ifndef portGET_CYCLE_COUNT
+		#error configUSE_WAKEUP_LATENCY_STATS requires the port to define portGET_CYCLE_COUNT()
+	#endif
+
+	/* Number of buckets in the latency histogram of each task. */
+	#ifndef configLATENCY_HISTOGRAM_BUCKETS
+		#define configLATENCY_HISTOGRAM_BUCKETS 12
+	#endif
+
+	/* The first bucket counts latencies below 2 ^ this many cycles.  Each
+	following bucket covers twice the range of the one before. */
+	#ifndef configLATENCY_HISTOGRAM_FIRST_BUCKET_SHIFT
+		#define configLATENCY_HISTOGRAM_FIRST_BUCKET_SHIFT 6
+	#endif
+
+	#if ( ( configLATENCY_HISTOGRAM_FIRST_BUCKET_SHIFT + configLATENCY_HISTOGRAM_BUCKETS ) > 33 )
+		#error The latency histogram buckets must fit within 32 bit cycle counts
+	#endif
+#endif
+
+#ifndef configUSE_IDLE_WAIT_FOR_INTERRUPT
+	#define configUSE_IDLE_WAIT_FOR_INTERRUPT 0
+#endif
+
+#if ( configUSE_IDLE_WAIT_FOR_INTERRUPT == 1 )
+	#ifndef portWAIT_FOR_INTERRUPT
+		#error configUSE_IDLE_WAIT_FOR_INTERRUPT requires the port to define portWAIT_FOR_INTERRUPT()
+	#endif
+
+	#if ( configUSE_PREEMPTION != 1 )
+		#error configUSE_IDLE_WAIT_FOR_INTERRUPT requires configUSE_PREEMPTION to be 1
+	#endif
+
+	/* Masks interrupts around portWAIT_FOR_INTERRUPT() without stopping a
+	pending interrupt from ending the wait.  Ports whose
+	portDISABLE_INTERRUPTS() also disables interrupts at their source must
+	define these. */
+	#ifndef portDISABLE_INTERRUPTS_FOR_WAIT
+		#define portDISABLE_INTERRUPTS_FOR_WAIT()	portDISABLE_INTERRUPTS()
+	#endif
+
+	#ifndef portENABLE_INTERRUPTS_AFTER_WAIT
+		#define portENABLE_INTERRUPTS_AFTER_WAIT()	portENABLE_INTERRUPTS()
+	#endif
+#endif
+
+#ifndef configUSE_PERIODIC_TASKS
+	#define configUSE_PERIODIC_TASKS 0
+#endif
+
+#ifndef configUSE_PERIOD_OVERRUN_HOOK
+	#define configUSE_PERIOD_OVERRUN_HOOK 0
+#endif
+
+#if ( configUSE_PERIODIC_TASKS == 1 )
+	#if ( INCLUDE_vTaskDelayUntil != 1 )
+		#error configUSE_PERIODIC_TASKS requires INCLUDE_vTaskDelayUntil to be 1
+	#endif
+#endif
+
+#if ( ( configUSE_PERIOD_OVERRUN_HOOK == 1 ) && ( configUSE_PERIODIC_TASKS != 1 ) )
+	#error configUSE_PERIOD_OVERRUN_HOOK requires configUSE_PERIODIC_TASKS to be 1
+#endif
+
+#ifndef configUSE_BASIC_TASKS
+	#define configUSE_BASIC_TASKS 0
+#endif
+
+#if ( configUSE_BASIC_TASKS == 1 )
+	/* Depth, in words, of the stack shared by the basic tasks of each
+	priority. */
+	#ifndef configBASIC_TASK_STACK_DEPTH
+		#define configBASIC_TASK_STACK_DEPTH configMINIMAL_STACK_SIZE
+	#endif
+
+	#if ( configSUPPORT_DYNAMIC_ALLOCATION != 1 )
+		#error configUSE_BASIC_TASKS requires configSUPPORT_DYNAMIC_ALLOCATION to be 1
+	#endif
+
+	#if ( ( configUSE_TASK_NOTIFICATIONS != 1 ) || ( INCLUDE_vTaskSuspend != 1 ) )
+		#error configUSE_BASIC_TASKS requires configUSE_TASK_NOTIFICATIONS and INCLUDE_vTaskSuspend to be 1
+	#endif
+
+	#if ( ( configNUM_CORES != 1 ) || ( portUSING_MPU_WRAPPERS == 1 ) || ( portSTACK_GROWTH > 0 ) )
+		#error configUSE_BASIC_TASKS is only supported on a single core, without MPU wrappers, and with a stack that grows down
+	#endif
+#endif
+
+#ifndef configUSE_TASK_RENDEZVOUS
+	#define configUSE_TASK_RENDEZVOUS 0
+#endif
+
+#if ( configUSE_TASK_RENDEZVOUS == 1 )
+	#if ( configUSE_MUTEXES != 1 )
+		#error configUSE_TASK_RENDEZVOUS requires configUSE_MUTEXES to be 1, as the receiver of a call inherits the priority of the caller
+	#endif
+
+	#if ( configNUM_CORES != 1 )
+		#error configUSE_TASK_RENDEZVOUS is only supported on a single core
+	#endif
+#endif
+
+#ifndef configUSE_COMPACT_TCB
+	#define configUSE_COMPACT_TCB 0
+#endif
+
+/* configUSE_COMPACT_TCB narrows the priorities and nesting counts held in the
+TCB, so they pack together. */
+#if ( configUSE_COMPACT_TCB == 1 )
+	#if ( configMAX_PRIORITIES <= 256 )
+		#define tskTCB_PRIORITY_TYPE	uint8_t
+	#else
+		#define tskTCB_PRIORITY_TYPE	uint16_t
+	#endif
+	#define tskTCB_NESTING_TYPE			uint16_t
+#else
+	#define tskTCB_PRIORITY_TYPE		UBaseType_t
+	#define tskTCB_NESTING_TYPE			UBaseType_t
+#endif
+
+#ifndef configUSE_LOAD_AVERAGES
+	#define configUSE_LOAD_AVERAGES 0
+#endif
+
+#if ( configUSE_LOAD_AVERAGES == 1 )
+	#ifndef portGET_CYCLE_COUNT
+		#error configUSE_LOAD_AVERAGES requires the port to define portGET_CYCLE_COUNT()
+	#endif
+
+	#if ( configNUM_CORES != 1 )
+		#error configUSE_LOAD_AVERAGES can only be used with a single core
+	#endif
+#endif
+
 #ifndef configSTACK_DEPTH_TYPE
 	/* Defaults to uint16_t for backward compatibility, but can be overridden
 	in FreeRTOSConfig.h if uint16_t is too restrictive. */
@@ -918,6 +1333,28 @@ extern "C" {
 	#error configUSE_MUTEXES must be set to 1 to use recursive mutexes
 #endif
 
+#ifndef configUSE_CEILING_MUTEXES
+	#define configUSE_CEILING_MUTEXES 0
+#endif
+
+#ifndef configUSE_PRIORITY_EVENT_LISTS
+	#define configUSE_PRIORITY_EVENT_LISTS 0
+#endif
+
+#if( configUSE_PRIORITY_EVENT_LISTS == 1 )
+	#if( configUSE_CO_ROUTINES != 0 )
+		#error configUSE_PRIORITY_EVENT_LISTS cannot be used with co-routines as co-routines share the event lists of queues.
+	#endif
+
+	#if( configMAX_PRIORITIES > 32 )
+		#error configUSE_PRIORITY_EVENT_LISTS can only be set to 1 when configMAX_PRIORITIES is less than or equal to 32.
+	#endif
+#endif
+
+#if( ( configUSE_CEILING_MUTEXES == 1 ) && ( configUSE_MUTEXES != 1 ) )
+	#error configUSE_MUTEXES must be set to 1 to use priority ceiling mutexes
+#endif
+
 #ifndef configINITIAL_TICK_COUNT
 	#define configINITIAL_TICK_COUNT 0
 #endif
@@ -1054,7 +1491,9 @@ the Secure Side only. */
  * tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE is only true if it is possible for a
  * task to be created using either statically or dynamically allocated RAM.  Note
  * that if portUSING_MPU_WRAPPERS is 1 then a protected task can be created with
- * a statically allocated stack and a dynamically allocated TCB.
+ * a statically allocated stack and a dynamically allocated TCB.  It is also
+ * true if configUSE_TASK_POOLS is 1, as the stack and TCB of a task can then be
+ * taken from a task pool, which must not be freed either.
  *
  * The following table lists various combinations of portUSING_MPU_WRAPPERS,
  * configSUPPORT_DYNAMIC_ALLOCATION and configSUPPORT_STATIC_ALLOCATION and
@@ -1083,7 +1522,8 @@ the Secure Side only. */
  * +-----+---------+--------+-----------------------------+-----------------------------------+------------------+-----------+
  */
 #define tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE	( ( ( portUSING_MPU_WRAPPERS == 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) ) || \
-													  ( ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) )
+													  ( ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) || \
+													  ( configUSE_TASK_POOLS == 1 ) || ( configUSE_BASIC_TASKS == 1 ) )
 
 /*
  * In line with software engineering best practice, FreeRTOS implements a strict
@@ -1100,7 +1540,7 @@ struct xSTATIC_LIST_ITEM
 	#if( configUSE_LIST_DATA_INTEGRITY_CHECK_BYTES == 1 )
 		TickType_t xDummy1;
 	#endif
-	TickType_t xDummy2;
+	TickCount_t xDummy2;
 	void *pvDummy3[ 4 ];
 	#if( configUSE_LIST_DATA_INTEGRITY_CHECK_BYTES == 1 )
 		TickType_t xDummy4;
@@ -1114,7 +1554,7 @@ struct xSTATIC_MINI_LIST_ITEM
 	#if( configUSE_LIST_DATA_INTEGRITY_CHECK_BYTES == 1 )
 		TickType_t xDummy1;
 	#endif
-	TickType_t xDummy2;
+	TickCount_t xDummy2;
 	void *pvDummy3[ 2 ];
 };
 typedef struct xSTATIC_MINI_LIST_ITEM StaticMiniListItem_t;
@@ -1133,6 +1573,15 @@ typedef struct xSTATIC_LIST
 	#endif
 } StaticList_t;
 
+#if( configUSE_PRIORITY_EVENT_LISTS == 1 )
+	/* See the comments above the struct xSTATIC_LIST_ITEM definition. */
+	typedef struct xSTATIC_PRIORITY_LIST
+	{
+		UBaseType_t uxDummy1;
+		StaticList_t xDummy2[ configMAX_PRIORITIES ];
+	} StaticPriorityList_t;
+#endif
+
 /*
  * In line with software engineering best practice, especially when supplying a
  * library that is likely to change in future versions, FreeRTOS implements a
@@ -1153,39 +1602,48 @@ typedef struct xSTATIC_TCB
 		xMPU_SETTINGS	xDummy2;
 	#endif
 	StaticListItem_t	xDummy3[ 2 ];
-	UBaseType_t			uxDummy5;
+	tskTCB_PRIORITY_TYPE	uxDummy5;
+	#if ( configNUM_CORES > 1 )
+		BaseType_t		xDummy23;
+		#if ( configUSE_CORE_AFFINITY == 1 )
+			UBaseType_t	uxDummy24;
+		#endif
+	#endif
 	void				*pxDummy6;
-	uint8_t				ucDummy7[ configMAX_TASK_NAME_LEN ];
+	#if ( configUSE_COMPACT_TCB == 0 )
+		uint8_t			ucDummy7[ configMAX_TASK_NAME_LEN ];
+	#endif
 	#if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
 		void			*pxDummy8;
 	#endif
 	#if ( portCRITICAL_NESTING_IN_TCB == 1 )
-		UBaseType_t		uxDummy9;
+		tskTCB_NESTING_TYPE	uxDummy9;
 	#endif
-	#if ( configUSE_TRACE_FACILITY == 1 )
+	#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_COMPACT_TCB == 0 ) )
 		UBaseType_t		uxDummy10[ 2 ];
 	#endif
 	#if ( configUSE_MUTEXES == 1 )
-		UBaseType_t		uxDummy12[ 2 ];
+		tskTCB_PRIORITY_TYPE	uxDummy12;
+		tskTCB_NESTING_TYPE	uxDummy13;
 	#endif
-	#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+	#if ( ( configUSE_APPLICATION_TASK_TAG == 1 ) && ( configUSE_COMPACT_TCB == 0 ) )
 		void			*pxDummy14;
 	#endif
-	#if( configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0 )
+	#if( ( configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0 ) && ( configUSE_COMPACT_TCB == 0 ) )
 		void			*pvDummy15[ configNUM_THREAD_LOCAL_STORAGE_POINTERS ];
 	#endif
 	#if ( configGENERATE_RUN_TIME_STATS == 1 )
 		uint32_t		ulDummy16;
 	#endif
-	#if ( configUSE_NEWLIB_REENTRANT == 1 )
+	#if ( ( configUSE_NEWLIB_REENTRANT == 1 ) && ( configUSE_COMPACT_TCB == 0 ) )
 		struct	_reent	xDummy17;
 	#endif
-	#if ( configUSE_PICOLIBC_TLS == 1 && configTLS_STATIC_SIZE > 0 )
+	#if ( configUSE_PICOLIBC_TLS == 1 && portTLS_IN_TASK_CONTEXT == 0 && configTLS_STATIC_SIZE > 0 && configUSE_COMPACT_TCB == 0 )
 		uint8_t			uxDummy17[configTLS_STATIC_SIZE];
 	#endif
 	#if ( configUSE_TASK_NOTIFICATIONS == 1 )
-		uint32_t 		ulDummy18;
-		uint8_t 		ucDummy19;
+		uint32_t 		ulDummy18[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
+		uint8_t 		ucDummy19[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
 	#endif
 	#if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
 		uint8_t			uxDummy20;
@@ -1197,6 +1655,69 @@ typedef struct xSTATIC_TCB
 	#if ( configUSE_POSIX_ERRNO == 1 )
 		int				iDummy22;
 	#endif
+	#if ( configUSE_EDF_SCHEDULING == 1 )
+		TickType_t		xDummy25[ 2 ];
+		TickCount_t		xDummy26[ 2 ];
+		UBaseType_t		uxDummy27;
+	#endif
+	#if ( configUSE_TIME_SLICE_QUANTA == 1 )
+		UBaseType_t		uxDummy28[ 2 ];
+	#endif
+	#if ( configUSE_TASK_BUDGETS == 1 )
+		StaticListItem_t	xDummy29;
+		uint32_t		ulDummy30[ 2 ];
+		TickType_t		xDummy31[ 2 ];
+		UBaseType_t		uxDummy32;
+	#endif
+	#if ( configUSE_TASK_POOLS == 1 )
+		void			*pvDummy33;
+	#endif
+	#if ( configUSE_TASK_NAME_INDEX == 1 )
+		void			*pvDummy34;
+	#endif
+	#if ( configUSE_INCREMENTAL_STACK_HIGH_WATER_MARK == 1 )
+		void			*pvDummy35;
+	#endif
+	#if ( configUSE_TASK_SNAPSHOTS == 1 )
+		StaticListItem_t	xDummy36;
+		uint32_t		ulDummy37;
+	#endif
+	#if ( configUSE_WAKEUP_LATENCY_STATS == 1 )
+		uint32_t		ulDummy38[ configLATENCY_HISTOGRAM_BUCKETS + 4 ];
+		uint8_t			ucDummy39;
+	#endif
+	#if ( configUSE_PERIODIC_TASKS == 1 )
+		TickType_t		xDummy40[ 6 ];
+		uint32_t		ulDummy41[ 2 ];
+	#endif
+	#if ( configUSE_BASIC_TASKS == 1 )
+		void			*pvDummy42[ 2 ];
+		UBaseType_t		uxDummy43;
+	#endif
+	#if ( configUSE_TASK_RENDEZVOUS == 1 )
+		StaticList_t	xDummy44[ 2 ];
+		void			*pvDummy45[ 3 ];
+		size_t			xDummy46[ 2 ];
+		uint8_t			ucDummy47;
+	#endif
+	#if ( configUSE_COMPACT_TCB == 1 )
+		uint8_t			ucDummy7[ configMAX_TASK_NAME_LEN ];
+		#if ( configUSE_TRACE_FACILITY == 1 )
+			UBaseType_t	uxDummy10[ 2 ];
+		#endif
+		#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+			void		*pxDummy14;
+		#endif
+		#if( configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0 )
+			void		*pvDummy15[ configNUM_THREAD_LOCAL_STORAGE_POINTERS ];
+		#endif
+		#if ( configUSE_NEWLIB_REENTRANT == 1 )
+			struct	_reent	xDummy17;
+		#endif
+		#if ( configUSE_PICOLIBC_TLS == 1 && portTLS_IN_TASK_CONTEXT == 0 && configTLS_STATIC_SIZE > 0 )
+			uint8_t		uxDummy17[configTLS_STATIC_SIZE];
+		#endif
+	#endif
 } StaticTask_t;
 
 /*
@@ -1221,9 +1742,16 @@ typedef struct xSTATIC_QUEUE
 	{
 		void *pvDummy2;
 		UBaseType_t uxDummy2;
+		#if( configUSE_CEILING_MUTEXES == 1 )
+			UBaseType_t uxDummy10[ 3 ];
+		#endif
 	} u;
 
-	StaticList_t xDummy3[ 2 ];
+	#if( configUSE_PRIORITY_EVENT_LISTS == 1 )
+		StaticPriorityList_t xDummy3[ 2 ];
+	#else
+		StaticList_t xDummy3[ 2 ];
+	#endif
 	UBaseType_t uxDummy4[ 3 ];
 	uint8_t ucDummy5[ 2 ];
 
@@ -1322,6 +1850,10 @@ typedef struct xSTATIC_STREAM_BUFFER
 	#if ( configUSE_TRACE_FACILITY == 1 )
 		UBaseType_t uxDummy4;
 	#endif
+	#if ( configUSE_AMP == 1 )
+		UBaseType_t uxDummy5[ 2 ];
+		uint32_t ulDummy6;
+	#endif
 } StaticStreamBuffer_t;
 
 /* Message buffers are built on stream buffers. */
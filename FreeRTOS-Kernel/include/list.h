@@ -140,7 +140,7 @@ struct xLIST;
 struct xLIST_ITEM
 {
 	listFIRST_LIST_ITEM_INTEGRITY_CHECK_VALUE			/*< Set to a known value if configUSE_LIST_DATA_INTEGRITY_CHECK_BYTES is set to 1. */
-	configLIST_VOLATILE TickType_t xItemValue;			/*< The value being listed.  In most cases this is used to sort the list in descending order. */
+	configLIST_VOLATILE TickCount_t xItemValue;			/*< The value being listed.  In most cases this is used to sort the list in descending order. */
 	struct xLIST_ITEM * configLIST_VOLATILE pxNext;		/*< Pointer to the next ListItem_t in the list. */
 	struct xLIST_ITEM * configLIST_VOLATILE pxPrevious;	/*< Pointer to the previous ListItem_t in the list. */
 	void * pvOwner;										/*< Pointer to the object (normally a TCB) that contains the list item.  There is therefore a two way link between the object containing the list item and the list item itself. */
@@ -152,7 +152,7 @@ typedef struct xLIST_ITEM ListItem_t;					/* For some reason lint wants this as
 struct xMINI_LIST_ITEM
 {
 	listFIRST_LIST_ITEM_INTEGRITY_CHECK_VALUE			/*< Set to a known value if configUSE_LIST_DATA_INTEGRITY_CHECK_BYTES is set to 1. */
-	configLIST_VOLATILE TickType_t xItemValue;
+	configLIST_VOLATILE TickCount_t xItemValue;
 	struct xLIST_ITEM * configLIST_VOLATILE pxNext;
 	struct xLIST_ITEM * configLIST_VOLATILE pxPrevious;
 };
@@ -170,6 +170,23 @@ typedef struct xLIST
 	listSECOND_LIST_INTEGRITY_CHECK_VALUE				/*< Set to a known value if configUSE_LIST_DATA_INTEGRITY_CHECK_BYTES is set to 1. */
 } List_t;
 
+#if( configUSE_PRIORITY_EVENT_LISTS == 1 )
+	/*
+	 * Definition of a list that holds its items in one list per priority, in
+	 * the order in which they were inserted, plus a bitmap of the priorities
+	 * that hold items.  Inserting an item and finding the first item of the
+	 * highest priority both take a constant time, whereas vListInsert() has to
+	 * walk the list.  Items are removed with uxListRemove() as normal.  That
+	 * cannot clear the bit of a priority that becomes empty, so a set bit only
+	 * means the priority might hold items.
+	 */
+	typedef struct xPRIORITY_LIST
+	{
+		UBaseType_t uxPrioritiesInUse;					/*< Bit n is set if xLists[ n ] might not be empty. */
+		List_t xLists[ configMAX_PRIORITIES ];			/*< One list per priority. */
+	} PriorityList_t;
+#endif /* configUSE_PRIORITY_EVENT_LISTS */
+
 /*
  * Access macro to set the owner of a list item.  The owner of a list item
  * is the object (usually a TCB) that contains the list item.
@@ -327,10 +344,10 @@ List_t * const pxConstList = ( pxList );													\
 
 /*
  * This provides a crude means of knowing if a list has been initialised, as
- * pxList->xListEnd.xItemValue is set to portMAX_DELAY by the vListInitialise()
+ * pxList->xListEnd.xItemValue is set to portMAX_TICK_COUNT by the vListInitialise()
  * function.
  */
-#define listLIST_IS_INITIALISED( pxList ) ( ( pxList )->xListEnd.xItemValue == portMAX_DELAY )
+#define listLIST_IS_INITIALISED( pxList ) ( ( pxList )->xListEnd.xItemValue == portMAX_TICK_COUNT )
 
 /*
  * Must be called before a list is used!  This initialises all the members
@@ -404,6 +421,56 @@ void vListInsertEnd( List_t * const pxList, ListItem_t * const pxNewListItem ) P
  */
 UBaseType_t uxListRemove( ListItem_t * const pxItemToRemove ) PRIVILEGED_FUNCTION;
 
+#if( configUSE_PRIORITY_EVENT_LISTS == 1 )
+
+	/*
+	 * Must be called before a priority list is used.  Initialises the list of
+	 * every priority.
+	 *
+	 * @param pxList Pointer to the priority list being initialised.
+	 *
+	 * \page vListInitialisePriorityList vListInitialisePriorityList
+	 * \ingroup LinkedList
+	 */
+	void vListInitialisePriorityList( PriorityList_t * const pxList ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Insert a list item at the end of the list of uxPriority within a priority
+	 * list.  The item value is not used.
+	 *
+	 * @param pxList The priority list into which the item is to be inserted.
+	 *
+	 * @param pxNewListItem The list item to be inserted into the list.
+	 *
+	 * @param uxPriority The priority of the item.  Must be less than
+	 * configMAX_PRIORITIES.
+	 *
+	 * \page vListInsertPriority vListInsertPriority
+	 * \ingroup LinkedList
+	 */
+	void vListInsertPriority( PriorityList_t * const pxList, ListItem_t * const pxNewListItem, UBaseType_t uxPriority ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Return the first item inserted of the highest priority held in a
+	 * priority list without removing it, or NULL if the list is empty.
+	 *
+	 * @param pxList The priority list being queried.
+	 *
+	 * \page pxListGetHighestPriorityItem pxListGetHighestPriorityItem
+	 * \ingroup LinkedList
+	 */
+	ListItem_t * pxListGetHighestPriorityItem( PriorityList_t * const pxList ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Access macro to determine if a priority list contains any items.
+	 *
+	 * \page listPRIORITY_LIST_IS_EMPTY listPRIORITY_LIST_IS_EMPTY
+	 * \ingroup LinkedList
+	 */
+	#define listPRIORITY_LIST_IS_EMPTY( pxList )	( ( pxListGetHighestPriorityItem( pxList ) == NULL ) ? pdTRUE : pdFALSE )
+
+#endif /* configUSE_PRIORITY_EVENT_LISTS */
+
 #ifdef __cplusplus
 }
 #endif
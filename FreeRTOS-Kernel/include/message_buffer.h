@@ -796,6 +796,38 @@ BaseType_t xMessageBufferReceiveCompletedFromISR( MessageBufferHandle_t xStreamB
  */
 #define xMessageBufferReceiveCompletedFromISR( xMessageBuffer, pxHigherPriorityTaskWoken ) xStreamBufferReceiveCompletedFromISR( ( StreamBufferHandle_t ) xMessageBuffer, pxHigherPriorityTaskWoken )
 
+/**
+ * message_buffer.h
+ *
+<pre>
+MessageBufferHandle_t xMessageBufferChannelCreate( uint8_t * const pucChannelMemory, size_t xChannelMemorySize, UBaseType_t uxReceiverHartID );
+</pre>
+ *
+ * Only available when configUSE_AMP is set to 1.  Creates a message buffer
+ * that carries messages from this hart's FreeRTOS instance to the instance
+ * running on hart uxReceiverHartID.  See xStreamBufferChannelCreate().
+ *
+ * \defgroup xMessageBufferChannelCreate xMessageBufferChannelCreate
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferChannelCreate( pucChannelMemory, xChannelMemorySize, uxReceiverHartID ) ( MessageBufferHandle_t ) xStreamBufferChannelCreate( pucChannelMemory, xChannelMemorySize, pdTRUE, uxReceiverHartID )
+
+/**
+ * message_buffer.h
+ *
+<pre>
+MessageBufferHandle_t xMessageBufferChannelAttach( uint8_t * const pucChannelMemory );
+</pre>
+ *
+ * Only available when configUSE_AMP is set to 1.  Obtains, on the receiving
+ * hart, the handle of a channel created by xMessageBufferChannelCreate().  See
+ * xStreamBufferChannelAttach().
+ *
+ * \defgroup xMessageBufferChannelAttach xMessageBufferChannelAttach
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferChannelAttach( pucChannelMemory ) ( MessageBufferHandle_t ) xStreamBufferChannelAttach( pucChannelMemory )
+
 #if defined( __cplusplus )
 } /* extern "C" */
 #endif
@@ -716,6 +716,81 @@ typedef QueueHandle_t SemaphoreHandle_t;
 	#define xSemaphoreCreateMutex() xQueueCreateMutex( queueQUEUE_TYPE_MUTEX )
 #endif
 
+/**
+ * semphr. h
+ * <pre>SemaphoreHandle_t xSemaphoreCreateCeilingMutex( UBaseType_t uxCeilingPriority )</pre>
+ *
+ * Creates a new mutex type semaphore that uses the immediate priority ceiling
+ * protocol rather than priority inheritance, and returns a handle by which the
+ * new mutex can be referenced.  configUSE_CEILING_MUTEXES must be set to 1 in
+ * FreeRTOSConfig.h for this macro to be available.
+ *
+ * Each ceiling mutex has a ceiling priority, which must be at least as high
+ * as the priority of the highest priority task that will ever take it.  A
+ * task that takes the mutex is raised to the ceiling priority immediately,
+ * and returned to its previous priority when it gives the mutex back.  As no
+ * other task that uses the mutex can preempt the holder, a task will not
+ * normally find the mutex already taken, no inheritance is needed, and the
+ * longest time a task can be blocked by the mutex is bounded by the longest
+ * time any task holds it.
+ *
+ * Ceiling mutexes cannot be taken recursively.  If a task holds more than one
+ * ceiling mutex at a time then it must give them back in the reverse order to
+ * that in which they were taken.  A task must not block while holding a
+ * ceiling mutex.
+ *
+ * Mutexes created using this function can be accessed using the
+ * xSemaphoreTake() and xSemaphoreGive() macros.  Ceiling mutexes cannot be
+ * used from within interrupt service routines.
+ *
+ * @param uxCeilingPriority The ceiling priority of the mutex.  Must be above
+ * tskIDLE_PRIORITY and below configMAX_PRIORITIES.
+ *
+ * @return If the mutex was successfully created then a handle to the created
+ * semaphore is returned.  If there was not enough heap to allocate the mutex
+ * data structures then NULL is returned.
+ *
+ * Example usage:
+ <pre>
+ #define mainBUS_TASK_PRIORITY	( tskIDLE_PRIORITY + 3 )
+
+ SemaphoreHandle_t xBusMutex;
+
+ void vSetup( void )
+ {
+    // No task above mainBUS_TASK_PRIORITY ever takes the mutex.
+    xBusMutex = xSemaphoreCreateCeilingMutex( mainBUS_TASK_PRIORITY );
+ }
+ </pre>
+ * \defgroup xSemaphoreCreateCeilingMutex xSemaphoreCreateCeilingMutex
+ * \ingroup Semaphores
+ */
+#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_CEILING_MUTEXES == 1 ) )
+	#define xSemaphoreCreateCeilingMutex( uxCeilingPriority ) xQueueCreateCeilingMutex( ( uxCeilingPriority ) )
+#endif
+
+/**
+ * semphr. h
+ * <pre>SemaphoreHandle_t xSemaphoreCreateCeilingMutexStatic( UBaseType_t uxCeilingPriority, StaticSemaphore_t *pxMutexBuffer )</pre>
+ *
+ * As xSemaphoreCreateCeilingMutex(), but the memory used to hold the mutex is
+ * provided by pxMutexBuffer, so no dynamic memory allocation is performed.
+ *
+ * @param uxCeilingPriority The ceiling priority of the mutex.
+ *
+ * @param pxMutexBuffer Must point to a variable of type StaticSemaphore_t,
+ * which will be used to hold the mutex's data structure.
+ *
+ * @return If the mutex was successfully created then a handle to the created
+ * mutex is returned.  If pxMutexBuffer was NULL then NULL is returned.
+ *
+ * \defgroup xSemaphoreCreateCeilingMutexStatic xSemaphoreCreateCeilingMutexStatic
+ * \ingroup Semaphores
+ */
+#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_CEILING_MUTEXES == 1 ) )
+	#define xSemaphoreCreateCeilingMutexStatic( uxCeilingPriority, pxMutexBuffer ) xQueueCreateCeilingMutexStatic( ( uxCeilingPriority ), ( pxMutexBuffer ) )
+#endif
+
 /**
  * semphr. h
  * <pre>SemaphoreHandle_t xSemaphoreCreateMutexStatic( StaticSemaphore_t *pxMutexBuffer )</pre>
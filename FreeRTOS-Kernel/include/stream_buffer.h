@@ -833,6 +833,77 @@ BaseType_t xStreamBufferReceiveCompletedFromISR( StreamBufferHandle_t xStreamBuf
  */
 BaseType_t xStreamBufferReceiveCompletedFromISR( StreamBufferHandle_t xStreamBuffer, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/**
+ * stream_buffer.h
+ *
+<pre>
+StreamBufferHandle_t xStreamBufferChannelCreate( uint8_t * const pucChannelMemory,
+                                                 size_t xChannelMemorySize,
+                                                 BaseType_t xIsMessageBuffer,
+                                                 UBaseType_t uxReceiverHartID );
+</pre>
+ *
+ * Only available when configUSE_AMP is set to 1, in which case every hart runs
+ * its own FreeRTOS instance.
+ *
+ * Creates a single producer, single consumer channel in memory shared with the
+ * instance running on hart uxReceiverHartID.  Must be called by the sending
+ * instance; the receiving instance then gets its handle from
+ * xStreamBufferChannelAttach().  The channel is then used with the normal
+ * send and receive functions, except that only tasks of the sending instance
+ * may send and only tasks of the receiving instance may receive.  A task
+ * blocked on one end is woken by the CLINT MSIP doorbell of its hart.
+ *
+ * The first sizeof( StaticStreamBuffer_t ) bytes of pucChannelMemory hold the
+ * channel's control structure, the rest holds the data.  The memory must be
+ * mapped at the same address on both harts, and must not hold a channel left
+ * over from a previous run when the receiver attaches.
+ *
+ * @param pucChannelMemory Start of the shared memory, aligned to
+ * portBYTE_ALIGNMENT.  Must lie inside the configAMP_SHARED_MEMORY_BASE /
+ * configAMP_SHARED_MEMORY_SIZE window if one is configured.
+ *
+ * @param xChannelMemorySize The size of pucChannelMemory in bytes.
+ *
+ * @param xIsMessageBuffer pdTRUE to carry discrete messages, pdFALSE to carry
+ * a stream of bytes.
+ *
+ * @param uxReceiverHartID The hart running the receiving instance.
+ *
+ * @return The handle of the channel, or NULL if configAMP_MAX_CHANNELS
+ * channels are already in use by this instance.
+ *
+ * \defgroup xStreamBufferChannelCreate xStreamBufferChannelCreate
+ * \ingroup StreamBufferManagement
+ */
+StreamBufferHandle_t xStreamBufferChannelCreate( uint8_t * const pucChannelMemory,
+												 size_t xChannelMemorySize,
+												 BaseType_t xIsMessageBuffer,
+												 UBaseType_t uxReceiverHartID ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+StreamBufferHandle_t xStreamBufferChannelAttach( uint8_t * const pucChannelMemory );
+</pre>
+ *
+ * Only available when configUSE_AMP is set to 1.
+ *
+ * Called by the receiving instance to obtain the handle of a channel created
+ * by xStreamBufferChannelCreate() on another hart.
+ *
+ * @param pucChannelMemory The memory passed to xStreamBufferChannelCreate().
+ *
+ * @return The handle of the channel, or NULL if the sending hart has not
+ * created the channel yet (in which case try again later) or
+ * configAMP_MAX_CHANNELS channels are already in use by this instance.
+ *
+ * \defgroup xStreamBufferChannelAttach xStreamBufferChannelAttach
+ * \ingroup StreamBufferManagement
+ */
+StreamBufferHandle_t xStreamBufferChannelAttach( uint8_t * const pucChannelMemory ) PRIVILEGED_FUNCTION;
+
 /* Functions below here are not part of the public API. */
 StreamBufferHandle_t xStreamBufferGenericCreate( size_t xBufferSizeBytes,
 												 size_t xTriggerLevelBytes,
@@ -846,6 +917,11 @@ StreamBufferHandle_t xStreamBufferGenericCreateStatic( size_t xBufferSizeBytes,
 
 size_t xStreamBufferNextMessageLengthBytes( StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
 
+#if( configUSE_AMP == 1 )
+	/* Called by the port when the doorbell of this hart is rung. */
+	BaseType_t xStreamBufferChannelDoorbellFromISR( void ) PRIVILEGED_FUNCTION;
+#endif
+
 #if( configUSE_TRACE_FACILITY == 1 )
 	void vStreamBufferSetStreamBufferNumber( StreamBufferHandle_t xStreamBuffer, UBaseType_t uxStreamBufferNumber ) PRIVILEGED_FUNCTION;
 	UBaseType_t uxStreamBufferGetStreamBufferNumber( StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
@@ -149,6 +149,46 @@ typedef struct xTASK_STATUS
 	configSTACK_DEPTH_TYPE usStackHighWaterMark;	/* The minimum amount of stack space that has remained for the task since the task was created.  The closer this value is to zero the closer the task has come to overflowing its stack. */
 } TaskStatus_t;
 
+/* Used with the uxTaskGetSnapshot() function to return the state of each task
+in the system. */
+typedef struct xTASK_SNAPSHOT
+{
+	TaskHandle_t xHandle;			/* The handle of the task to which the rest of the information in the structure relates. */
+	UBaseType_t xTaskNumber;		/* A number unique to the task. */
+	eTaskState eCurrentState;		/* The state in which the task existed when the structure was populated. */
+	UBaseType_t uxCurrentPriority;	/* The priority at which the task was running (may be inherited) when the structure was populated. */
+	UBaseType_t uxBasePriority;		/* The priority to which the task will return if the task's current priority has been inherited.  Only valid if configUSE_MUTEXES is defined as 1 in FreeRTOSConfig.h. */
+	uint32_t ulRunTimeCounter;		/* The total run time allocated to the task so far.  Only valid when configGENERATE_RUN_TIME_STATS is defined as 1 in FreeRTOSConfig.h. */
+	uint32_t ulStateGeneration;		/* The state generation at which the state or priority of the task last changed. */
+} TaskSnapshot_t;
+
+#if( configUSE_WAKEUP_LATENCY_STATS == 1 )
+	/* Used with the vTaskGetLatencyStats() function to return the wakeup to
+	run latencies of a task. */
+	typedef struct xTASK_LATENCY_STATS
+	{
+		uint32_t ulWakeups;			/* The number of times the task has been made ready and then run. */
+		uint32_t ulMaxLatency;		/* The longest time, in cycles, between the task being made ready and it running. */
+		uint32_t ulTotalLatency;	/* The sum of all latencies, in cycles.  Saturates rather than wraps. */
+		uint32_t ulHistogram[ configLATENCY_HISTOGRAM_BUCKETS ];	/* ulHistogram[ 0 ] counts latencies below 2 ^ configLATENCY_HISTOGRAM_FIRST_BUCKET_SHIFT cycles, ulHistogram[ n ] latencies of at least 2 ^ ( configLATENCY_HISTOGRAM_FIRST_BUCKET_SHIFT + n - 1 ) cycles.  The last bucket has no upper limit. */
+	} TaskLatencyStats_t;
+#endif
+
+#if( configUSE_PERIODIC_TASKS == 1 )
+	/* Used with the vTaskGetPeriodStats() function to return the timing of the
+	jobs of a periodic task.  All times are in ticks. */
+	typedef struct xTASK_PERIOD_STATS
+	{
+		TickType_t xPeriod;				/* The period set by vTaskSetPeriod(). */
+		TickType_t xDeadline;			/* The deadline, relative to each release, set by vTaskSetPeriod(). */
+		uint32_t ulJobs;				/* The number of jobs the task has completed by calling xTaskWaitForNextPeriod(). */
+		uint32_t ulOverruns;			/* The number of jobs that completed after their deadline. */
+		TickType_t xLastResponseTime;	/* The time from the release of the last job to its completion. */
+		TickType_t xMaxResponseTime;	/* The longest time from the release of a job to its completion. */
+		TickType_t xMaxReleaseJitter;	/* The longest time from the release of a job to the task starting it. */
+	} TaskPeriodStats_t;
+#endif
+
 /* Possible return values for eTaskConfirmSleepModeStatus(). */
 typedef enum
 {
@@ -164,6 +204,22 @@ typedef enum
  */
 #define tskIDLE_PRIORITY			( ( UBaseType_t ) 0U )
 
+/**
+ * Core affinity mask that allows a task to run on any core.  Only used when
+ * configUSE_CORE_AFFINITY is set to 1.
+ *
+ * \ingroup TaskUtils
+ */
+#define tskNO_AFFINITY				( ( UBaseType_t ) -1 )
+
+/**
+ * Index of the notification value used by the task notification functions
+ * that do not take an index.
+ *
+ * \ingroup TaskNotifications
+ */
+#define tskDEFAULT_INDEX_TO_NOTIFY	( 0 )
+
 /**
  * task. h
  *
@@ -337,6 +393,201 @@ is used in assert() statements. */
 							TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION;
 #endif
 
+/**
+ * task. h
+ *<pre>
+ BaseType_t xTaskPoolCreate( configSTACK_DEPTH_TYPE usStackDepth, UBaseType_t uxNumberOfTasks );</pre>
+ *
+ * configUSE_TASK_POOLS must be defined as 1 for this function to be available.
+ *
+ * Create a pool of uxNumberOfTasks TCB and stack pairs, each stack being
+ * usStackDepth words deep.  The whole pool is allocated from the FreeRTOS heap
+ * as a single block and is never freed.
+ *
+ * Once a pool exists xTaskCreate() takes the TCB and stack of a new task from
+ * the pool with the smallest stack depth that is at least the requested depth
+ * and has a free pair, and only allocates from the heap if there is no such
+ * pool.  The task is given the full stack of the pair.  When the task is
+ * deleted the pair is returned to its pool.  A task that deletes itself
+ * returns its pair immediately, rather than leaving the idle task to free its
+ * memory, unless configNUM_CORES is greater than 1.
+ *
+ * Taking a pair from a pool and returning it are both O(1), and pools do not
+ * fragment the heap, so pools suit applications that create and delete many
+ * short lived tasks.  Create one pool for each stack size in use.
+ *
+ * @param usStackDepth The depth of each stack in the pool, in words.
+ *
+ * @param uxNumberOfTasks The number of TCB and stack pairs in the pool.
+ *
+ * @return pdPASS if the pool was created, otherwise
+ * errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY.
+ *
+ * Example usage:
+   <pre>
+ void vSetupConnectionTasks( void )
+ {
+	 // Up to 16 connection handlers with 512 word stacks can exist at once
+	 // without allocating from the heap.
+	 xTaskPoolCreate( 512, 16 );
+ }
+
+ void vAcceptConnection( void *pvConnection )
+ {
+	 xTaskCreate( vConnectionHandler, "Conn", 512, pvConnection, tskIDLE_PRIORITY + 1, NULL );
+ }
+
+ void vConnectionHandler( void *pvConnection )
+ {
+	 // Serve the connection, then return the TCB and stack to the pool.
+	 vTaskDelete( NULL );
+ }
+   </pre>
+ * \defgroup xTaskPoolCreate xTaskPoolCreate
+ * \ingroup Tasks
+ */
+#if( configUSE_TASK_POOLS == 1 )
+	BaseType_t xTaskPoolCreate( configSTACK_DEPTH_TYPE usStackDepth, UBaseType_t uxNumberOfTasks ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ *<pre>
+ BaseType_t xTaskCreateBasic(	TaskFunction_t pvTaskCode,
+								const char * const pcName,
+								void *pvParameters,
+								UBaseType_t uxPriority,
+								TaskHandle_t *pvCreatedTask
+							  );</pre>
+ *
+ * configUSE_BASIC_TASKS must be defined as 1 for this function to be
+ * available.
+ *
+ * Create a basic task.  A basic task has no stack of its own.  Each time it is
+ * activated its function is called from the start, runs to completion on a
+ * stack shared by all the basic tasks created at the same priority, and
+ * returns.  The task is then dormant until it is next activated.  The shared
+ * stack is configBASIC_TASK_STACK_DEPTH words deep and is allocated when the
+ * first basic task of the priority is created, so a system with many short
+ * event handlers only needs one stack for each priority they use.
+ *
+ * Basic tasks are created dormant.  A basic task is activated by a direct to
+ * task notification at index 0, sent with xTaskNotifyGive(), xTaskNotify() or
+ * their FromISR() versions, or by vTaskResume().  The task can read the
+ * notification value with ulTaskNotifyTake() using a block time of zero.  If it
+ * is notified again while it runs, it runs again once it completes.
+ *
+ * Basic tasks are scheduled from the same ready lists as other tasks, and are
+ * preempted by higher priority tasks as usual.  They must never block, so must
+ * only call API functions with a block time of zero, must not be suspended
+ * while running, and must release any mutex they take before returning.  Once
+ * a basic task has started a run, no other basic task of the same priority
+ * starts until that run completes.  Dormant basic tasks are reported as
+ * blocked.
+ *
+ * @param pvTaskCode The function called each time the task is activated.  It
+ * must return, rather than loop forever.
+ *
+ * @param pcName A descriptive name for the task.
+ *
+ * @param pvParameters Pointer passed to pvTaskCode on each run.
+ *
+ * @param uxPriority The priority of the task.  The task uses the shared stack
+ * of this priority even if its priority is later changed.
+ *
+ * @param pvCreatedTask Used to pass back a handle by which the created task
+ * can be activated.
+ *
+ * @return pdPASS if the task was created, otherwise
+ * errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY.
+ *
+ * Example usage:
+   <pre>
+ static TaskHandle_t xRxHandler;
+
+ void vRxHandler( void *pvParameters )
+ {
+	 // Process everything received, then return.
+	 while( xReceiveNextFrame() == pdPASS )
+	 {
+		 vProcessFrame();
+	 }
+ }
+
+ void vSetupHandlers( void )
+ {
+	 xTaskCreateBasic( vRxHandler, "RX", NULL, tskIDLE_PRIORITY + 2, &xRxHandler );
+ }
+
+ void vRxInterruptHandler( void )
+ {
+ BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	 vTaskNotifyGiveFromISR( xRxHandler, &xHigherPriorityTaskWoken );
+	 portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+ }
+   </pre>
+ * \defgroup xTaskCreateBasic xTaskCreateBasic
+ * \ingroup Tasks
+ */
+#if( configUSE_BASIC_TASKS == 1 )
+	BaseType_t xTaskCreateBasic(	TaskFunction_t pxTaskCode,
+									const char * const pcName,	/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+									void * const pvParameters,
+									UBaseType_t uxPriority,
+									TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ *<pre>
+ BaseType_t xTaskCreateEDF(
+							  TaskFunction_t pvTaskCode,
+							  const char * const pcName,
+							  configSTACK_DEPTH_TYPE usStackDepth,
+							  void *pvParameters,
+							  TickType_t xRelativeDeadline,
+							  TickType_t xPeriod,
+							  TaskHandle_t *pvCreatedTask
+						  );</pre>
+ *
+ * configUSE_EDF_SCHEDULING and configSUPPORT_DYNAMIC_ALLOCATION must both be
+ * set to 1 in FreeRTOSConfig.h for this function to be available.
+ *
+ * Create a periodic task scheduled earliest deadline first.  The task runs at
+ * the configEDF_PRIORITY band, so fixed priority tasks above the band still
+ * preempt it, and among the ready EDF tasks the one whose current job has the
+ * earliest absolute deadline runs.
+ *
+ * The first job of the task is released when the task is created.  Each job
+ * ends with a call to vTaskEDFWaitForNextPeriod(), which blocks the task
+ * until the release of the next job, xPeriod ticks after the release of the
+ * previous one.  The absolute deadline of a job is xRelativeDeadline ticks
+ * after its release.
+ *
+ * @param xRelativeDeadline The deadline of each job relative to its release,
+ * in ticks.  Must not be zero.
+ *
+ * @param xPeriod The time between the releases of two jobs, in ticks.  Must
+ * not be zero.
+ *
+ * The other parameters and the return value are those of xTaskCreate().
+ * errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY is also returned if
+ * configEDF_MAX_TASKS EDF tasks already exist.
+ *
+ * \defgroup xTaskCreateEDF xTaskCreateEDF
+ * \ingroup Tasks
+ */
+#if( ( configUSE_EDF_SCHEDULING == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+	BaseType_t xTaskCreateEDF(	TaskFunction_t pxTaskCode,
+								const char * const pcName,	/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+								const configSTACK_DEPTH_TYPE usStackDepth,
+								void * const pvParameters,
+								const TickType_t xRelativeDeadline,
+								const TickType_t xPeriod,
+								TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  *<pre>
@@ -843,6 +1094,24 @@ void vTaskDelayUntil( TickType_t * const pxPreviousWakeTime, const TickType_t xT
  */
 BaseType_t xTaskAbortDelay( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * <pre>void vTaskEDFWaitForNextPeriod( void );</pre>
+ *
+ * configUSE_EDF_SCHEDULING must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * Called by a task created with xTaskCreateEDF() when its current job is
+ * complete.  The task blocks until the release of its next job, one period
+ * after the release of the current one, and the deadline it is scheduled on
+ * moves to that of the next job.  If the next job is already due, because the
+ * current one overran, the function returns at once.
+ *
+ * \defgroup vTaskEDFWaitForNextPeriod vTaskEDFWaitForNextPeriod
+ * \ingroup TaskCtrl
+ */
+void vTaskEDFWaitForNextPeriod( void ) PRIVILEGED_FUNCTION;
+
 /**
  * task. h
  * <pre>UBaseType_t uxTaskPriorityGet( const TaskHandle_t xTask );</pre>
@@ -1014,6 +1283,169 @@ void vTaskGetInfo( TaskHandle_t xTask, TaskStatus_t *pxTaskStatus, BaseType_t xG
  */
 void vTaskPrioritySet( TaskHandle_t xTask, UBaseType_t uxNewPriority ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * <pre>void vTaskSetTimeSliceQuantum( TaskHandle_t xTask, UBaseType_t uxTicks );</pre>
+ *
+ * configUSE_TIME_SLICE_QUANTA must be defined as 1 for this function to be
+ * available.  See the configuration section for more information.
+ *
+ * Set the number of ticks a task runs before the scheduler selects another
+ * ready task of the same priority.  Tasks start with
+ * configDEFAULT_TIME_SLICE_QUANTUM ticks.  A long quantum suits throughput
+ * bound background tasks, which then switch less often, while tasks that
+ * must respond quickly keep the default one tick slice.
+ *
+ * If the task is part way through a slice that is longer than the new
+ * quantum the slice is shortened to the new quantum.
+ *
+ * The quantum only matters while time slicing is in effect, so
+ * configUSE_PREEMPTION and configUSE_TIME_SLICING must also be 1.
+ *
+ * @param xTask Handle to the task being changed.  Passing a NULL handle
+ * changes the quantum of the calling task.
+ *
+ * @param uxTicks The new quantum in ticks.  Must be at least 1.
+ *
+ * Example usage:
+   <pre>
+ void vAFunction( void )
+ {
+ TaskHandle_t xHandle;
+
+	 // Create a background task at the same priority as other tasks.
+	 xTaskCreate( vTaskCode, "NAME", STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, &xHandle );
+
+	 // Let it run for 20 ticks at a time when sharing the processor.
+	 vTaskSetTimeSliceQuantum( xHandle, 20 );
+ }
+   </pre>
+ * \defgroup vTaskSetTimeSliceQuantum vTaskSetTimeSliceQuantum
+ * \ingroup TaskCtrl
+ */
+void vTaskSetTimeSliceQuantum( TaskHandle_t xTask, UBaseType_t uxTicks ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <pre>UBaseType_t uxTaskGetTimeSliceQuantum( const TaskHandle_t xTask );</pre>
+ *
+ * configUSE_TIME_SLICE_QUANTA must be defined as 1 for this function to be
+ * available.  See the configuration section for more information.
+ *
+ * Obtain the time slice quantum of any task.
+ *
+ * @param xTask Handle of the task to be queried.  Passing a NULL
+ * handle results in the quantum of the calling task being returned.
+ *
+ * @return The number of ticks the task runs before an equal priority task is
+ * selected.
+ *
+ * \defgroup uxTaskGetTimeSliceQuantum uxTaskGetTimeSliceQuantum
+ * \ingroup TaskCtrl
+ */
+UBaseType_t uxTaskGetTimeSliceQuantum( const TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <pre>void vTaskSetBudget( TaskHandle_t xTask, uint32_t ulBudget, TickType_t xPeriod );</pre>
+ *
+ * configUSE_TASK_BUDGETS must be defined as 1 for this function to be
+ * available.  See the configuration section for more information.
+ *
+ * Limit the processor time a task can use.  Once the task has run for
+ * ulBudget run time counter units within a replenishment period it is moved
+ * to configTASK_BUDGET_EXHAUSTED_PRIORITY, where it only runs when no task of
+ * higher priority is able to.  The task gets its own priority back, with a
+ * full budget, xPeriod ticks after the period started.  The next period
+ * then starts straight away.  Otherwise a period starts the first time the
+ * task runs after the previous one ended.
+ *
+ * This gives tasks that could otherwise run away, such as a network stack,
+ * a bounded effect on the tasks below them while still letting them use
+ * processor time that would otherwise go to the idle task.
+ *
+ * Run time is measured with the counter used to generate run time statistics,
+ * so configGENERATE_RUN_TIME_STATS must be 1.  A task holding a mutex keeps
+ * any priority it has inherited until the mutex is given back.
+ *
+ * @param xTask Handle to the task being limited.  Passing a NULL handle
+ * limits the calling task.
+ *
+ * @param ulBudget The run time the task may use in each period, in the units
+ * of the run time counter.  Passing 0 removes the limit.
+ *
+ * @param xPeriod The length of the replenishment period in ticks.
+ *
+ * Example usage:
+   <pre>
+ void vAFunction( void )
+ {
+ TaskHandle_t xHandle;
+
+	 // Create the task that runs the network stack.
+	 xTaskCreate( vNetworkTask, "NET", STACK_SIZE, NULL, tskIDLE_PRIORITY + 3, &xHandle );
+
+	 // Allow it 2000 run time counter units in every 10 ticks.
+	 vTaskSetBudget( xHandle, 2000, 10 );
+ }
+   </pre>
+ * \defgroup vTaskSetBudget vTaskSetBudget
+ * \ingroup TaskCtrl
+ */
+void vTaskSetBudget( TaskHandle_t xTask, uint32_t ulBudget, TickType_t xPeriod ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <pre>void vTaskCoreAffinitySet( const TaskHandle_t xTask, UBaseType_t uxCoreAffinityMask );</pre>
+ *
+ * configNUM_CORES must be greater than 1 and configUSE_CORE_AFFINITY must be
+ * defined as 1 for this function to be available.
+ *
+ * Sets the cores a task is allowed to run on.  If the task is running on a
+ * core that is removed from its mask it is switched out of that core before
+ * the function returns.
+ *
+ * @param xTask Handle to the task for which the affinity is being set.
+ * Passing a NULL handle results in the affinity of the calling task being set.
+ *
+ * @param uxCoreAffinityMask Bit N set allows the task to run on core N.  Use
+ * tskNO_AFFINITY to allow the task to run on any core.
+ *
+ * Example usage:
+   <pre>
+ void vAFunction( void )
+ {
+ TaskHandle_t xHandle;
+
+	 // Create a task, storing the handle.
+	 xTaskCreate( vTaskCode, "NAME", STACK_SIZE, NULL, tskIDLE_PRIORITY, &xHandle );
+
+	 // Only allow the created task to run on cores 1 and 2.
+	 vTaskCoreAffinitySet( xHandle, ( 1 << 1 ) | ( 1 << 2 ) );
+ }
+   </pre>
+ * \defgroup vTaskCoreAffinitySet vTaskCoreAffinitySet
+ * \ingroup TaskCtrl
+ */
+void vTaskCoreAffinitySet( const TaskHandle_t xTask, UBaseType_t uxCoreAffinityMask ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <pre>UBaseType_t uxTaskCoreAffinityGet( const TaskHandle_t xTask );</pre>
+ *
+ * configNUM_CORES must be greater than 1 and configUSE_CORE_AFFINITY must be
+ * defined as 1 for this function to be available.
+ *
+ * @param xTask Handle of the task to be queried.  Passing a NULL handle
+ * results in the affinity of the calling task being returned.
+ *
+ * @return The core affinity mask of xTask.
+ *
+ * \defgroup uxTaskCoreAffinityGet uxTaskCoreAffinityGet
+ * \ingroup TaskCtrl
+ */
+UBaseType_t uxTaskCoreAffinityGet( const TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
 /**
  * task. h
  * <pre>void vTaskSuspend( TaskHandle_t xTaskToSuspend );</pre>
@@ -1368,6 +1800,38 @@ TickType_t xTaskGetTickCount( void ) PRIVILEGED_FUNCTION;
  */
 TickType_t xTaskGetTickCountFromISR( void ) PRIVILEGED_FUNCTION;
 
+#if( configUSE_64_BIT_TICK_COUNT == 1 )
+
+/**
+ * task. h
+ * <PRE>TickType64_t xTaskGetTickCount64( void );</PRE>
+ *
+ * configUSE_64_BIT_TICK_COUNT must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * @return The count of ticks since vTaskStartScheduler was called, on 64 bits
+ * so it does not overflow.  xTaskGetTickCount() returns the same count
+ * truncated to TickType_t.
+ *
+ * \defgroup xTaskGetTickCount64 xTaskGetTickCount64
+ * \ingroup TaskUtils
+ */
+TickType64_t xTaskGetTickCount64( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>TickType64_t xTaskGetTickCount64FromISR( void );</PRE>
+ *
+ * This is a version of xTaskGetTickCount64() that is safe to be called from
+ * an ISR.
+ *
+ * \defgroup xTaskGetTickCount64FromISR xTaskGetTickCount64FromISR
+ * \ingroup TaskUtils
+ */
+TickType64_t xTaskGetTickCount64FromISR( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_64_BIT_TICK_COUNT */
+
 /**
  * task. h
  * <PRE>uint16_t uxTaskGetNumberOfTasks( void );</PRE>
@@ -1400,7 +1864,10 @@ char *pcTaskGetName( TaskHandle_t xTaskToQuery ) PRIVILEGED_FUNCTION; /*lint !e9
  * <PRE>TaskHandle_t xTaskGetHandle( const char *pcNameToQuery );</PRE>
  *
  * NOTE:  This function takes a relatively long time to complete and should be
- * used sparingly.
+ * used sparingly, unless configUSE_TASK_NAME_INDEX is set to 1.  In that case
+ * tasks are kept in a hash table keyed on their name, so only the tasks whose
+ * names share a hash bucket are compared, and the scheduler is not suspended.
+ * Tasks that have been deleted are then never returned.
  *
  * @return The handle of the task that has the human readable name pcNameToQuery.
  * NULL is returned if no matching name is found.  INCLUDE_xTaskGetHandle
@@ -1423,6 +1890,14 @@ TaskHandle_t xTaskGetHandle( const char *pcNameToQuery ) PRIVILEGED_FUNCTION; /*
  * a value of 1 means 4 bytes) since the task started.  The smaller the returned
  * number the closer the task has come to overflowing its stack.
  *
+ * If configUSE_INCREMENTAL_STACK_HIGH_WATER_MARK is set to 1 then only the
+ * stack below the deepest point already known to have been used is examined,
+ * which is much faster, but the result is approximate.  A region of the stack
+ * that was reserved but never written, such as an unused local array, hides
+ * any use below it, so the free space returned can be too large by up to the
+ * size of that region until the task is next switched out with its stack
+ * pointer below the region.
+ *
  * uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are the
  * same except for their return type.  Using configSTACK_DEPTH_TYPE allows the
  * user to determine the return type.  It gets around the problem of the value
@@ -1637,6 +2112,277 @@ TaskHandle_t xTaskGetIdleTaskHandle( void ) PRIVILEGED_FUNCTION;
  */
 UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, uint32_t * const pulTotalRunTime ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * <PRE>UBaseType_t uxTaskGetSnapshot( TaskSnapshot_t * const pxSnapshotArray, const UBaseType_t uxArraySize, const uint32_t ulChangedSince, uint32_t * const pulGeneration, UBaseType_t * const puxResumeAfter );</PRE>
+ *
+ * configUSE_TASK_SNAPSHOTS must be defined as 1 for this function to be
+ * available.  See the configuration section for more information.
+ *
+ * A lower impact alternative to uxTaskGetSystemState() intended for
+ * periodic monitoring.  uxTaskGetSystemState() suspends the scheduler for as
+ * long as it takes to visit every task.  uxTaskGetSnapshot() instead copies
+ * the information of one task at a time, each within its own short critical
+ * section, so the time for which the scheduler is locked does not grow with
+ * the number of tasks.  The stack high water mark is not included as it is
+ * slow to obtain - use uxTaskGetStackHighWaterMark() for the tasks of interest.
+ *
+ * The kernel keeps a state generation count that is incremented each time any
+ * task changes state (Ready, Blocked, Suspended) or has its priority changed.
+ * Each task records the generation of its last change.  Only tasks that have
+ * changed after ulChangedSince are copied, so passing the generation returned
+ * by the previous call copies only the tasks that changed since that call.
+ * Pass 0 to copy every task.  The generation is 32 bits, so any other
+ * ulChangedSince must be less than 2^31 changes old.
+ *
+ * If more tasks should be copied than fit in the array then the snapshot is
+ * taken over several calls.  Set *puxResumeAfter to 0 before the first call.
+ * While tasks remain to be copied the call returns with *puxResumeAfter set to
+ * the xTaskNumber of the last task copied, and the next call, made with the
+ * same ulChangedSince, continues from the task after it.  *puxResumeAfter is
+ * set back to 0 by the call that completes the snapshot.
+ *
+ * As the tasks are copied at different times the snapshot as a whole may not
+ * be consistent.  The generation at which the snapshot started is returned in
+ * *pulGeneration by the first call of the snapshot - later calls leave it
+ * unchanged.  A copied task whose ulStateGeneration is after *pulGeneration
+ * changed while the snapshot was being taken.  Tasks that change while the
+ * snapshot is being taken are copied again by the next snapshot that passes
+ * *pulGeneration as ulChangedSince.  Tasks that are deleted are never copied,
+ * so use uxTaskGetNumberOfTasks() to detect deletions when only copying
+ * changes.
+ *
+ * Only one call can be copying tasks at a time.  If another task is already
+ * part way through a call then 0 is returned, *puxResumeAfter is not changed,
+ * and, on the first call of a snapshot, *pulGeneration is set to
+ * ulChangedSince, so the call can simply be made again.  A call is abandoned
+ * if the task making it is deleted.
+ *
+ * @param pxSnapshotArray An array of TaskSnapshot_t structures into which the
+ * copied tasks are written.
+ *
+ * @param uxArraySize The size of the array, which must be at least 1.
+ * Copying stops once the array is full.
+ *
+ * @param ulChangedSince Only tasks that changed after this generation are
+ * copied.
+ *
+ * @param pulGeneration Set by the first call of a snapshot to the state
+ * generation at the start of the snapshot.
+ *
+ * @param puxResumeAfter 0 to start a snapshot, otherwise the value the
+ * previous call of the snapshot left in it.  Set to 0 when the snapshot is
+ * complete.
+ *
+ * @return The number of TaskSnapshot_t structures that were populated.
+ *
+ * Example usage:
+   <pre>
+	// A telemetry task that reports the tasks that changed every 100ms.
+	void vTelemetryTask( void *pvParameters )
+	{
+	static TaskSnapshot_t xSnapshots[ 32 ];
+	uint32_t ulGeneration = 0, ulNextGeneration;
+	UBaseType_t uxCount, uxResumeAfter = 0;
+
+		for( ;; )
+		{
+			do
+			{
+				uxCount = uxTaskGetSnapshot( xSnapshots, 32, ulGeneration, &ulNextGeneration, &uxResumeAfter );
+				vReportChangedTasks( xSnapshots, uxCount );
+			} while( uxResumeAfter != 0 );
+
+			ulGeneration = ulNextGeneration;
+			vTaskDelay( pdMS_TO_TICKS( 100 ) );
+		}
+	}
+   </pre>
+ * \defgroup uxTaskGetSnapshot uxTaskGetSnapshot
+ * \ingroup TaskUtils
+ */
+UBaseType_t uxTaskGetSnapshot( TaskSnapshot_t * const pxSnapshotArray, const UBaseType_t uxArraySize, const uint32_t ulChangedSince, uint32_t * const pulGeneration, UBaseType_t * const puxResumeAfter ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>void vTaskGetLatencyStats( TaskHandle_t xTask, TaskLatencyStats_t *pxLatencyStats, BaseType_t xReset );</PRE>
+ *
+ * configUSE_WAKEUP_LATENCY_STATS must be defined as 1 for this function to be
+ * available.  See the configuration section for more information.
+ *
+ * With configUSE_WAKEUP_LATENCY_STATS set to 1 the kernel time stamps, using
+ * the cycle counter returned by portGET_CYCLE_COUNT(), each point at which a
+ * task leaves the Blocked or Suspended state, and the point at which the task
+ * next runs.  The time between the two is the wakeup latency of the task - the
+ * time it spends waiting for higher priority tasks, critical sections and
+ * interrupts.  The latencies are collected in a log scale histogram per task.
+ * Tasks that are preempted and later resumed are not counted again, so only
+ * the latency of responding to the event the task was waiting for is
+ * measured.
+ *
+ * A high maximum or long histogram tail on a task that has a deadline to meet
+ * shows that the priority of the task, or that of the tasks above it, should
+ * be reviewed.
+ *
+ * @param xTask The handle of the task being queried.  Passing NULL queries the
+ * calling task.
+ *
+ * @param pxLatencyStats The TaskLatencyStats_t structure into which the
+ * latencies of the task are copied.
+ *
+ * @param xReset If pdTRUE then the latencies of the task are cleared once they
+ * have been copied, so the next call only reports new latencies.
+ *
+ * \defgroup vTaskGetLatencyStats vTaskGetLatencyStats
+ * \ingroup TaskUtils
+ */
+#if( configUSE_WAKEUP_LATENCY_STATS == 1 )
+	void vTaskGetLatencyStats( TaskHandle_t xTask, TaskLatencyStats_t *pxLatencyStats, BaseType_t xReset ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * <PRE>void vTaskSetPeriod( TaskHandle_t xTask, TickType_t xPeriod, TickType_t xDeadline );</PRE>
+ *
+ * configUSE_PERIODIC_TASKS must be defined as 1 for this function to be
+ * available.  See the configuration section for more information.
+ *
+ * Declare a task as periodic.  The first job of the task is released at the
+ * time vTaskSetPeriod() is called, and a further job every xPeriod ticks after
+ * that.  The task waits for the release of its next job by calling
+ * xTaskWaitForNextPeriod() once it has completed the current one.
+ *
+ * The statistics of the task are cleared.
+ *
+ * @param xTask The handle of the task.  Passing NULL sets the period of the
+ * calling task.
+ *
+ * @param xPeriod The time, in ticks, between the releases of two jobs.  Must
+ * not be zero.
+ *
+ * @param xDeadline The time, in ticks, after its release by which a job must
+ * complete.  Must not be greater than xPeriod.  Passing zero sets the deadline
+ * equal to the period.
+ *
+ * Example usage:
+   <pre>
+ void vControlLoop( void * pvParameters )
+ {
+	// Run every 10 ticks, and finish within 4 ticks of each release.
+	vTaskSetPeriod( NULL, 10, 4 );
+
+	for( ;; )
+	{
+		vSampleAndActuate();
+
+		if( xTaskWaitForNextPeriod() == pdFAIL )
+		{
+			// The job just completed missed its deadline.
+		}
+	}
+ }
+   </pre>
+ * \defgroup vTaskSetPeriod vTaskSetPeriod
+ * \ingroup TaskCtrl
+ */
+#if( configUSE_PERIODIC_TASKS == 1 )
+	void vTaskSetPeriod( TaskHandle_t xTask, TickType_t xPeriod, TickType_t xDeadline ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * <PRE>BaseType_t xTaskWaitForNextPeriod( void );</PRE>
+ *
+ * configUSE_PERIODIC_TASKS must be defined as 1 for this function to be
+ * available.  See the configuration section for more information.
+ *
+ * Called by a periodic task when it has completed its current job.  The
+ * response time of the job is recorded, and if it is greater than the deadline
+ * of the task the job is counted as an overrun, traceTASK_PERIOD_OVERRUN() is
+ * called and, if configUSE_PERIOD_OVERRUN_HOOK is 1, so is
+ * vApplicationPeriodOverrunHook( TaskHandle_t xTask, TickType_t xResponseTime ).
+ * The hook is called from the task, so it can use any API function that does
+ * not block.
+ *
+ * The task then blocks, using vTaskDelayUntil(), until the release of its
+ * next job.  If that release has already passed the function returns at once,
+ * so a task that falls behind runs its jobs back to back until it catches up.
+ * The time from the release of the next job to the task running again is
+ * recorded as the release jitter.
+ *
+ * vTaskSetPeriod() must have been called for the task first.
+ *
+ * @return pdPASS if the job just completed met its deadline, otherwise
+ * pdFAIL.
+ *
+ * \defgroup xTaskWaitForNextPeriod xTaskWaitForNextPeriod
+ * \ingroup TaskCtrl
+ */
+#if( configUSE_PERIODIC_TASKS == 1 )
+	BaseType_t xTaskWaitForNextPeriod( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * <PRE>void vTaskGetPeriodStats( TaskHandle_t xTask, TaskPeriodStats_t *pxPeriodStats, BaseType_t xReset );</PRE>
+ *
+ * configUSE_PERIODIC_TASKS must be defined as 1 for this function to be
+ * available.  See the configuration section for more information.
+ *
+ * Obtain the period, deadline, overrun count, response times and release
+ * jitter of a periodic task.  A response time creeping towards the deadline,
+ * or a growing release jitter, shows the task is running out of slack before
+ * it starts to overrun.
+ *
+ * @param xTask The handle of the task being queried.  Passing NULL queries the
+ * calling task.
+ *
+ * @param pxPeriodStats The TaskPeriodStats_t structure into which the
+ * statistics of the task are copied.
+ *
+ * @param xReset If pdTRUE then the counts and maximums of the task are cleared
+ * once they have been copied.
+ *
+ * \defgroup vTaskGetPeriodStats vTaskGetPeriodStats
+ * \ingroup TaskUtils
+ */
+#if( configUSE_PERIODIC_TASKS == 1 )
+	void vTaskGetPeriodStats( TaskHandle_t xTask, TaskPeriodStats_t *pxPeriodStats, BaseType_t xReset ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * <PRE>void vTaskGetLoadAverages( uint16_t * const pusLoad1s, uint16_t * const pusLoad10s, uint16_t * const pusLoad60s );</PRE>
+ *
+ * configUSE_LOAD_AVERAGES must be defined as 1 for this function to be
+ * available.  See the configuration section for more information.
+ *
+ * With configUSE_LOAD_AVERAGES set to 1 the kernel measures the time spent in
+ * the idle task, using the cycle counter returned by portGET_CYCLE_COUNT(), as
+ * the idle task is switched in and out.  Once a second the tick interrupt turns
+ * the idle time of the second into a load sample, and the last 60 samples are
+ * kept to give the load over the last 1, 10 and 60 seconds.  No task has to
+ * run to take the measurement.
+ *
+ * Loads are in hundredths of a percent, so 10000 means the idle task did not
+ * run at all.  Until 10 or 60 samples have been taken the longer averages are
+ * over the samples taken so far.  The cycle counter must not wrap within a
+ * second.  When configUSE_TICKLESS_IDLE is used a sample is taken on the first
+ * tick after each second, so a long sleep counts as a single idle sample.
+ *
+ * @param pusLoad1s Set to the load over the last second.
+ *
+ * @param pusLoad10s Set to the average load over the last 10 seconds.
+ *
+ * @param pusLoad60s Set to the average load over the last 60 seconds.
+ *
+ * \defgroup vTaskGetLoadAverages vTaskGetLoadAverages
+ * \ingroup TaskUtils
+ */
+#if( configUSE_LOAD_AVERAGES == 1 )
+	void vTaskGetLoadAverages( uint16_t * const pusLoad1s, uint16_t * const pusLoad10s, uint16_t * const pusLoad60s ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  * <PRE>void vTaskList( char *pcWriteBuffer );</PRE>
@@ -1770,13 +2516,18 @@ uint32_t ulTaskGetIdleRunTimeCounter( void ) PRIVILEGED_FUNCTION;
 
 /**
  * task. h
- * <PRE>BaseType_t xTaskNotify( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction );</PRE>
+ * <PRE>BaseType_t xTaskNotify( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction );
+ * BaseType_t xTaskNotifyIndexed( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, uint32_t ulValue, eNotifyAction eAction );</PRE>
  *
  * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this
  * function to be available.
  *
- * When configUSE_TASK_NOTIFICATIONS is set to one each task has its own private
- * "notification value", which is a 32-bit unsigned integer (uint32_t).
+ * When configUSE_TASK_NOTIFICATIONS is set to one each task has a private array
+ * of configTASK_NOTIFICATION_ARRAY_ENTRIES "notification values", each of which
+ * is a 32-bit unsigned integer (uint32_t).  The "Indexed" variants act on the
+ * notification value at the given index, the others on the value at index 0
+ * (tskDEFAULT_INDEX_TO_NOTIFY).  Notifications at different indexes are
+ * independent of each other.
  *
  * Events can be sent to a task using an intermediary object.  Examples of such
  * objects are queues, semaphores, mutexes and event groups.  Task notifications
@@ -1806,6 +2557,11 @@ uint32_t ulTaskGetIdleRunTimeCounter( void ) PRIVILEGED_FUNCTION;
  * task, and the handle of the currently running task can be obtained by calling
  * xTaskGetCurrentTaskHandle().
  *
+ * @param uxIndexToNotify The index within the target task's array of
+ * notification values to which the notification is sent.  Must be less than
+ * configTASK_NOTIFICATION_ARRAY_ENTRIES.  Only the "Indexed" variants take
+ * this parameter.
+ *
  * @param ulValue Data that can be sent with the notification.  How the data is
  * used depends on the value of the eAction parameter.
  *
@@ -1847,19 +2603,26 @@ uint32_t ulTaskGetIdleRunTimeCounter( void ) PRIVILEGED_FUNCTION;
  * \defgroup xTaskNotify xTaskNotify
  * \ingroup TaskNotifications
  */
-BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue ) PRIVILEGED_FUNCTION;
-#define xTaskNotify( xTaskToNotify, ulValue, eAction ) xTaskGenericNotify( ( xTaskToNotify ), ( ulValue ), ( eAction ), NULL )
-#define xTaskNotifyAndQuery( xTaskToNotify, ulValue, eAction, pulPreviousNotifyValue ) xTaskGenericNotify( ( xTaskToNotify ), ( ulValue ), ( eAction ), ( pulPreviousNotifyValue ) )
+BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue ) PRIVILEGED_FUNCTION;
+#define xTaskNotify( xTaskToNotify, ulValue, eAction ) xTaskGenericNotify( ( xTaskToNotify ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( ulValue ), ( eAction ), NULL )
+#define xTaskNotifyIndexed( xTaskToNotify, uxIndexToNotify, ulValue, eAction ) xTaskGenericNotify( ( xTaskToNotify ), ( uxIndexToNotify ), ( ulValue ), ( eAction ), NULL )
+#define xTaskNotifyAndQuery( xTaskToNotify, ulValue, eAction, pulPreviousNotifyValue ) xTaskGenericNotify( ( xTaskToNotify ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( ulValue ), ( eAction ), ( pulPreviousNotifyValue ) )
+#define xTaskNotifyAndQueryIndexed( xTaskToNotify, uxIndexToNotify, ulValue, eAction, pulPreviousNotifyValue ) xTaskGenericNotify( ( xTaskToNotify ), ( uxIndexToNotify ), ( ulValue ), ( eAction ), ( pulPreviousNotifyValue ) )
 
 /**
  * task. h
- * <PRE>BaseType_t xTaskNotifyFromISR( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, BaseType_t *pxHigherPriorityTaskWoken );</PRE>
+ * <PRE>BaseType_t xTaskNotifyFromISR( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, BaseType_t *pxHigherPriorityTaskWoken );
+ * BaseType_t xTaskNotifyIndexedFromISR( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, uint32_t ulValue, eNotifyAction eAction, BaseType_t *pxHigherPriorityTaskWoken );</PRE>
  *
  * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this
  * function to be available.
  *
- * When configUSE_TASK_NOTIFICATIONS is set to one each task has its own private
- * "notification value", which is a 32-bit unsigned integer (uint32_t).
+ * When configUSE_TASK_NOTIFICATIONS is set to one each task has a private array
+ * of configTASK_NOTIFICATION_ARRAY_ENTRIES "notification values", each of which
+ * is a 32-bit unsigned integer (uint32_t).  The "Indexed" variants act on the
+ * notification value at the given index, the others on the value at index 0
+ * (tskDEFAULT_INDEX_TO_NOTIFY).  Notifications at different indexes are
+ * independent of each other.
  *
  * A version of xTaskNotify() that can be used from an interrupt service routine
  * (ISR).
@@ -1892,6 +2655,11 @@ BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNo
  * task, and the handle of the currently running task can be obtained by calling
  * xTaskGetCurrentTaskHandle().
  *
+ * @param uxIndexToNotify The index within the target task's array of
+ * notification values to which the notification is sent.  Must be less than
+ * configTASK_NOTIFICATION_ARRAY_ENTRIES.  Only the "Indexed" variants take
+ * this parameter.
+ *
  * @param ulValue Data that can be sent with the notification.  How the data is
  * used depends on the value of the eAction parameter.
  *
@@ -1938,19 +2706,26 @@ BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNo
  * \defgroup xTaskNotify xTaskNotify
  * \ingroup TaskNotifications
  */
-BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
-#define xTaskNotifyFromISR( xTaskToNotify, ulValue, eAction, pxHigherPriorityTaskWoken ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( ulValue ), ( eAction ), NULL, ( pxHigherPriorityTaskWoken ) )
-#define xTaskNotifyAndQueryFromISR( xTaskToNotify, ulValue, eAction, pulPreviousNotificationValue, pxHigherPriorityTaskWoken ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( ulValue ), ( eAction ), ( pulPreviousNotificationValue ), ( pxHigherPriorityTaskWoken ) )
+BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#define xTaskNotifyFromISR( xTaskToNotify, ulValue, eAction, pxHigherPriorityTaskWoken ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( ulValue ), ( eAction ), NULL, ( pxHigherPriorityTaskWoken ) )
+#define xTaskNotifyIndexedFromISR( xTaskToNotify, uxIndexToNotify, ulValue, eAction, pxHigherPriorityTaskWoken ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( uxIndexToNotify ), ( ulValue ), ( eAction ), NULL, ( pxHigherPriorityTaskWoken ) )
+#define xTaskNotifyAndQueryFromISR( xTaskToNotify, ulValue, eAction, pulPreviousNotificationValue, pxHigherPriorityTaskWoken ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( ulValue ), ( eAction ), ( pulPreviousNotificationValue ), ( pxHigherPriorityTaskWoken ) )
+#define xTaskNotifyAndQueryIndexedFromISR( xTaskToNotify, uxIndexToNotify, ulValue, eAction, pulPreviousNotificationValue, pxHigherPriorityTaskWoken ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( uxIndexToNotify ), ( ulValue ), ( eAction ), ( pulPreviousNotificationValue ), ( pxHigherPriorityTaskWoken ) )
 
 /**
  * task. h
- * <PRE>BaseType_t xTaskNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait );</pre>
+ * <PRE>BaseType_t xTaskNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait );
+ * BaseType_t xTaskNotifyWaitIndexed( UBaseType_t uxIndexToWait, uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait );</pre>
  *
  * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this
  * function to be available.
  *
- * When configUSE_TASK_NOTIFICATIONS is set to one each task has its own private
- * "notification value", which is a 32-bit unsigned integer (uint32_t).
+ * When configUSE_TASK_NOTIFICATIONS is set to one each task has a private array
+ * of configTASK_NOTIFICATION_ARRAY_ENTRIES "notification values", each of which
+ * is a 32-bit unsigned integer (uint32_t).  The "Indexed" variants act on the
+ * notification value at the given index, the others on the value at index 0
+ * (tskDEFAULT_INDEX_TO_NOTIFY).  Notifications at different indexes are
+ * independent of each other.
  *
  * Events can be sent to a task using an intermediary object.  Examples of such
  * objects are queues, semaphores, mutexes and event groups.  Task notifications
@@ -1975,6 +2750,11 @@ BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify, uint32_t ulVal
  *
  * See http://www.FreeRTOS.org/RTOS-task-notifications.html for details.
  *
+ * @param uxIndexToWait The index within the calling task's array of
+ * notification values on which the calling task will wait.  Must be less than
+ * configTASK_NOTIFICATION_ARRAY_ENTRIES.  Only xTaskNotifyWaitIndexed() takes
+ * this parameter.
+ *
  * @param ulBitsToClearOnEntry Bits that are set in ulBitsToClearOnEntry value
  * will be cleared in the calling task's notification value before the task
  * checks to see if any notifications are pending, and optionally blocks if no
@@ -2015,17 +2795,24 @@ BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify, uint32_t ulVal
  * \defgroup xTaskNotifyWait xTaskNotifyWait
  * \ingroup TaskNotifications
  */
-BaseType_t xTaskNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+BaseType_t xTaskGenericNotifyWait( UBaseType_t uxIndexToWait, uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#define xTaskNotifyWait( ulBitsToClearOnEntry, ulBitsToClearOnExit, pulNotificationValue, xTicksToWait ) xTaskGenericNotifyWait( tskDEFAULT_INDEX_TO_NOTIFY, ( ulBitsToClearOnEntry ), ( ulBitsToClearOnExit ), ( pulNotificationValue ), ( xTicksToWait ) )
+#define xTaskNotifyWaitIndexed( uxIndexToWait, ulBitsToClearOnEntry, ulBitsToClearOnExit, pulNotificationValue, xTicksToWait ) xTaskGenericNotifyWait( ( uxIndexToWait ), ( ulBitsToClearOnEntry ), ( ulBitsToClearOnExit ), ( pulNotificationValue ), ( xTicksToWait ) )
 
 /**
  * task. h
- * <PRE>BaseType_t xTaskNotifyGive( TaskHandle_t xTaskToNotify );</PRE>
+ * <PRE>BaseType_t xTaskNotifyGive( TaskHandle_t xTaskToNotify );
+ * BaseType_t xTaskNotifyGiveIndexed( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify );</PRE>
  *
  * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this macro
  * to be available.
  *
- * When configUSE_TASK_NOTIFICATIONS is set to one each task has its own private
- * "notification value", which is a 32-bit unsigned integer (uint32_t).
+ * When configUSE_TASK_NOTIFICATIONS is set to one each task has a private array
+ * of configTASK_NOTIFICATION_ARRAY_ENTRIES "notification values", each of which
+ * is a 32-bit unsigned integer (uint32_t).  The "Indexed" variants act on the
+ * notification value at the given index, the others on the value at index 0
+ * (tskDEFAULT_INDEX_TO_NOTIFY).  Notifications at different indexes are
+ * independent of each other.
  *
  * Events can be sent to a task using an intermediary object.  Examples of such
  * objects are queues, semaphores, mutexes and event groups.  Task notifications
@@ -2055,23 +2842,34 @@ BaseType_t xTaskNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClea
  * task, and the handle of the currently running task can be obtained by calling
  * xTaskGetCurrentTaskHandle().
  *
+ * @param uxIndexToNotify The index within the target task's array of
+ * notification values to which the notification is sent.  Must be less than
+ * configTASK_NOTIFICATION_ARRAY_ENTRIES.  Only the "Indexed" variants take
+ * this parameter.
+ *
  * @return xTaskNotifyGive() is a macro that calls xTaskNotify() with the
  * eAction parameter set to eIncrement - so pdPASS is always returned.
  *
  * \defgroup xTaskNotifyGive xTaskNotifyGive
  * \ingroup TaskNotifications
  */
-#define xTaskNotifyGive( xTaskToNotify ) xTaskGenericNotify( ( xTaskToNotify ), ( 0 ), eIncrement, NULL )
+#define xTaskNotifyGive( xTaskToNotify ) xTaskGenericNotify( ( xTaskToNotify ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( 0 ), eIncrement, NULL )
+#define xTaskNotifyGiveIndexed( xTaskToNotify, uxIndexToNotify ) xTaskGenericNotify( ( xTaskToNotify ), ( uxIndexToNotify ), ( 0 ), eIncrement, NULL )
 
 /**
  * task. h
  * <PRE>void vTaskNotifyGiveFromISR( TaskHandle_t xTaskHandle, BaseType_t *pxHigherPriorityTaskWoken );
+ * void vTaskNotifyGiveIndexedFromISR( TaskHandle_t xTaskHandle, UBaseType_t uxIndexToNotify, BaseType_t *pxHigherPriorityTaskWoken );
  *
  * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this macro
  * to be available.
  *
- * When configUSE_TASK_NOTIFICATIONS is set to one each task has its own private
- * "notification value", which is a 32-bit unsigned integer (uint32_t).
+ * When configUSE_TASK_NOTIFICATIONS is set to one each task has a private array
+ * of configTASK_NOTIFICATION_ARRAY_ENTRIES "notification values", each of which
+ * is a 32-bit unsigned integer (uint32_t).  The "Indexed" variants act on the
+ * notification value at the given index, the others on the value at index 0
+ * (tskDEFAULT_INDEX_TO_NOTIFY).  Notifications at different indexes are
+ * independent of each other.
  *
  * A version of xTaskNotifyGive() that can be called from an interrupt service
  * routine (ISR).
@@ -2104,6 +2902,11 @@ BaseType_t xTaskNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClea
  * task, and the handle of the currently running task can be obtained by calling
  * xTaskGetCurrentTaskHandle().
  *
+ * @param uxIndexToNotify The index within the target task's array of
+ * notification values to which the notification is sent.  Must be less than
+ * configTASK_NOTIFICATION_ARRAY_ENTRIES.  Only the "Indexed" variants take
+ * this parameter.
+ *
  * @param pxHigherPriorityTaskWoken  vTaskNotifyGiveFromISR() will set
  * *pxHigherPriorityTaskWoken to pdTRUE if sending the notification caused the
  * task to which the notification was sent to leave the Blocked state, and the
@@ -2116,17 +2919,24 @@ BaseType_t xTaskNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClea
  * \defgroup xTaskNotifyWait xTaskNotifyWait
  * \ingroup TaskNotifications
  */
-void vTaskNotifyGiveFromISR( TaskHandle_t xTaskToNotify, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+void vTaskGenericNotifyGiveFromISR( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#define vTaskNotifyGiveFromISR( xTaskToNotify, pxHigherPriorityTaskWoken ) vTaskGenericNotifyGiveFromISR( ( xTaskToNotify ), ( tskDEFAULT_INDEX_TO_NOTIFY ), ( pxHigherPriorityTaskWoken ) )
+#define vTaskNotifyGiveIndexedFromISR( xTaskToNotify, uxIndexToNotify, pxHigherPriorityTaskWoken ) vTaskGenericNotifyGiveFromISR( ( xTaskToNotify ), ( uxIndexToNotify ), ( pxHigherPriorityTaskWoken ) )
 
 /**
  * task. h
- * <PRE>uint32_t ulTaskNotifyTake( BaseType_t xClearCountOnExit, TickType_t xTicksToWait );</pre>
+ * <PRE>uint32_t ulTaskNotifyTake( BaseType_t xClearCountOnExit, TickType_t xTicksToWait );
+ * uint32_t ulTaskNotifyTakeIndexed( UBaseType_t uxIndexToWait, BaseType_t xClearCountOnExit, TickType_t xTicksToWait );</pre>
  *
  * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this
  * function to be available.
  *
- * When configUSE_TASK_NOTIFICATIONS is set to one each task has its own private
- * "notification value", which is a 32-bit unsigned integer (uint32_t).
+ * When configUSE_TASK_NOTIFICATIONS is set to one each task has a private array
+ * of configTASK_NOTIFICATION_ARRAY_ENTRIES "notification values", each of which
+ * is a 32-bit unsigned integer (uint32_t).  The "Indexed" variants act on the
+ * notification value at the given index, the others on the value at index 0
+ * (tskDEFAULT_INDEX_TO_NOTIFY).  Notifications at different indexes are
+ * independent of each other.
  *
  * Events can be sent to a task using an intermediary object.  Examples of such
  * objects are queues, semaphores, mutexes and event groups.  Task notifications
@@ -2164,6 +2974,11 @@ void vTaskNotifyGiveFromISR( TaskHandle_t xTaskToNotify, BaseType_t *pxHigherPri
  *
  * See http://www.FreeRTOS.org/RTOS-task-notifications.html for details.
  *
+ * @param uxIndexToWait The index within the calling task's array of
+ * notification values on which the calling task will wait.  Must be less than
+ * configTASK_NOTIFICATION_ARRAY_ENTRIES.  Only ulTaskNotifyTakeIndexed() takes
+ * this parameter.
+ *
  * @param xClearCountOnExit if xClearCountOnExit is pdFALSE then the task's
  * notification value is decremented when the function exits.  In this way the
  * notification value acts like a counting semaphore.  If xClearCountOnExit is
@@ -2185,23 +3000,169 @@ void vTaskNotifyGiveFromISR( TaskHandle_t xTaskToNotify, BaseType_t *pxHigherPri
  * \defgroup ulTaskNotifyTake ulTaskNotifyTake
  * \ingroup TaskNotifications
  */
-uint32_t ulTaskNotifyTake( BaseType_t xClearCountOnExit, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+uint32_t ulTaskGenericNotifyTake( UBaseType_t uxIndexToWait, BaseType_t xClearCountOnExit, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#define ulTaskNotifyTake( xClearCountOnExit, xTicksToWait ) ulTaskGenericNotifyTake( ( tskDEFAULT_INDEX_TO_NOTIFY ), ( xClearCountOnExit ), ( xTicksToWait ) )
+#define ulTaskNotifyTakeIndexed( uxIndexToWait, xClearCountOnExit, xTicksToWait ) ulTaskGenericNotifyTake( ( uxIndexToWait ), ( xClearCountOnExit ), ( xTicksToWait ) )
 
 /**
  * task. h
- * <PRE>BaseType_t xTaskNotifyStateClear( TaskHandle_t xTask );</pre>
+ * <PRE>BaseType_t xTaskNotifyStateClear( TaskHandle_t xTask );
+ * BaseType_t xTaskNotifyStateClearIndexed( TaskHandle_t xTask, UBaseType_t uxIndexToClear );</pre>
  *
  * If the notification state of the task referenced by the handle xTask is
  * eNotified, then set the task's notification state to eNotWaitingNotification.
  * The task's notification value is not altered.  Set xTask to NULL to clear the
  * notification state of the calling task.
  *
+ * xTaskNotifyStateClear() clears the state of the notification at index 0,
+ * xTaskNotifyStateClearIndexed() the state of the notification at
+ * uxIndexToClear, which must be less than configTASK_NOTIFICATION_ARRAY_ENTRIES.
+ *
  * @return pdTRUE if the task's notification state was set to
  * eNotWaitingNotification, otherwise pdFALSE.
  * \defgroup xTaskNotifyStateClear xTaskNotifyStateClear
  * \ingroup TaskNotifications
  */
-BaseType_t xTaskNotifyStateClear( TaskHandle_t xTask );
+BaseType_t xTaskGenericNotifyStateClear( TaskHandle_t xTask, UBaseType_t uxIndexToClear ) PRIVILEGED_FUNCTION;
+#define xTaskNotifyStateClear( xTask ) xTaskGenericNotifyStateClear( ( xTask ), ( tskDEFAULT_INDEX_TO_NOTIFY ) )
+#define xTaskNotifyStateClearIndexed( xTask, uxIndexToClear ) xTaskGenericNotifyStateClear( ( xTask ), ( uxIndexToClear ) )
+
+/**
+ * task. h
+ * <PRE>BaseType_t xTaskRendezvousCall( TaskHandle_t xReceiver, const void *pvRequest, size_t xRequestLength, void *pvReplyBuffer, size_t xReplyBufferSize, size_t *pxReplyLength, TickType_t xTicksToWait );</pre>
+ *
+ * configUSE_TASK_RENDEZVOUS must be defined as 1 for this function to be
+ * available.
+ *
+ * Send a request to the task xReceiver and wait for its reply.
+ *
+ * Unlike a queue, a rendezvous has no storage of its own.  If xReceiver is
+ * blocked in xTaskRendezvousReceive() the request is copied straight into the
+ * receiver's buffer, the receiver is unblocked, and the calling task gives the
+ * processor to it ahead of any other task of the same priority.  Otherwise the
+ * calling task waits, in priority order with any other callers, until the
+ * receiver next calls xTaskRendezvousReceive(), which copies the request
+ * straight out of pvRequest.  Either way the request is copied once.
+ *
+ * From the time it receives the call until it replies, the receiver runs at
+ * the higher of its own priority and that of the calling task.
+ *
+ * The reply is copied straight into pvReplyBuffer by xTaskRendezvousReply().
+ *
+ * @param xReceiver The task the request is sent to.
+ *
+ * @param pvRequest The request.  It is not copied until the receiver receives
+ * the call, so must remain valid until this function returns.
+ *
+ * @param xRequestLength The length of the request in bytes.  Bytes that do not
+ * fit in the receiver's buffer are discarded.
+ *
+ * @param pvReplyBuffer The buffer into which the reply is copied.
+ *
+ * @param xReplyBufferSize The size of pvReplyBuffer in bytes.  Bytes of the
+ * reply that do not fit are discarded.
+ *
+ * @param pxReplyLength Used to pass out the number of bytes copied into
+ * pvReplyBuffer.  Can be NULL.
+ *
+ * @param xTicksToWait The maximum time to wait for the call to be received and
+ * replied to.  Must not be zero.
+ *
+ * @return pdPASS if a reply was received, otherwise pdFAIL.  A receiver that
+ * took the call after this function timed out is not told, and its reply is
+ * discarded.
+ *
+ * \defgroup xTaskRendezvousCall xTaskRendezvousCall
+ * \ingroup TaskRendezvous
+ */
+#if( configUSE_TASK_RENDEZVOUS == 1 )
+	BaseType_t xTaskRendezvousCall( TaskHandle_t xReceiver, const void *pvRequest, size_t xRequestLength, void *pvReplyBuffer, size_t xReplyBufferSize, size_t *pxReplyLength, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * <PRE>BaseType_t xTaskRendezvousReceive( void *pvBuffer, size_t xBufferSize, size_t *pxReceivedLength, TaskHandle_t *pxCaller, TickType_t xTicksToWait );</pre>
+ *
+ * configUSE_TASK_RENDEZVOUS must be defined as 1 for this function to be
+ * available.
+ *
+ * Receive the request of the highest priority task waiting in
+ * xTaskRendezvousCall() for the calling task, waiting for one if there is
+ * none.  Each call received must be answered with xTaskRendezvousReply(), both
+ * to unblock the caller and to end the priority the receiver inherits from it.
+ *
+ * @param pvBuffer The buffer into which the request is copied.
+ *
+ * @param xBufferSize The size of pvBuffer in bytes.
+ *
+ * @param pxReceivedLength Used to pass out the number of bytes copied into
+ * pvBuffer.  Can be NULL.
+ *
+ * @param pxCaller Used to pass out the handle of the calling task, which is
+ * passed to xTaskRendezvousReply().
+ *
+ * @param xTicksToWait The maximum time to wait for a call.
+ *
+ * @return pdPASS if a call was received, otherwise pdFAIL.
+ *
+ * Example usage:
+   <pre>
+ void vServerTask( void *pvParameters )
+ {
+ Request_t xRequest;
+ Response_t xResponse;
+ TaskHandle_t xClient;
+
+	 for( ;; )
+	 {
+		 if( xTaskRendezvousReceive( &xRequest, sizeof( xRequest ), NULL, &xClient, portMAX_DELAY ) == pdPASS )
+		 {
+			 vHandleRequest( &xRequest, &xResponse );
+			 xTaskRendezvousReply( xClient, &xResponse, sizeof( xResponse ) );
+		 }
+	 }
+ }
+
+ BaseType_t xClientRead( Request_t *pxRequest, Response_t *pxResponse )
+ {
+	 return xTaskRendezvousCall( xServerTask, pxRequest, sizeof( *pxRequest ), pxResponse, sizeof( *pxResponse ), NULL, pdMS_TO_TICKS( 10 ) );
+ }
+   </pre>
+ * \defgroup xTaskRendezvousReceive xTaskRendezvousReceive
+ * \ingroup TaskRendezvous
+ */
+#if( configUSE_TASK_RENDEZVOUS == 1 )
+	BaseType_t xTaskRendezvousReceive( void *pvBuffer, size_t xBufferSize, size_t *pxReceivedLength, TaskHandle_t *pxCaller, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * <PRE>BaseType_t xTaskRendezvousReply( TaskHandle_t xCaller, const void *pvReply, size_t xReplyLength );</pre>
+ *
+ * configUSE_TASK_RENDEZVOUS must be defined as 1 for this function to be
+ * available.
+ *
+ * Reply to a call received with xTaskRendezvousReceive().  The reply is copied
+ * into the caller's reply buffer, the caller is unblocked, and the calling task
+ * returns to the priority it had before receiving the call.  If the caller is
+ * of at least the calling task's priority the processor is given straight back
+ * to it.
+ *
+ * @param xCaller The handle passed out by xTaskRendezvousReceive().
+ *
+ * @param pvReply The reply.
+ *
+ * @param xReplyLength The length of the reply in bytes.
+ *
+ * @return pdPASS if the reply was delivered, or pdFAIL if the caller is no
+ * longer waiting for it because its call timed out.
+ *
+ * \defgroup xTaskRendezvousReply xTaskRendezvousReply
+ * \ingroup TaskRendezvous
+ */
+#if( configUSE_TASK_RENDEZVOUS == 1 )
+	BaseType_t xTaskRendezvousReply( TaskHandle_t xCaller, const void *pvReply, size_t xReplyLength ) PRIVILEGED_FUNCTION;
+#endif
 
 /*-----------------------------------------------------------
  * SCHEDULER INTERNALS AVAILABLE FOR PORTING PURPOSES
@@ -2271,6 +3232,21 @@ void vTaskPlaceOnUnorderedEventList( List_t * pxEventList, const TickType_t xIte
  */
 void vTaskPlaceOnEventListRestricted( List_t * const pxEventList, TickType_t xTicksToWait, const BaseType_t xWaitIndefinitely ) PRIVILEGED_FUNCTION;
 
+/*
+ * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE USED BY
+ * THE QUEUE IMPLEMENTATION WHEN configUSE_PRIORITY_EVENT_LISTS IS 1.
+ *
+ * As vTaskPlaceOnEventList(), vTaskPlaceOnEventListRestricted() and
+ * xTaskRemoveFromEventList(), but for event lists that hold the waiting tasks
+ * in one list per priority so a task can be placed on, or the highest priority
+ * task removed from, the event list in a constant time.
+ */
+#if( configUSE_PRIORITY_EVENT_LISTS == 1 )
+	void vTaskPlaceOnPriorityEventList( PriorityList_t * const pxEventList, const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+	void vTaskPlaceOnPriorityEventListRestricted( PriorityList_t * const pxEventList, TickType_t xTicksToWait, const BaseType_t xWaitIndefinitely ) PRIVILEGED_FUNCTION;
+	BaseType_t xTaskRemoveFromPriorityEventList( PriorityList_t * const pxEventList ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
  * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE SCHEDULER.
@@ -2420,12 +3396,42 @@ eSleepModeStatus eTaskConfirmSleepModeStatus( void ) PRIVILEGED_FUNCTION;
  */
 TaskHandle_t pvTaskIncrementMutexHeldCount( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * For internal use only.  Raise the priority of the calling task, which has
+ * just taken a priority ceiling mutex, to the ceiling priority of the mutex.
+ * Returns the priority the task had before it was raised.
+ */
+UBaseType_t uxTaskPriorityRaiseToCeiling( UBaseType_t uxCeilingPriority ) PRIVILEGED_FUNCTION;
+
+/*
+ * For internal use only.  Set the priority of the calling task back to the
+ * priority it had before it took the priority ceiling mutex it is giving.
+ * Returns pdTRUE if the priority was lowered.
+ */
+BaseType_t xTaskPriorityRestoreFromCeiling( TaskHandle_t const pxMutexHolder, UBaseType_t uxCeilingPriority, UBaseType_t uxPriorityBeforeCeiling ) PRIVILEGED_FUNCTION;
+
 /*
  * For internal use only.  Same as vTaskSetTimeOutState(), but without a critial
  * section.
  */
 void vTaskInternalSetTimeOutState( TimeOut_t * const pxTimeOut ) PRIVILEGED_FUNCTION;
 
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  It is used as
+ * portYIELD_WITHIN_API() when configNUM_CORES is greater than 1.  A yield
+ * requested from within a critical section is held pending until the critical
+ * section is exited, as the kernel locks cannot be held across a context
+ * switch.
+ */
+void vTaskYieldWithinAPI( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  Returns the critical
+ * nesting depth of the running task, for ports that keep it in the TCB but
+ * need it to restore their interrupt mask after a context switch.
+ */
+UBaseType_t uxTaskGetCriticalNesting( void ) PRIVILEGED_FUNCTION;
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,197 @@
+/*
+ * FreeRTOS Kernel V10.2.1
+ * Copyright (C) 2019 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef WORK_QUEUE_H
+#define WORK_QUEUE_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include work_queue.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A work queue is a fixed size ring of deferred function calls that is drained
+ * by a dedicated worker task.  It is intended for the bottom half of interrupt
+ * handlers: the interrupt posts a function and its parameters with
+ * xWorkQueueSubmitFromISR() and the function is then executed in the context
+ * of the worker task at the priority the work queue was created with.
+ *
+ * Unlike xTimerPendFunctionCallFromISR() the deferred functions do not share
+ * the timer service task, so their latency does not depend on the number of
+ * timers in use.  Items are posted into the ring with a compare and swap
+ * rather than from within a critical section, and the worker executes every
+ * item that is available each time it runs.  Any number of tasks and
+ * interrupts can submit to the same work queue.  Each work queue has exactly
+ * one worker task - create several work queues to execute deferred work at
+ * different priorities.
+ *
+ * \defgroup WorkQueue
+ */
+
+/**
+ * work_queue.h
+ *
+ * Type by which work queues are referenced.  For example, a call to
+ * xWorkQueueCreate() returns a WorkQueueHandle_t variable that can then be
+ * used as a parameter to xWorkQueueSubmit() and xWorkQueueSubmitFromISR().
+ *
+ * \defgroup WorkQueueHandle_t WorkQueueHandle_t
+ * \ingroup WorkQueue
+ */
+struct WorkQueueDefinition;
+typedef struct WorkQueueDefinition * WorkQueueHandle_t;
+
+/*
+ * Defines the prototype to which functions submitted to a work queue must
+ * conform.  This matches the prototype used by
+ * xTimerPendFunctionCallFromISR().
+ */
+typedef void (*WorkFunction_t)( void *, uint32_t );
+
+/**
+ * work_queue.h
+ *<pre>
+ WorkQueueHandle_t xWorkQueueCreate( const char * const pcName,
+									 UBaseType_t uxLength,
+									 UBaseType_t uxPriority,
+									 configSTACK_DEPTH_TYPE usStackDepth );
+ </pre>
+ *
+ * Create a new work queue and the worker task that executes the functions
+ * submitted to it.  The work queue and its ring of items are allocated as a
+ * single block from the FreeRTOS heap.
+ *
+ * @param pcName The name given to the worker task.
+ *
+ * @param uxLength The maximum number of items that can be waiting to be
+ * executed at any one time.  Must be a power of two.
+ *
+ * @param uxPriority The priority of the worker task, and therefore the
+ * priority at which the submitted functions execute.
+ *
+ * @param usStackDepth The stack size of the worker task, in words.  Submitted
+ * functions execute on this stack.
+ *
+ * @return If the work queue and its worker task were created then a handle to
+ * the work queue is returned.  Otherwise NULL is returned.
+ *
+ * \defgroup xWorkQueueCreate xWorkQueueCreate
+ * \ingroup WorkQueue
+ */
+WorkQueueHandle_t xWorkQueueCreate( const char * const pcName, UBaseType_t uxLength, UBaseType_t uxPriority, configSTACK_DEPTH_TYPE usStackDepth ) PRIVILEGED_FUNCTION;
+
+/**
+ * work_queue.h
+ *<pre>
+ BaseType_t xWorkQueueSubmit( WorkQueueHandle_t xWorkQueue,
+							  WorkFunction_t xFunctionToExecute,
+							  void *pvParameter1,
+							  uint32_t ulParameter2 );
+ </pre>
+ *
+ * Post a function to be executed by the worker task of a work queue.  This
+ * version must not be called from an interrupt - see
+ * xWorkQueueSubmitFromISR().
+ *
+ * The function does not block.  If the work queue is full pdFAIL is returned
+ * immediately and the function will not be executed.
+ *
+ * @param xWorkQueue The work queue to post to.
+ *
+ * @param xFunctionToExecute The function to execute from the worker task.
+ *
+ * @param pvParameter1 The value passed into the executed function as its first
+ * parameter.
+ *
+ * @param ulParameter2 The value passed into the executed function as its
+ * second parameter.
+ *
+ * @return pdPASS if the function was posted, pdFAIL if the work queue was full.
+ *
+ * \defgroup xWorkQueueSubmit xWorkQueueSubmit
+ * \ingroup WorkQueue
+ */
+BaseType_t xWorkQueueSubmit( WorkQueueHandle_t xWorkQueue, WorkFunction_t xFunctionToExecute, void *pvParameter1, uint32_t ulParameter2 ) PRIVILEGED_FUNCTION;
+
+/**
+ * work_queue.h
+ *<pre>
+ BaseType_t xWorkQueueSubmitFromISR( WorkQueueHandle_t xWorkQueue,
+									 WorkFunction_t xFunctionToExecute,
+									 void *pvParameter1,
+									 uint32_t ulParameter2,
+									 BaseType_t *pxHigherPriorityTaskWoken );
+ </pre>
+ *
+ * A version of xWorkQueueSubmit() that can be called from an interrupt
+ * service routine.
+ *
+ * @param pxHigherPriorityTaskWoken *pxHigherPriorityTaskWoken is set to pdTRUE
+ * if posting the function unblocked the worker task and the worker task has a
+ * priority above that of the currently running task, in which case a context
+ * switch should be requested before the interrupt is exited.
+ *
+ * @return pdPASS if the function was posted, pdFAIL if the work queue was full.
+ *
+ * Example usage:
+   <pre>
+	// The bottom half of the interrupt, executed by the worker task.
+	void vProcessReception( void *pvDevice, uint32_t ulStatus )
+	{
+		// Handle the reception using as much time and stack as necessary.
+	}
+
+	void vAnInterruptHandler( void )
+	{
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+	uint32_t ulStatus;
+
+		// Read and clear the interrupt status, then defer the rest of the
+		// processing to the worker task.
+		ulStatus = ulReadAndClearDeviceStatus();
+		xWorkQueueSubmitFromISR( xDeviceWorkQueue, vProcessReception, &xDevice, ulStatus, &xHigherPriorityTaskWoken );
+
+		portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+	}
+   </pre>
+ * \defgroup xWorkQueueSubmitFromISR xWorkQueueSubmitFromISR
+ * \ingroup WorkQueue
+ */
+BaseType_t xWorkQueueSubmitFromISR( WorkQueueHandle_t xWorkQueue, WorkFunction_t xFunctionToExecute, void *pvParameter1, uint32_t ulParameter2, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WORK_QUEUE_H */
+
@@ -43,7 +43,7 @@ void vListInitialise( List_t * const pxList )
 
 	/* The list end value is the highest possible value in the list to
 	ensure it remains at the end of the list. */
-	pxList->xListEnd.xItemValue = portMAX_DELAY;
+	pxList->xListEnd.xItemValue = portMAX_TICK_COUNT;
 
 	/* The list end next and previous pointers point to itself so we know
 	when the list is empty. */
@@ -103,7 +103,7 @@ ListItem_t * const pxIndex = pxList->pxIndex;
 void vListInsert( List_t * const pxList, ListItem_t * const pxNewListItem )
 {
 ListItem_t *pxIterator;
-const TickType_t xValueOfInsertion = pxNewListItem->xItemValue;
+const TickCount_t xValueOfInsertion = pxNewListItem->xItemValue;
 
 	/* Only effective when configASSERT() is also defined, these tests may catch
 	the list data structures being overwritten in memory.  They will not catch
@@ -119,7 +119,7 @@ const TickType_t xValueOfInsertion = pxNewListItem->xItemValue;
 	share of the CPU.  However, if the xItemValue is the same as the back marker
 	the iteration loop below will not end.  Therefore the value is checked
 	first, and the algorithm slightly modified if necessary. */
-	if( xValueOfInsertion == portMAX_DELAY )
+	if( xValueOfInsertion == portMAX_TICK_COUNT )
 	{
 		pxIterator = pxList->xListEnd.pxPrevious;
 	}
@@ -196,3 +196,69 @@ List_t * const pxList = pxItemToRemove->pxContainer;
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_PRIORITY_EVENT_LISTS == 1 )
+
+	void vListInitialisePriorityList( PriorityList_t * const pxList )
+	{
+	UBaseType_t uxPriority;
+
+		for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configMAX_PRIORITIES; uxPriority++ )
+		{
+			vListInitialise( &( pxList->xLists[ uxPriority ] ) );
+		}
+
+		pxList->uxPrioritiesInUse = ( UBaseType_t ) 0U;
+	}
+	/*-----------------------------------------------------------*/
+
+	void vListInsertPriority( PriorityList_t * const pxList, ListItem_t * const pxNewListItem, UBaseType_t uxPriority )
+	{
+		configASSERT( uxPriority < ( UBaseType_t ) configMAX_PRIORITIES );
+
+		vListInsertEnd( &( pxList->xLists[ uxPriority ] ), pxNewListItem );
+		pxList->uxPrioritiesInUse |= ( ( UBaseType_t ) 1U ) << uxPriority;
+	}
+	/*-----------------------------------------------------------*/
+
+	ListItem_t * pxListGetHighestPriorityItem( PriorityList_t * const pxList )
+	{
+	UBaseType_t uxPriority;
+	ListItem_t *pxReturn = NULL;
+
+		/* Clear the bits of priorities whose items have all been removed by
+		uxListRemove() until a priority that holds an item is found.  There are
+		at most configMAX_PRIORITIES such bits, however many items the list
+		holds. */
+		while( pxList->uxPrioritiesInUse != ( UBaseType_t ) 0U )
+		{
+			#if( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 )
+			{
+				portGET_HIGHEST_PRIORITY( uxPriority, pxList->uxPrioritiesInUse );
+			}
+			#else
+			{
+				uxPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
+
+				while( ( pxList->uxPrioritiesInUse & ( ( ( UBaseType_t ) 1U ) << uxPriority ) ) == ( UBaseType_t ) 0U )
+				{
+					uxPriority--;
+				}
+			}
+			#endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+
+			if( listLIST_IS_EMPTY( &( pxList->xLists[ uxPriority ] ) ) == pdFALSE )
+			{
+				pxReturn = listGET_HEAD_ENTRY( &( pxList->xLists[ uxPriority ] ) );
+				break;
+			}
+			else
+			{
+				pxList->uxPrioritiesInUse &= ~( ( ( UBaseType_t ) 1U ) << uxPriority );
+			}
+		}
+
+		return pxReturn;
+	}
+
+#endif /* configUSE_PRIORITY_EVENT_LISTS */
+/*-----------------------------------------------------------*/
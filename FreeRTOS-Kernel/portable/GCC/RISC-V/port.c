@@ -42,7 +42,18 @@
 #include "portmacro.h"
 #include "string.h"
 
-PRIVILEGED_DATA StackType_t xISRStackTop;
+/* Control block of each hart, indexed by core ID.  The trap handler finds the
+entry of its hart through mscratch, see xPortFreeRTOSInit(). */
+PRIVILEGED_DATA static PortHartLocal_t xHartLocal[ configNUM_CORES ];
+
+/* We require the address of the pxCurrentTCB variable, but don't want to know
+any details of its type. */
+typedef void TCB_t;
+#if( configNUM_CORES > 1 )
+	extern volatile TCB_t * volatile pxCurrentTCBs[];
+#else
+	extern volatile TCB_t * volatile pxCurrentTCB;
+#endif
 
 /*
  * Setup the timer to generate the tick interrupts.  The implementation in this
@@ -51,6 +62,13 @@ PRIVILEGED_DATA StackType_t xISRStackTop;
  */
 void vPortSetupTimerInterrupt( void ) __attribute__( ( weak ) );
 
+#if( portUSE_PLIC_THRESHOLD == 1 )
+	/*
+	 * Set the PLIC threshold from the critical nesting of the running task.
+	 */
+	void vPortSyncInterruptMask( void ) PRIVILEGED_FUNCTION;
+#endif /* portUSE_PLIC_THRESHOLD */
+
 #if( configENABLE_FPU == 1 )
 	/*
 	 * Setup the Floating Point Unit (FPU).
@@ -58,6 +76,15 @@ void vPortSetupTimerInterrupt( void ) __attribute__( ( weak ) );
 	void prvSetupFPU( void ) PRIVILEGED_FUNCTION;
 #endif /* configENABLE_FPU */
 
+#if( configUSE_PICOLIBC_TLS == 1 )
+	/*
+	 * Reserve and initialise the TLS block of a new task just below
+	 * pxTopOfStack.  The address of the block is returned in puxThreadPointer
+	 * and the new top of stack, below the block, is returned.
+	 */
+	static StackType_t * prvInitialiseTaskTLS( StackType_t * pxTopOfStack, UBaseType_t * puxThreadPointer ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_PICOLIBC_TLS */
+
 /*-----------------------------------------------------------*/
 
 /* Used to program the machine timer compare register. */
@@ -67,14 +94,31 @@ const size_t uxTimerIncrementsForOneTick = ( size_t ) ( configCPU_CLOCK_HZ / con
 PRIVILEGED_DATA volatile uint64_t * pullMachineTimerCompareRegister;
 volatile uint64_t * const pullMachineTimerRegister        = ( volatile uint64_t * const ) ( configCLINT_BASE_ADDRESS + 0xBFF8 );
 
+#if( configNUM_CORES > 1 )
+	/* Recursive spinlock guarding the kernel data shared between harts.  The
+	owner is stored as core ID + 1 so that 0 means free. */
+	typedef struct xPORT_LOCK
+	{
+		volatile uint32_t ulLock;
+		volatile BaseType_t xOwner;
+		UBaseType_t uxCount;
+	} PortLock_t;
+
+	PRIVILEGED_DATA static PortLock_t xPortLocks[ 2 ] = { { 0 } };
+
+	/* Set by the boot hart once the tick is running so the other harts can
+	start their first task. */
+	PRIVILEGED_DATA static volatile BaseType_t xPortSchedulerStarted = pdFALSE;
+#endif /* configNUM_CORES > 1 */
+
+#if( ( configNUM_CORES > 1 ) || ( configUSE_AMP == 1 ) )
+	/* MSIP registers used to interrupt the other harts. */
+	volatile uint32_t * const pulMachineSoftwareInterrupt = ( volatile uint32_t * const ) ( configCLINT_BASE_ADDRESS );
+#endif
+
 #if( portUSING_MPU_WRAPPERS == 1 )
 /** Variable that contains the current privilege state */
 volatile uint32_t privilege_status = ePortMACHINE_MODE;
-
-/* We require the address of the pxCurrentTCB variable, but don't want to know
-any details of its type. */
-typedef void TCB_t;
-extern volatile TCB_t * volatile pxCurrentTCB;
 #endif
 
 /* Set configCHECK_FOR_STACK_OVERFLOW to 3 to add ISR stack checking to task
@@ -228,6 +272,7 @@ static void prvSetupPMP( void ) PRIVILEGED_FUNCTION
 BaseType_t xPortFreeRTOSInit( StackType_t xIsrTop ) PRIVILEGED_FUNCTION
 {
 	UBaseType_t uxHartid;
+	PortHartLocal_t *pxHartLocal;
 
 	extern BaseType_t xPortMoveISRStackTop( StackType_t *xISRStackTop);
 
@@ -289,11 +334,22 @@ BaseType_t xPortFreeRTOSInit( StackType_t xIsrTop ) PRIVILEGED_FUNCTION
 	*                     | ....                 |
 	*                     |                      |
 	*              Bottom +----------------------+ xISRStack
+	*
+	* Each hart calls this function with its own buffer, the resulting
+	* xISRStackTop is kept in the control block of the hart.
 	*/
 
-	xISRStackTop = xIsrTop;
+	#if( configNUM_CORES > 1 )
+		pxHartLocal = &xHartLocal[ portGET_CORE_ID() ];
+		pxHartLocal->ppvCurrentTCB = ( void * volatile * ) &pxCurrentTCBs[ portGET_CORE_ID() ];
+	#else
+		pxHartLocal = &xHartLocal[ 0 ];
+		pxHartLocal->ppvCurrentTCB = ( void * volatile * ) &pxCurrentTCB;
+	#endif
+
+	pxHartLocal->xISRStackTop = xIsrTop;
 
-	if ( 0 == xPortMoveISRStackTop(&xISRStackTop)){
+	if ( 0 == xPortMoveISRStackTop( &pxHartLocal->xISRStackTop ) ){
 		/* Error no enough place to store cntext or bad parameter */
 		return -1;
 	}
@@ -303,13 +359,36 @@ BaseType_t xPortFreeRTOSInit( StackType_t xIsrTop ) PRIVILEGED_FUNCTION
         /* Check alignment of the interrupt stack - which is the same as the
         stack that was being used by main() prior to the scheduler being
         started. */
-        configASSERT( ( xISRStackTop & portBYTE_ALIGNMENT_MASK ) == 0 );
+        configASSERT( ( pxHartLocal->xISRStackTop & portBYTE_ALIGNMENT_MASK ) == 0 );
 	}
 	#endif /* configASSERT_DEFINED */
 
     __asm__ __volatile__ ("csrr %0, mhartid" : "=r"(uxHartid));
 
-	pullMachineTimerCompareRegister = ( volatile uint64_t *) ( configCLINT_BASE_ADDRESS + 0x4000 + uxHartid * sizeof(uint64_t) );
+	pxHartLocal->uxHartID = uxHartid;
+
+	/* From now on the trap handler of this hart finds its state through
+	mscratch. */
+	__asm__ __volatile__ ("csrw mscratch, %0" :: "r"(pxHartLocal));
+
+	#if( configNUM_CORES > 1 )
+		/* Only the boot hart takes the tick interrupt, the others are driven
+		by the software interrupts sent from vPortYieldCore(). */
+		if( uxHartid == configFIRST_HART_ID )
+		{
+			pullMachineTimerCompareRegister = ( volatile uint64_t *) ( configCLINT_BASE_ADDRESS + 0x4000 + uxHartid * sizeof(uint64_t) );
+		}
+
+		/* Drop any stale yield request. */
+		pulMachineSoftwareInterrupt[ uxHartid ] = 0UL;
+	#else
+		pullMachineTimerCompareRegister = ( volatile uint64_t *) ( configCLINT_BASE_ADDRESS + 0x4000 + uxHartid * sizeof(uint64_t) );
+	#endif
+
+	#if( configUSE_AMP == 1 )
+		/* Drop any doorbell rung before this instance was ready. */
+		pulMachineSoftwareInterrupt[ uxHartid ] = 0UL;
+	#endif
 
 	#if( configCLINT_BASE_ADDRESS != 0 )
 		/* There is a clint then interrupts can branch directly to the FreeRTOS 
@@ -342,11 +421,7 @@ BaseType_t xPortFreeRTOSInit( StackType_t xIsrTop ) PRIVILEGED_FUNCTION
 #if( portUSING_MPU_WRAPPERS == 1 )
 __attribute__ (( naked )) void vPortPmpSwitch (	uint32_t ulNbPmp,
 												xMPU_SETTINGS * xPMPSettings) PRIVILEGED_FUNCTION
-#else
-__attribute__ (( naked )) void vPortPmpSwitch (	uint32_t ulNbPmp) PRIVILEGED_FUNCTION
-#endif
 {
-#if( portUSING_MPU_WRAPPERS == 1 )
 	/**
 	 * a0: xPmpInfo.nb_pmp - 3 (3 because We use 3 pmp config by default)
 	 * a1: pxCurrentTCB->xPMPSettings (supposed to be the 2nd element of structure TCB_t)
@@ -559,14 +634,13 @@ __attribute__ (( naked )) void vPortPmpSwitch (	uint32_t ulNbPmp) PRIVILEGED_FUN
 	    "fence.i \n"
 		:::
 	);
-#endif /* ( portUSING_MPU_WRAPPERS == 1 ) */
 
 	__asm__ __volatile__ (
 	    "ret \n"
 		:::
 	);
 }
-
+#endif /* ( portUSING_MPU_WRAPPERS == 1 ) */
 /*-----------------------------------------------------------*/
 
 #if( configCLINT_BASE_ADDRESS != 0 )
@@ -631,11 +705,30 @@ BaseType_t xPortStartScheduler( void ) PRIVILEGED_FUNCTION
 	}
 	#endif /* configASSERT_DEFINED */
 
+	#if( portUSE_PLIC_THRESHOLD == 1 )
+	{
+		/* Critical sections no longer clear MIE, so do it here until the
+		first task is started, then drop the threshold raised by
+		vTaskStartScheduler() as the first task is not in a critical
+		section. */
+		__asm volatile ( "csrc mstatus, 8" ::: "memory" );
+		vPortSyncInterruptMask();
+	}
+	#endif /* portUSE_PLIC_THRESHOLD */
+
 	/* If there is a CLINT then it is ok to use the default implementation
 	in this file, otherwise vPortSetupTimerInterrupt() must be implemented to
 	configure whichever clock is to be used to generate the tick interrupt. */
 	vPortSetupTimerInterrupt();
 
+	#if( configNUM_CORES > 1 )
+	{
+		/* Release the other harts waiting in xPortStartSchedulerOnCore(). */
+		__asm volatile ( "fence rw, rw" ::: "memory" );
+		xPortSchedulerStarted = pdTRUE;
+	}
+	#endif /* configNUM_CORES > 1 */
+
 	xPortStartFirstTask();
 
 	/* Should not get here as after calling xPortStartFirstTask() only tasks
@@ -644,6 +737,183 @@ BaseType_t xPortStartScheduler( void ) PRIVILEGED_FUNCTION
 }
 /*-----------------------------------------------------------*/
 
+#if( configNUM_CORES > 1 )
+
+/**
+ * @brief Start the scheduler on a secondary hart
+ * @details Must be called by every hart other than the boot hart after its
+ * own xPortFreeRTOSInit(). Waits for vTaskStartScheduler() to run on the boot
+ * hart, then starts the task it selected for this core.
+ * 
+ * @return BaseType_t error code (pdFAIL)
+ */
+BaseType_t xPortStartSchedulerOnCore( void ) PRIVILEGED_FUNCTION
+{
+	extern void xPortStartFirstTask( void );
+
+	portDISABLE_INTERRUPTS();
+
+	while( xPortSchedulerStarted == pdFALSE )
+	{
+		/* Wait for the boot hart. */
+	}
+
+	__asm volatile ( "fence rw, rw" ::: "memory" );
+
+	xPortStartFirstTask();
+
+	/* Should not get here. */
+	return pdFAIL;
+}
+/*-----------------------------------------------------------*/
+
+void vPortYieldCore( BaseType_t xCoreID )
+{
+	configASSERT( ( xCoreID >= 0 ) && ( xCoreID < configNUM_CORES ) );
+
+	/* Make the kernel state visible before the target hart takes the
+	interrupt. */
+	__asm volatile ( "fence rw, rw" ::: "memory" );
+
+	if( xCoreID == portGET_CORE_ID() )
+	{
+		portYIELD();
+	}
+	else
+	{
+		pulMachineSoftwareInterrupt[ xCoreID + configFIRST_HART_ID ] = 1UL;
+	}
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Take or give one of the kernel spinlocks
+ * @details Must be called with interrupts masked on the calling hart. The
+ * locks are recursive so nested critical sections on the same core do not
+ * deadlock.
+ * 
+ * @param uxLockNum portTASK_LOCK or portISR_LOCK
+ * @param xAcquire  pdTRUE to take the lock, pdFALSE to give it
+ */
+void vPortRecursiveLock( UBaseType_t uxLockNum, BaseType_t xAcquire )
+{
+PortLock_t * const pxLock = &xPortLocks[ uxLockNum ];
+const BaseType_t xOwner = portGET_CORE_ID() + 1;
+uint32_t ulPrevious;
+
+	configASSERT( uxLockNum < ( sizeof( xPortLocks ) / sizeof( xPortLocks[ 0 ] ) ) );
+
+	if( xAcquire != pdFALSE )
+	{
+		if( pxLock->xOwner == xOwner )
+		{
+			pxLock->uxCount++;
+		}
+		else
+		{
+			for( ;; )
+			{
+				/* Spin on a plain load so the line is not bounced between the
+				harts while the lock is held. */
+				while( pxLock->ulLock != 0UL )
+				{
+				}
+
+				__asm volatile ( "amoswap.w.aq %0, %1, (%2)" : "=r"( ulPrevious ) : "r"( 1UL ), "r"( &( pxLock->ulLock ) ) : "memory" );
+
+				if( ulPrevious == 0UL )
+				{
+					break;
+				}
+			}
+
+			pxLock->xOwner = xOwner;
+			pxLock->uxCount = 1;
+		}
+	}
+	else
+	{
+		configASSERT( pxLock->xOwner == xOwner );
+		configASSERT( pxLock->uxCount > 0 );
+
+		pxLock->uxCount--;
+
+		if( pxLock->uxCount == 0 )
+		{
+			pxLock->xOwner = 0;
+			__asm volatile ( "amoswap.w.rl zero, zero, (%0)" :: "r"( &( pxLock->ulLock ) ) : "memory" );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxPortSetInterruptMaskFromISR( void )
+{
+UBaseType_t uxSavedStatusValue;
+
+	/* Masking interrupts only keeps out this hart, the ISR lock keeps out the
+	critical sections and ISRs running on the others.  The lock is recursive,
+	so an ISR lock already held by this hart is taken again. */
+	uxSavedStatusValue = uxPortSetInterruptMask();
+	portGET_ISR_LOCK();
+
+	return uxSavedStatusValue;
+}
+/*-----------------------------------------------------------*/
+
+void vPortClearInterruptMaskFromISR( UBaseType_t uxSavedStatusValue )
+{
+	portRELEASE_ISR_LOCK();
+	portCLEAR_INTERRUPT_MASK( uxSavedStatusValue );
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configNUM_CORES > 1 */
+
+#if( portUSE_PLIC_THRESHOLD == 1 )
+
+/**
+ * @brief Apply the interrupt mask of the running task
+ * @details Called from the trap handler after a context switch. A task can
+ * yield from inside a critical section, so the threshold raised by the task
+ * switched out must not leak into the task switched in.
+ */
+void vPortSyncInterruptMask( void )
+{
+	if( uxTaskGetCriticalNesting() == 0U )
+	{
+		vPortClearInterruptThreshold();
+	}
+	else
+	{
+		vPortRaiseInterruptThreshold();
+	}
+}
+/*-----------------------------------------------------------*/
+
+#endif /* portUSE_PLIC_THRESHOLD */
+
+#if( configUSE_AMP == 1 )
+
+/**
+ * @brief Ring the doorbell of the kernel instance running on another hart
+ * @details Raises the MSIP bit of the target hart, the trap handler of that
+ * instance then services its inter-hart channels.
+ * 
+ * @param uxHartID hart running the instance to signal
+ */
+void vPortAMPRingDoorbell( UBaseType_t uxHartID )
+{
+	/* Make the channel data visible before the target hart takes the
+	interrupt. */
+	__asm volatile ( "fence rw, rw" ::: "memory" );
+
+	pulMachineSoftwareInterrupt[ uxHartID ] = 1UL;
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_AMP */
+
 void vPortEndScheduler( void )
 {
 	extern void xPortRestoreBeforeFirstTask(void);
@@ -658,6 +928,19 @@ void vPortEndScheduler( void )
 }
 /*-----------------------------------------------------------*/
 
+PortHartLocal_t * pxPortGetHartLocal( BaseType_t xCoreID )
+{
+	PortHartLocal_t *pxReturn = NULL;
+
+	if( ( xCoreID >= 0 ) && ( xCoreID < configNUM_CORES ) )
+	{
+		pxReturn = &xHartLocal[ xCoreID ];
+	}
+
+	return pxReturn;
+}
+/*-----------------------------------------------------------*/
+
 #if( portUSING_MPU_WRAPPERS == 1 )
 __attribute__((naked)) void vPortSyscall( unsigned int Value ) PRIVILEGED_FUNCTION
 {
@@ -880,28 +1163,29 @@ void vPortStoreTaskMPUSettings( xMPU_SETTINGS *xPMPSettings,
 /*-----------------------------------------------------------*/
 #endif
 
+/* Only referenced by the trap handler of MPU builds, see portASM.S. */
+#if ( portUSING_MPU_WRAPPERS == 1 )
 __attribute__((naked)) void vPortUpdatePrivilegeStatus( UBaseType_t status ) PRIVILEGED_FUNCTION
 {
 	/* Remove compiler warning about unused parameter. */
 	( void ) status;
 
-	#if ( portUSING_MPU_WRAPPERS == 1 )
-        __asm__ __volatile__(
-			"	.extern privilege_status \n"
-			"	li t0, 0x1800		\n"
-			"	and t0, a0, t0		\n"
-			"	srli t0, t0, 11		\n"
-			"	la a0, privilege_status \n"
-			"	sw	t0, 0(a0)"
-            ::: "t0", "a0"
-        );
-	#endif /* if ( portUSING_MPU_WRAPPERS == 1 ) */
+	__asm__ __volatile__(
+		"	.extern privilege_status \n"
+		"	li t0, 0x1800		\n"
+		"	and t0, a0, t0		\n"
+		"	srli t0, t0, 11		\n"
+		"	la a0, privilege_status \n"
+		"	sw	t0, 0(a0)"
+		::: "t0", "a0"
+	);
 
  	__asm__ __volatile__ ( 
         "	ret 		\n"
         :::
 	);
 }
+#endif /* if ( portUSING_MPU_WRAPPERS == 1 ) */
 /*-----------------------------------------------------------*/
 
 #if ( portUSING_MPU_WRAPPERS == 1 )
@@ -915,8 +1199,21 @@ StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
 										void * pvParameters ) PRIVILEGED_FUNCTION
 #endif /* if ( portUSING_MPU_WRAPPERS == 1 ) */
 {
-	UBaseType_t mstatus;
-	extern StackType_t * pxPortAsmInitialiseStack( StackType_t *, TaskFunction_t, void *, UBaseType_t);
+	UBaseType_t mstatus, uxThreadPointer;
+	extern StackType_t * pxPortAsmInitialiseStack( StackType_t *, TaskFunction_t, void *, UBaseType_t, UBaseType_t );
+
+	/* The task starts with the thread pointer of its own TLS block, which is
+	then saved and restored with the rest of its context.  Without TLS it
+	inherits the thread pointer of the code creating it. */
+	#if( configUSE_PICOLIBC_TLS == 1 )
+	{
+		pxTopOfStack = prvInitialiseTaskTLS( pxTopOfStack, &uxThreadPointer );
+	}
+	#else
+	{
+		__asm__ __volatile__ ( "mv %0, tp" : "=r" ( uxThreadPointer ) );
+	}
+	#endif /* configUSE_PICOLIBC_TLS */
 
 	/* Generate the value to set in mstatus. */
 	#if( portUSING_MPU_WRAPPERS == 1 )
@@ -956,10 +1253,30 @@ StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
 		);
 	#endif /* ( portUSING_MPU_WRAPPERS == 1 ) */
 
-	return pxPortAsmInitialiseStack(pxTopOfStack, pxCode, pvParameters, mstatus);
+	return pxPortAsmInitialiseStack(pxTopOfStack, pxCode, pvParameters, mstatus, uxThreadPointer);
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_PICOLIBC_TLS == 1 )
+	static StackType_t * prvInitialiseTaskTLS( StackType_t * pxTopOfStack, UBaseType_t * puxThreadPointer )
+	{
+	UBaseType_t uxTLS;
+
+		/* The size and alignment of the block come from the .tdata and .tbss
+		sections of the linked image, so each task reserves exactly what the
+		application uses, out of its own stack. */
+		uxTLS = ( ( UBaseType_t ) pxTopOfStack ) - ( UBaseType_t ) _tls_size();
+		uxTLS &= ~( ( UBaseType_t ) _tls_align() - ( UBaseType_t ) 1U );
+
+		/* Copy in the .tdata initial values and clear the .tbss part. */
+		_init_tls( ( void * ) uxTLS );
+		*puxThreadPointer = uxTLS;
+
+		return ( StackType_t * ) ( uxTLS & ~( ( UBaseType_t ) portBYTE_ALIGNMENT_MASK ) );
+	}
+#endif /* configUSE_PICOLIBC_TLS */
+/*-----------------------------------------------------------*/
+
 #if( configENABLE_FPU == 1 )
 	void prvSetupFPU( void ) /* PRIVILEGED_FUNCTION */
 	{
@@ -269,6 +269,35 @@ BaseType_t xIsPrivileged( void );
 #define portBYTE_ALIGNMENT 			16
 /*-----------------------------------------------------------*/
 
+/* Hart local storage. */
+
+/**
+ * @brief Per hart control block
+ * @details xPortFreeRTOSInit() fills the block of the calling hart and points
+ * its mscratch at it, so the trap handler reaches the ISR stack and the task
+ * running on the hart with a single CSR read.  The layout is mirrored by the
+ * portasmHART_* offsets in portASM.S.
+ */
+typedef struct PORT_HART_LOCAL
+{
+	StackType_t xISRStackTop;					/* Top of the ISR stack of the hart. */
+	void * volatile * ppvCurrentTCB;			/* pxCurrentTCB entry of the hart. */
+	UBaseType_t uxScratch;						/* Register spill slot used on trap entry. */
+	UBaseType_t uxHartID;						/* mhartid of the hart. */
+	volatile UBaseType_t uxInterruptCount;		/* Interrupts taken by the hart. */
+	volatile UBaseType_t uxExceptionCount;		/* Exceptions passed to portHANDLE_EXCEPTION. */
+	volatile UBaseType_t uxSwitchContextCount;	/* Calls to vTaskSwitchContext() from the trap handler. */
+} PortHartLocal_t;
+
+/**
+ * @brief Get the control block of a hart
+ * 
+ * @param xCoreID core ID as returned by portGET_CORE_ID(), 0 on single core builds
+ * @return PortHartLocal_t* control block, NULL if xCoreID is out of range
+ */
+extern PortHartLocal_t * pxPortGetHartLocal( BaseType_t xCoreID );
+/*-----------------------------------------------------------*/
+
 void vPortFreeRTOSInit( StackType_t xTopOfStack );
 
 extern void vPortFreeRTOSInit( StackType_t );
@@ -286,12 +315,74 @@ extern void vTaskSwitchContext( void );
 
 /* Critical section management. */
 #define portCRITICAL_NESTING_IN_TCB					1
+
+/* With configUSE_PICOLIBC_TLS the TLS block of each task is placed at the top
+of its stack and tp is switched with the other registers, see
+pxPortInitialiseStack(). */
+#define portTLS_IN_TASK_CONTEXT						1
 extern void vTaskEnterCritical( void );
 extern void vTaskExitCritical( void );
 
+#if( configNUM_CORES > 1 )
+/* With several harts an ISR must really mask interrupts and take the ISR lock,
+as the kernel data it touches is shared with code running on the other
+harts. */
+extern UBaseType_t uxPortSetInterruptMaskFromISR( void );
+extern void vPortClearInterruptMaskFromISR( UBaseType_t uxSavedStatusValue );
+#define portSET_INTERRUPT_MASK_FROM_ISR() 			uxPortSetInterruptMaskFromISR()
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedStatusValue ) vPortClearInterruptMaskFromISR( uxSavedStatusValue )
+#else
 #define portSET_INTERRUPT_MASK_FROM_ISR() 			0
 #define portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedStatusValue ) ( void ) uxSavedStatusValue
-#if( portUSING_MPU_WRAPPERS == 1 )
+#endif
+
+/* When configMAX_SYSCALL_INTERRUPT_PRIORITY is set, critical sections raise the
+PLIC priority threshold of the hart instead of clearing mstatus.MIE, so external
+interrupts with a priority above configMAX_SYSCALL_INTERRUPT_PRIORITY are never
+delayed by the kernel.  Such interrupts must not call any FreeRTOS API. */
+#if defined( configMAX_SYSCALL_INTERRUPT_PRIORITY ) && ( configMAX_SYSCALL_INTERRUPT_PRIORITY > 0 )
+	#define portUSE_PLIC_THRESHOLD						1
+#else
+	#define portUSE_PLIC_THRESHOLD						0
+#endif
+
+#if( portUSE_PLIC_THRESHOLD == 1 )
+
+	#if( portUSING_MPU_WRAPPERS == 1 )
+		#error configMAX_SYSCALL_INTERRUPT_PRIORITY is not supported together with the MPU wrappers
+	#endif
+
+	#if( configNUM_CORES > 1 )
+		#error configMAX_SYSCALL_INTERRUPT_PRIORITY is not supported when configNUM_CORES > 1
+	#endif
+
+	#ifndef configPLIC_BASE_ADDRESS
+		#error configPLIC_BASE_ADDRESS must be defined when configMAX_SYSCALL_INTERRUPT_PRIORITY is used
+	#endif
+
+	/* PLIC context of the hart's machine mode, 0 on single hart parts. */
+	#ifndef configPLIC_MACHINE_CONTEXT
+		#define configPLIC_MACHINE_CONTEXT				0
+	#endif
+
+	#define portPLIC_THRESHOLD_REGISTER					( *( ( volatile uint32_t * ) ( ( configPLIC_BASE_ADDRESS ) + 0x200000UL + ( ( configPLIC_MACHINE_CONTEXT ) * 0x1000UL ) ) ) )
+
+	/* The CLINT timer and software interrupts are not routed through the PLIC,
+	so the threshold cannot hold them off and they are masked in mie instead. */
+	#if( configCLINT_BASE_ADDRESS != 0 )
+		#if( configUSE_AMP == 1 )
+			#define portMIE_CLINT_INTERRUPTS			0x88UL
+		#else
+			#define portMIE_CLINT_INTERRUPTS			0x80UL
+		#endif
+	#else
+		#define portMIE_CLINT_INTERRUPTS				0x00UL
+	#endif
+
+	#define portDISABLE_INTERRUPTS()	vPortRaiseInterruptThreshold()
+	#define portENABLE_INTERRUPTS()		vPortClearInterruptThreshold()
+
+#elif( portUSING_MPU_WRAPPERS == 1 )
 #define portDISABLE_INTERRUPTS()	vPortSyscall(portSVC_DISABLE_INTERRUPTS)
 #define portENABLE_INTERRUPTS()		vPortSyscall(portSVC_ENABLE_INTERRUPTS)
 #else
@@ -341,6 +432,154 @@ not necessary for to use this port.  They are defined so the common demo files
 #endif
 
 #define portMEMORY_BARRIER() 	__asm volatile ( "" ::: "memory" )
+/*-----------------------------------------------------------*/
+
+/* Ordered accesses used by the lock free parts of the kernel.  Aligned word
+loads and stores are single copy atomic on RISC-V, the compare and swap needs
+the A extension. */
+#define portATOMIC_LOAD_ACQUIRE_U32( pulSource )					__atomic_load_n( ( pulSource ), __ATOMIC_ACQUIRE )
+#define portATOMIC_STORE_RELEASE_U32( pulDestination, ulValue )	__atomic_store_n( ( pulDestination ), ( ulValue ), __ATOMIC_RELEASE )
+
+#if defined( __riscv_atomic )
+
+	static portFORCE_INLINE BaseType_t xPortCompareAndSwapU32( volatile uint32_t *pulDestination, uint32_t ulComparand, uint32_t ulExchange )
+	{
+		return __atomic_compare_exchange_n( pulDestination, &ulComparand, ulExchange, pdFALSE, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST ) ? pdTRUE : pdFALSE;
+	}
+
+	#define portATOMIC_COMPARE_AND_SWAP_U32( pulDestination, ulComparand, ulExchange )	xPortCompareAndSwapU32( ( pulDestination ), ( ulComparand ), ( ulExchange ) )
+
+#endif /* __riscv_atomic */
+/*-----------------------------------------------------------*/
+
+/* Low 32 bits of the cycle counter, used by the kernel to time stamp
+scheduling events.  The kernel always runs in machine mode. */
+static portFORCE_INLINE uint32_t ulPortGetCycleCount( void )
+{
+UBaseType_t uxCycles;
+
+	__asm volatile ( "csrr %0, mcycle" : "=r"( uxCycles ) );
+	return ( uint32_t ) uxCycles;
+}
+
+#define portGET_CYCLE_COUNT()	ulPortGetCycleCount()
+
+/* Stall the hart until an interrupt is pending.  Returns even if interrupts
+are disabled. */
+#define portWAIT_FOR_INTERRUPT()	__asm volatile ( "wfi" ::: "memory" )
+
+/* Interrupts are held off around the wait by clearing mstatus.MIE alone.  wfi
+only returns for interrupts that are enabled in mie and, with
+portUSE_PLIC_THRESHOLD, above the PLIC threshold, so portDISABLE_INTERRUPTS()
+would stop the tick and kernel interrupts ending the wait. */
+#if( portUSING_MPU_WRAPPERS == 0 )
+	#define portDISABLE_INTERRUPTS_FOR_WAIT()	__asm volatile ( "csrc mstatus, 8" ::: "memory" )
+	#define portENABLE_INTERRUPTS_AFTER_WAIT()	__asm volatile ( "csrs mstatus, 8" ::: "memory" )
+#endif
+/*-----------------------------------------------------------*/
+
+/* PLIC threshold based critical sections. */
+#if( portUSE_PLIC_THRESHOLD == 1 )
+
+	static portFORCE_INLINE void vPortRaiseInterruptThreshold( void )
+	{
+		__asm volatile ( "csrc mie, %0" :: "r"( portMIE_CLINT_INTERRUPTS ) : "memory" );
+		portPLIC_THRESHOLD_REGISTER = ( uint32_t ) configMAX_SYSCALL_INTERRUPT_PRIORITY;
+
+		/* Read the threshold back so it is in force before the critical
+		section is entered. */
+		__asm volatile ( "fence io, io" ::: "memory" );
+		( void ) portPLIC_THRESHOLD_REGISTER;
+	}
+
+	static portFORCE_INLINE void vPortClearInterruptThreshold( void )
+	{
+		__asm volatile ( "fence io, io" ::: "memory" );
+		portPLIC_THRESHOLD_REGISTER = 0UL;
+		__asm volatile ( "csrs mie, %0" :: "r"( portMIE_CLINT_INTERRUPTS ) : "memory" );
+	}
+
+#endif /* portUSE_PLIC_THRESHOLD */
+/*-----------------------------------------------------------*/
+
+/* Symmetric multiprocessing support. */
+#if( configNUM_CORES > 1 )
+
+	#if( portUSING_MPU_WRAPPERS == 1 )
+		#error configNUM_CORES > 1 is not supported together with the MPU wrappers
+	#endif
+
+	#ifndef configCLINT_BASE_ADDRESS
+		#error configCLINT_BASE_ADDRESS must be defined when configNUM_CORES > 1, the CLINT MSIP registers are used to interrupt the other harts
+	#endif
+
+	/* Hart ID of the first hart running the kernel.  Core IDs used by the
+	kernel are the hart IDs minus this value (e.g. set it to 1 on a U54-MC,
+	where hart 0 is the E51 monitor core). */
+	#ifndef configFIRST_HART_ID
+		#define configFIRST_HART_ID			0
+	#endif
+
+	/* Index of the two recursive spinlocks used by the kernel. */
+	#define portTASK_LOCK						0
+	#define portISR_LOCK						1
+
+	static portFORCE_INLINE UBaseType_t uxPortGetCoreID( void )
+	{
+	UBaseType_t uxHartID;
+
+		__asm volatile ( "csrr %0, mhartid" : "=r"( uxHartID ) );
+		return uxHartID - ( UBaseType_t ) configFIRST_HART_ID;
+	}
+
+	/* Mask the machine interrupts of the calling hart and return the previous
+	MIE state so it can be restored by portCLEAR_INTERRUPT_MASK(). */
+	static portFORCE_INLINE UBaseType_t uxPortSetInterruptMask( void )
+	{
+	UBaseType_t uxStatus;
+
+		__asm volatile ( "csrrci %0, mstatus, 8" : "=r"( uxStatus ) :: "memory" );
+		return uxStatus & 8UL;
+	}
+
+	extern void vPortYieldCore( BaseType_t xCoreID );
+	extern void vPortRecursiveLock( UBaseType_t uxLockNum, BaseType_t xAcquire );
+	extern BaseType_t xPortStartSchedulerOnCore( void );
+
+	#define portGET_CORE_ID()					( ( BaseType_t ) uxPortGetCoreID() )
+	#define portYIELD_CORE( xCoreID )			vPortYieldCore( xCoreID )
+	#define portSET_INTERRUPT_MASK()			uxPortSetInterruptMask()
+	#define portCLEAR_INTERRUPT_MASK( uxSavedStatusValue ) __asm volatile ( "csrs mstatus, %0" :: "r"( uxSavedStatusValue ) : "memory" )
+	#define portGET_TASK_LOCK()					vPortRecursiveLock( portTASK_LOCK, pdTRUE )
+	#define portRELEASE_TASK_LOCK()				vPortRecursiveLock( portTASK_LOCK, pdFALSE )
+	#define portGET_ISR_LOCK()					vPortRecursiveLock( portISR_LOCK, pdTRUE )
+	#define portRELEASE_ISR_LOCK()				vPortRecursiveLock( portISR_LOCK, pdFALSE )
+
+#endif /* configNUM_CORES > 1 */
+/*-----------------------------------------------------------*/
+
+/* Asymmetric multiprocessing support, one kernel instance per hart. */
+#if( configUSE_AMP == 1 )
+
+	#ifndef configCLINT_BASE_ADDRESS
+		#error configCLINT_BASE_ADDRESS must be defined when configUSE_AMP is 1, the CLINT MSIP registers are used as doorbells between the harts
+	#endif
+
+	static portFORCE_INLINE UBaseType_t uxPortGetHartID( void )
+	{
+	UBaseType_t uxHartID;
+
+		__asm volatile ( "csrr %0, mhartid" : "=r"( uxHartID ) );
+		return uxHartID;
+	}
+
+	extern void vPortAMPRingDoorbell( UBaseType_t uxHartID );
+
+	#define portGET_HART_ID()					uxPortGetHartID()
+	#define portAMP_RING_DOORBELL( uxHartID )	vPortAMPRingDoorbell( uxHartID )
+	#define portAMP_MEMORY_FENCE()				__asm volatile ( "fence rw, rw" ::: "memory" )
+
+#endif /* configUSE_AMP */
 
 #ifdef __cplusplus
 }
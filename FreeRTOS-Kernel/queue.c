@@ -74,6 +74,10 @@ typedef struct SemaphoreData
 {
 	TaskHandle_t xMutexHolder;		 /*< The handle of the task that holds the mutex. */
 	UBaseType_t uxRecursiveCallCount;/*< Maintains a count of the number of times a recursive mutex has been recursively 'taken' when the structure is used as a mutex. */
+	#if( configUSE_CEILING_MUTEXES == 1 )
+		UBaseType_t uxCeilingPriority;		/*< The priority to which the holder is raised, or tskIDLE_PRIORITY if the mutex uses priority inheritance. */
+		UBaseType_t uxPriorityBeforeCeiling;/*< The priority the holder had before it was raised to the ceiling. */
+	#endif
 } SemaphoreData_t;
 
 /* Semaphores do not actually store or copy data, so have an item size of
@@ -81,6 +85,33 @@ zero. */
 #define queueSEMAPHORE_QUEUE_ITEM_LENGTH ( ( UBaseType_t ) 0 )
 #define queueMUTEX_GIVE_BLOCK_TIME		 ( ( TickType_t ) 0U )
 
+#if( configUSE_CEILING_MUTEXES == 1 )
+	/* Ceiling mutex holders already run at or above the priority of any task
+	that can wait for the mutex, so only other mutexes use inheritance. */
+	#define queueUSES_PRIORITY_INHERITANCE( pxQueue ) ( ( ( pxQueue )->uxQueueType == queueQUEUE_IS_MUTEX ) && ( ( pxQueue )->u.xSemaphore.uxCeilingPriority == tskIDLE_PRIORITY ) )
+#else
+	#define queueUSES_PRIORITY_INHERITANCE( pxQueue ) ( ( pxQueue )->uxQueueType == queueQUEUE_IS_MUTEX )
+#endif
+
+#if( configUSE_PRIORITY_EVENT_LISTS == 1 )
+	/* Tasks waiting to send to or receive from a queue are held in one list per
+	priority, so blocking on and unblocking from the queue take a constant time
+	however many tasks are waiting. */
+	typedef PriorityList_t QueueEventList_t;
+	#define queueINITIALISE_EVENT_LIST( pxEventList )					vListInitialisePriorityList( pxEventList )
+	#define queueEVENT_LIST_IS_EMPTY( pxEventList )						listPRIORITY_LIST_IS_EMPTY( pxEventList )
+	#define queuePLACE_ON_EVENT_LIST( pxEventList, xTicksToWait )		vTaskPlaceOnPriorityEventList( ( pxEventList ), ( xTicksToWait ) )
+	#define queuePLACE_ON_EVENT_LIST_RESTRICTED( pxEventList, xTicksToWait, xWaitIndefinitely ) vTaskPlaceOnPriorityEventListRestricted( ( pxEventList ), ( xTicksToWait ), ( xWaitIndefinitely ) )
+	#define queueREMOVE_FROM_EVENT_LIST( pxEventList )					xTaskRemoveFromPriorityEventList( pxEventList )
+#else
+	typedef List_t QueueEventList_t;
+	#define queueINITIALISE_EVENT_LIST( pxEventList )					vListInitialise( pxEventList )
+	#define queueEVENT_LIST_IS_EMPTY( pxEventList )						listLIST_IS_EMPTY( pxEventList )
+	#define queuePLACE_ON_EVENT_LIST( pxEventList, xTicksToWait )		vTaskPlaceOnEventList( ( pxEventList ), ( xTicksToWait ) )
+	#define queuePLACE_ON_EVENT_LIST_RESTRICTED( pxEventList, xTicksToWait, xWaitIndefinitely ) vTaskPlaceOnEventListRestricted( ( pxEventList ), ( xTicksToWait ), ( xWaitIndefinitely ) )
+	#define queueREMOVE_FROM_EVENT_LIST( pxEventList )					xTaskRemoveFromEventList( pxEventList )
+#endif /* configUSE_PRIORITY_EVENT_LISTS */
+
 #if( configUSE_PREEMPTION == 0 )
 	/* If the cooperative scheduler is being used then a yield should not be
 	performed just because a higher priority task has been woken. */
@@ -105,8 +136,8 @@ typedef struct QueueDefinition 		/* The old naming convention is used to prevent
 		SemaphoreData_t xSemaphore; /*< Data required exclusively when this structure is used as a semaphore. */
 	} u;
 
-	List_t xTasksWaitingToSend;		/*< List of tasks that are blocked waiting to post onto this queue.  Stored in priority order. */
-	List_t xTasksWaitingToReceive;	/*< List of tasks that are blocked waiting to read from this queue.  Stored in priority order. */
+	QueueEventList_t xTasksWaitingToSend;		/*< List of tasks that are blocked waiting to post onto this queue.  Stored in priority order. */
+	QueueEventList_t xTasksWaitingToReceive;	/*< List of tasks that are blocked waiting to read from this queue.  Stored in priority order. */
 
 	volatile UBaseType_t uxMessagesWaiting;/*< The number of items currently in the queue. */
 	UBaseType_t uxLength;			/*< The length of the queue defined as the number of items it will hold, not the number of bytes. */
@@ -227,9 +258,10 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 	 * priority, but the waiting task times out, then the holder should
 	 * disinherit the priority - but only down to the highest priority of any
 	 * other tasks that are waiting for the same mutex.  This function returns
-	 * that priority.
+	 * that priority.  The queue is not const as looking up the highest priority
+	 * item in a priority event list clears its stale priority bits.
 	 */
-	static UBaseType_t prvGetDisinheritPriorityAfterTimeout( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+	static UBaseType_t prvGetDisinheritPriorityAfterTimeout( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
 #endif
 /*-----------------------------------------------------------*/
 
@@ -274,9 +306,9 @@ Queue_t * const pxQueue = xQueue;
 			will still be empty.  If there are tasks blocked waiting to write to
 			the queue, then one should be unblocked as after this function exits
 			it will be possible to write to it. */
-			if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+			if( queueEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
 			{
-				if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+				if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
 				{
 					queueYIELD_IF_USING_PREEMPTION();
 				}
@@ -293,8 +325,8 @@ Queue_t * const pxQueue = xQueue;
 		else
 		{
 			/* Ensure the event queues start in the correct state. */
-			vListInitialise( &( pxQueue->xTasksWaitingToSend ) );
-			vListInitialise( &( pxQueue->xTasksWaitingToReceive ) );
+			queueINITIALISE_EVENT_LIST( &( pxQueue->xTasksWaitingToSend ) );
+			queueINITIALISE_EVENT_LIST( &( pxQueue->xTasksWaitingToReceive ) );
 		}
 	}
 	taskEXIT_CRITICAL();
@@ -484,6 +516,15 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 			/* In case this is a recursive mutex. */
 			pxNewQueue->u.xSemaphore.uxRecursiveCallCount = 0;
 
+			#if( configUSE_CEILING_MUTEXES == 1 )
+			{
+				/* Use priority inheritance unless a ceiling is set once the
+				mutex has been initialised. */
+				pxNewQueue->u.xSemaphore.uxCeilingPriority = tskIDLE_PRIORITY;
+				pxNewQueue->u.xSemaphore.uxPriorityBeforeCeiling = tskIDLE_PRIORITY;
+			}
+			#endif
+
 			traceCREATE_MUTEX( pxNewQueue );
 
 			/* Start with the semaphore in the expected state. */
@@ -534,6 +575,58 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 #endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
+#if( ( configUSE_CEILING_MUTEXES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+	QueueHandle_t xQueueCreateCeilingMutex( const UBaseType_t uxCeilingPriority )
+	{
+	QueueHandle_t xNewQueue;
+
+		configASSERT( ( uxCeilingPriority > tskIDLE_PRIORITY ) && ( uxCeilingPriority < ( UBaseType_t ) configMAX_PRIORITIES ) );
+
+		xNewQueue = xQueueCreateMutex( queueQUEUE_TYPE_CEILING_MUTEX );
+
+		/* The ceiling is only set after the mutex has been given by
+		prvInitialiseMutex(), as at that point it has no holder to restore. */
+		if( xNewQueue != NULL )
+		{
+			( ( Queue_t * ) xNewQueue )->u.xSemaphore.uxCeilingPriority = uxCeilingPriority;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xNewQueue;
+	}
+
+#endif /* configUSE_CEILING_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_CEILING_MUTEXES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+	QueueHandle_t xQueueCreateCeilingMutexStatic( const UBaseType_t uxCeilingPriority, StaticQueue_t *pxStaticQueue )
+	{
+	QueueHandle_t xNewQueue;
+
+		configASSERT( ( uxCeilingPriority > tskIDLE_PRIORITY ) && ( uxCeilingPriority < ( UBaseType_t ) configMAX_PRIORITIES ) );
+
+		xNewQueue = xQueueCreateMutexStatic( queueQUEUE_TYPE_CEILING_MUTEX, pxStaticQueue );
+
+		if( xNewQueue != NULL )
+		{
+			( ( Queue_t * ) xNewQueue )->u.xSemaphore.uxCeilingPriority = uxCeilingPriority;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xNewQueue;
+	}
+
+#endif /* configUSE_CEILING_MUTEXES */
+/*-----------------------------------------------------------*/
+
 #if ( ( configUSE_MUTEXES == 1 ) && ( INCLUDE_xSemaphoreGetMutexHolder == 1 ) )
 
 	TaskHandle_t xQueueGetMutexHolder( QueueHandle_t xSemaphore )
@@ -806,9 +899,9 @@ Queue_t * const pxQueue = xQueue;
 					{
 						/* If there was a task waiting for data to arrive on the
 						queue then unblock it now. */
-						if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+						if( queueEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 						{
-							if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+							if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
 							{
 								/* The unblocked task has a priority higher than
 								our own so yield immediately.  Yes it is ok to
@@ -841,9 +934,9 @@ Queue_t * const pxQueue = xQueue;
 
 					/* If there was a task waiting for data to arrive on the
 					queue then unblock it now. */
-					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+					if( queueEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 					{
-						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+						if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
 						{
 							/* The unblocked task has a priority higher than
 							our own so yield immediately.  Yes it is ok to do
@@ -915,7 +1008,7 @@ Queue_t * const pxQueue = xQueue;
 			if( prvIsQueueFull( pxQueue ) != pdFALSE )
 			{
 				traceBLOCKING_ON_QUEUE_SEND( pxQueue );
-				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+				queuePLACE_ON_EVENT_LIST( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
 
 				/* Unlocking the queue means queue events can effect the
 				event list.  It is possible that interrupts occurring now
@@ -1029,9 +1122,9 @@ Queue_t * const pxQueue = xQueue;
 					}
 					else
 					{
-						if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+						if( queueEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 						{
-							if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+							if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
 							{
 								/* The task waiting has a higher priority so
 								record that a context switch is required. */
@@ -1057,9 +1150,9 @@ Queue_t * const pxQueue = xQueue;
 				}
 				#else /* configUSE_QUEUE_SETS */
 				{
-					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+					if( queueEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 					{
-						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+						if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
 						{
 							/* The task waiting has a higher priority so record that a
 							context	switch is required. */
@@ -1194,9 +1287,9 @@ Queue_t * const pxQueue = xQueue;
 					}
 					else
 					{
-						if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+						if( queueEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 						{
-							if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+							if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
 							{
 								/* The task waiting has a higher priority so
 								record that a context switch is required. */
@@ -1222,9 +1315,9 @@ Queue_t * const pxQueue = xQueue;
 				}
 				#else /* configUSE_QUEUE_SETS */
 				{
-					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+					if( queueEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 					{
-						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+						if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
 						{
 							/* The task waiting has a higher priority so record that a
 							context	switch is required. */
@@ -1312,9 +1405,9 @@ Queue_t * const pxQueue = xQueue;
 				/* There is now space in the queue, were any tasks waiting to
 				post to the queue?  If so, unblock the highest priority waiting
 				task. */
-				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+				if( queueEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
 				{
-					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+					if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
 					{
 						queueYIELD_IF_USING_PREEMPTION();
 					}
@@ -1371,7 +1464,7 @@ Queue_t * const pxQueue = xQueue;
 			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
 			{
 				traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
-				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+				queuePLACE_ON_EVENT_LIST( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
 				prvUnlockQueue( pxQueue );
 				if( xTaskResumeAll() == pdFALSE )
 				{
@@ -1464,6 +1557,23 @@ Queue_t * const pxQueue = xQueue;
 						/* Record the information required to implement
 						priority inheritance should it become necessary. */
 						pxQueue->u.xSemaphore.xMutexHolder = pvTaskIncrementMutexHeldCount();
+
+						#if( configUSE_CEILING_MUTEXES == 1 )
+						{
+							if( pxQueue->u.xSemaphore.uxCeilingPriority != tskIDLE_PRIORITY )
+							{
+								/* Immediate ceiling protocol - raise the new
+								holder to the ceiling now, rather than waiting
+								for a higher priority task to block on the
+								mutex. */
+								pxQueue->u.xSemaphore.uxPriorityBeforeCeiling = uxTaskPriorityRaiseToCeiling( pxQueue->u.xSemaphore.uxCeilingPriority );
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						#endif /* configUSE_CEILING_MUTEXES */
 					}
 					else
 					{
@@ -1474,9 +1584,9 @@ Queue_t * const pxQueue = xQueue;
 
 				/* Check to see if other tasks are blocked waiting to give the
 				semaphore, and if so, unblock the highest priority such task. */
-				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+				if( queueEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
 				{
-					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+					if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
 					{
 						queueYIELD_IF_USING_PREEMPTION();
 					}
@@ -1547,7 +1657,7 @@ Queue_t * const pxQueue = xQueue;
 
 				#if ( configUSE_MUTEXES == 1 )
 				{
-					if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+					if( queueUSES_PRIORITY_INHERITANCE( pxQueue ) )
 					{
 						taskENTER_CRITICAL();
 						{
@@ -1562,7 +1672,7 @@ Queue_t * const pxQueue = xQueue;
 				}
 				#endif
 
-				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+				queuePLACE_ON_EVENT_LIST( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
 				prvUnlockQueue( pxQueue );
 				if( xTaskResumeAll() == pdFALSE )
 				{
@@ -1677,9 +1787,9 @@ Queue_t * const pxQueue = xQueue;
 
 				/* The data is being left in the queue, so see if there are
 				any other tasks waiting for the data. */
-				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+				if( queueEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 				{
-					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+					if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
 					{
 						/* The task waiting has a higher priority than this task. */
 						queueYIELD_IF_USING_PREEMPTION();
@@ -1738,7 +1848,7 @@ Queue_t * const pxQueue = xQueue;
 			if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
 			{
 				traceBLOCKING_ON_QUEUE_PEEK( pxQueue );
-				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+				queuePLACE_ON_EVENT_LIST( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
 				prvUnlockQueue( pxQueue );
 				if( xTaskResumeAll() == pdFALSE )
 				{
@@ -1823,9 +1933,9 @@ Queue_t * const pxQueue = xQueue;
 			locked. */
 			if( cRxLock == queueUNLOCKED )
 			{
-				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+				if( queueEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
 				{
-					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+					if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
 					{
 						/* The task waiting has a higher priority than us so
 						force a context switch. */
@@ -2042,7 +2152,7 @@ Queue_t * const pxQueue = xQueue;
 
 #if( configUSE_MUTEXES == 1 )
 
-	static UBaseType_t prvGetDisinheritPriorityAfterTimeout( const Queue_t * const pxQueue )
+	static UBaseType_t prvGetDisinheritPriorityAfterTimeout( Queue_t * const pxQueue )
 	{
 	UBaseType_t uxHighestPriorityOfWaitingTasks;
 
@@ -2052,9 +2162,17 @@ Queue_t * const pxQueue = xQueue;
 		other tasks that are waiting for the same mutex.  For this purpose,
 		return the priority of the highest priority task that is waiting for the
 		mutex. */
-		if( listCURRENT_LIST_LENGTH( &( pxQueue->xTasksWaitingToReceive ) ) > 0U )
+		if( queueEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 		{
-			uxHighestPriorityOfWaitingTasks = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxQueue->xTasksWaitingToReceive ) );
+			#if( configUSE_PRIORITY_EVENT_LISTS == 1 )
+			{
+				uxHighestPriorityOfWaitingTasks = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_LIST_ITEM_VALUE( pxListGetHighestPriorityItem( &( pxQueue->xTasksWaitingToReceive ) ) );
+			}
+			#else
+			{
+				uxHighestPriorityOfWaitingTasks = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxQueue->xTasksWaitingToReceive ) );
+			}
+			#endif /* configUSE_PRIORITY_EVENT_LISTS */
 		}
 		else
 		{
@@ -2083,7 +2201,22 @@ UBaseType_t uxMessagesWaiting;
 			if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
 			{
 				/* The mutex is no longer being held. */
-				xReturn = xTaskPriorityDisinherit( pxQueue->u.xSemaphore.xMutexHolder );
+				#if( configUSE_CEILING_MUTEXES == 1 )
+				{
+					if( pxQueue->u.xSemaphore.uxCeilingPriority != tskIDLE_PRIORITY )
+					{
+						xReturn = xTaskPriorityRestoreFromCeiling( pxQueue->u.xSemaphore.xMutexHolder, pxQueue->u.xSemaphore.uxCeilingPriority, pxQueue->u.xSemaphore.uxPriorityBeforeCeiling );
+					}
+					else
+					{
+						xReturn = xTaskPriorityDisinherit( pxQueue->u.xSemaphore.xMutexHolder );
+					}
+				}
+				#else
+				{
+					xReturn = xTaskPriorityDisinherit( pxQueue->u.xSemaphore.xMutexHolder );
+				}
+				#endif /* configUSE_CEILING_MUTEXES */
 				pxQueue->u.xSemaphore.xMutexHolder = NULL;
 			}
 			else
@@ -2202,9 +2335,9 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
 					/* Tasks that are removed from the event list will get
 					added to the pending ready list as the scheduler is still
 					suspended. */
-					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+					if( queueEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 					{
-						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+						if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
 						{
 							/* The task waiting has a higher priority so record that a
 							context	switch is required. */
@@ -2225,9 +2358,9 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
 			{
 				/* Tasks that are removed from the event list will get added to
 				the pending ready list as the scheduler is still suspended. */
-				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+				if( queueEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 				{
-					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+					if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
 					{
 						/* The task waiting has a higher priority so record that
 						a context switch is required. */
@@ -2259,9 +2392,9 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
 
 		while( cRxLock > queueLOCKED_UNMODIFIED )
 		{
-			if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+			if( queueEVENT_LIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
 			{
-				if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+				if( queueREMOVE_FROM_EVENT_LIST( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
 				{
 					vTaskMissedYield();
 				}
@@ -2752,7 +2885,7 @@ Queue_t * const pxQueue = xQueue;
 		if( pxQueue->uxMessagesWaiting == ( UBaseType_t ) 0U )
 		{
 			/* There is nothing in the queue, block for the specified period. */
-			vTaskPlaceOnEventListRestricted( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait, xWaitIndefinitely );
+			queuePLACE_ON_EVENT_LIST_RESTRICTED( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait, xWaitIndefinitely );
 		}
 		else
 		{
@@ -2896,9 +3029,9 @@ Queue_t * const pxQueue = xQueue;
 
 			if( cTxLock == queueUNLOCKED )
 			{
-				if( listLIST_IS_EMPTY( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) == pdFALSE )
+				if( queueEVENT_LIST_IS_EMPTY( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) == pdFALSE )
 				{
-					if( xTaskRemoveFromEventList( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) != pdFALSE )
+					if( queueREMOVE_FROM_EVENT_LIST( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) != pdFALSE )
 					{
 						/* The task waiting has a higher priority. */
 						xReturn = pdTRUE;
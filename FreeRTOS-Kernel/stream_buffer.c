@@ -134,6 +134,37 @@ that uses task notifications. */
 /* Bits stored in the ucFlags field of the stream buffer. */
 #define sbFLAGS_IS_MESSAGE_BUFFER		( ( uint8_t ) 1 ) /* Set if the stream buffer was created as a message buffer, in which case it holds discrete messages rather than a stream. */
 #define sbFLAGS_IS_STATICALLY_ALLOCATED ( ( uint8_t ) 2 ) /* Set if the stream buffer was created using statically allocated memory. */
+#define sbFLAGS_IS_CHANNEL				( ( uint8_t ) 4 ) /* Set if the stream buffer is an inter-hart channel shared with the kernel instance running on another hart. */
+
+#if( configUSE_AMP == 1 )
+	/* Written last when a channel is created so the receiving hart can tell
+	the control structure has been initialised. */
+	#define sbCHANNEL_MAGIC				( ( uint32_t ) 0x43484e4cUL )
+
+	/* The task blocked on the other end of a channel belongs to the kernel
+	instance of the peer hart, so it cannot be notified directly.  Instead the
+	peer's doorbell is rung and its xStreamBufferChannelDoorbellFromISR() does
+	the notification. */
+	#define sbIS_CHANNEL( pxStreamBuffer )				( ( ( pxStreamBuffer )->ucFlags & sbFLAGS_IS_CHANNEL ) != ( uint8_t ) 0 )
+	#define sbRING_RECEIVER_DOORBELL( pxStreamBuffer )	portAMP_RING_DOORBELL( ( pxStreamBuffer )->uxReceiverHartID )
+	#define sbRING_SENDER_DOORBELL( pxStreamBuffer )	portAMP_RING_DOORBELL( ( pxStreamBuffer )->uxSenderHartID )
+
+	/* The head and tail indexes of a channel publish data to another hart, so
+	the data accesses must be ordered against them. */
+	#define sbMEMORY_FENCE()							portAMP_MEMORY_FENCE()
+
+	#if( configAMP_SHARED_MEMORY_SIZE > 0 )
+		#define sbIN_SHARED_WINDOW( pucMemory, xSize )	( ( ( portPOINTER_SIZE_TYPE ) ( pucMemory ) >= ( portPOINTER_SIZE_TYPE ) configAMP_SHARED_MEMORY_BASE ) && \
+														  ( ( ( portPOINTER_SIZE_TYPE ) ( pucMemory ) + ( xSize ) ) <= ( ( portPOINTER_SIZE_TYPE ) configAMP_SHARED_MEMORY_BASE + ( portPOINTER_SIZE_TYPE ) configAMP_SHARED_MEMORY_SIZE ) ) )
+	#else
+		#define sbIN_SHARED_WINDOW( pucMemory, xSize )	( pdTRUE )
+	#endif
+#else
+	#define sbIS_CHANNEL( pxStreamBuffer )				( pdFALSE )
+	#define sbRING_RECEIVER_DOORBELL( pxStreamBuffer )
+	#define sbRING_SENDER_DOORBELL( pxStreamBuffer )
+	#define sbMEMORY_FENCE()
+#endif /* configUSE_AMP */
 
 /*-----------------------------------------------------------*/
 
@@ -152,20 +183,39 @@ typedef struct StreamBufferDef_t /*lint !e9058 Style convention uses tag. */
 	#if ( configUSE_TRACE_FACILITY == 1 )
 		UBaseType_t uxStreamBufferNumber;		/* Used for tracing purposes. */
 	#endif
+
+	#if ( configUSE_AMP == 1 )
+		UBaseType_t uxSenderHartID;				/* Hart running the kernel instance that writes to a channel. */
+		UBaseType_t uxReceiverHartID;			/* Hart running the kernel instance that reads from a channel. */
+		volatile uint32_t ulChannelMagic;		/* Set to sbCHANNEL_MAGIC once a channel is ready to be attached. */
+	#endif
 } StreamBuffer_t;
 
+#if ( configUSE_AMP == 1 )
+	/* The channels this kernel instance is an end of.  The doorbell does not
+	say which channel rang it, so they are all checked. */
+	typedef struct ChannelEndpointDef_t
+	{
+		StreamBuffer_t *pxChannel;
+		BaseType_t xIsSender;
+	} ChannelEndpoint_t;
+
+	PRIVILEGED_DATA static ChannelEndpoint_t xChannelEndpoints[ configAMP_MAX_CHANNELS ];
+	PRIVILEGED_DATA static volatile UBaseType_t uxChannelEndpointCount = 0U;
+#endif
+
 /*
  * The number of bytes available to be read from the buffer.
  */
 static size_t prvBytesInBuffer( const StreamBuffer_t * const pxStreamBuffer ) PRIVILEGED_FUNCTION;
 
 /*
- * Add xCount bytes from pucData into the pxStreamBuffer message buffer.
- * Returns the number of bytes written, which will either equal xCount in the
- * success case, or 0 if there was not enough space in the buffer (in which case
- * no data is written into the buffer).
+ * Add xCount bytes from pucData into the pxStreamBuffer message buffer,
+ * starting at index xHead.  Returns the index following the last byte written.
+ * The head of the buffer is not updated, so the caller decides when the new
+ * bytes become visible to the reader.
  */
-static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer, const uint8_t *pucData, size_t xCount ) PRIVILEGED_FUNCTION;
+static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer, const uint8_t *pucData, size_t xCount, size_t xHead ) PRIVILEGED_FUNCTION;
 
 /*
  * If the stream buffer is being used as a message buffer, then reads an entire
@@ -194,13 +244,15 @@ static size_t prvWriteMessageToBuffer(  StreamBuffer_t * const pxStreamBuffer,
 										size_t xRequiredSpace ) PRIVILEGED_FUNCTION;
 
 /*
- * Read xMaxCount bytes from the pxStreamBuffer message buffer and write them
- * to pucData.
+ * Read xCount bytes from the pxStreamBuffer message buffer, starting at index
+ * xTail, and write them to pucData.  Returns the index following the last byte
+ * read.  The tail of the buffer is not updated, so the caller decides when the
+ * space becomes free for the writer.
  */
-static size_t prvReadBytesFromBuffer( StreamBuffer_t *pxStreamBuffer,
+static size_t prvReadBytesFromBuffer( const StreamBuffer_t * const pxStreamBuffer,
 									  uint8_t *pucData,
-									  size_t xMaxCount,
-									  size_t xBytesAvailable ) PRIVILEGED_FUNCTION;
+									  size_t xCount,
+									  size_t xTail ) PRIVILEGED_FUNCTION;
 
 /*
  * Called by both pxStreamBufferCreate() and pxStreamBufferCreateStatic() to
@@ -212,6 +264,16 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
 										  size_t xTriggerLevelBytes,
 										  uint8_t ucFlags ) PRIVILEGED_FUNCTION;
 
+#if( configUSE_AMP == 1 )
+
+	/*
+	 * Record that this kernel instance is the sending or the receiving end of
+	 * pxChannel so the doorbell handler services it.
+	 */
+	static BaseType_t prvAddChannelEndpoint( StreamBuffer_t * const pxChannel, BaseType_t xIsSender ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_AMP */
+
 /*-----------------------------------------------------------*/
 
 #if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
@@ -590,7 +652,14 @@ TimeOut_t xTimeOut;
 		/* Was a task waiting for the data? */
 		if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
 		{
-			sbSEND_COMPLETED( pxStreamBuffer );
+			if( sbIS_CHANNEL( pxStreamBuffer ) )
+			{
+				sbRING_RECEIVER_DOORBELL( pxStreamBuffer );
+			}
+			else
+			{
+				sbSEND_COMPLETED( pxStreamBuffer );
+			}
 		}
 		else
 		{
@@ -640,7 +709,14 @@ size_t xRequiredSpace = xDataLengthBytes;
 		/* Was a task waiting for the data? */
 		if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
 		{
-			sbSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+			if( sbIS_CHANNEL( pxStreamBuffer ) )
+			{
+				sbRING_RECEIVER_DOORBELL( pxStreamBuffer );
+			}
+			else
+			{
+				sbSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+			}
 		}
 		else
 		{
@@ -665,7 +741,7 @@ static size_t prvWriteMessageToBuffer( StreamBuffer_t * const pxStreamBuffer,
 									   size_t xRequiredSpace )
 {
 	BaseType_t xShouldWrite;
-	size_t xReturn;
+	size_t xReturn, xNextHead = pxStreamBuffer->xHead;
 
 	if( xSpace == ( size_t ) 0 )
 	{
@@ -688,7 +764,7 @@ static size_t prvWriteMessageToBuffer( StreamBuffer_t * const pxStreamBuffer,
 		into the buffer.  Start by writing the length of the data, the data
 		itself will be written later in this function. */
 		xShouldWrite = pdTRUE;
-		( void ) prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) &( xDataLengthBytes ), sbBYTES_TO_STORE_MESSAGE_LENGTH );
+		xNextHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) &( xDataLengthBytes ), sbBYTES_TO_STORE_MESSAGE_LENGTH, xNextHead );
 	}
 	else
 	{
@@ -699,7 +775,13 @@ static size_t prvWriteMessageToBuffer( StreamBuffer_t * const pxStreamBuffer,
 	if( xShouldWrite != pdFALSE )
 	{
 		/* Writes the data itself. */
-		xReturn = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) pvTxData, xDataLengthBytes ); /*lint !e9079 Storage buffer is implemented as uint8_t for ease of sizing, alighment and access. */
+		xNextHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) pvTxData, xDataLengthBytes, xNextHead ); /*lint !e9079 Storage buffer is implemented as uint8_t for ease of sizing, alighment and access. */
+
+		/* Only now move the head, so a reader never sees a message length
+		before the message itself. */
+		sbMEMORY_FENCE();
+		pxStreamBuffer->xHead = xNextHead;
+		xReturn = xDataLengthBytes;
 	}
 	else
 	{
@@ -797,7 +879,15 @@ size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
 		if( xReceivedLength != ( size_t ) 0 )
 		{
 			traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReceivedLength );
-			sbRECEIVE_COMPLETED( pxStreamBuffer );
+
+			if( sbIS_CHANNEL( pxStreamBuffer ) )
+			{
+				sbRING_SENDER_DOORBELL( pxStreamBuffer );
+			}
+			else
+			{
+				sbRECEIVE_COMPLETED( pxStreamBuffer );
+			}
 		}
 		else
 		{
@@ -817,7 +907,7 @@ size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
 size_t xStreamBufferNextMessageLengthBytes( StreamBufferHandle_t xStreamBuffer )
 {
 StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-size_t xReturn, xBytesAvailable, xOriginalTail;
+size_t xReturn, xBytesAvailable;
 configMESSAGE_BUFFER_LENGTH_TYPE xTempReturn;
 
 	configASSERT( pxStreamBuffer );
@@ -831,13 +921,9 @@ configMESSAGE_BUFFER_LENGTH_TYPE xTempReturn;
 			/* The number of bytes available is greater than the number of bytes
 			required to hold the length of the next message, so another message
 			is available.  Return its length without removing the length bytes
-			from the buffer.  A copy of the tail is stored so the buffer can be
-			returned to its prior state as the message is not actually being
-			removed from the buffer. */
-			xOriginalTail = pxStreamBuffer->xTail;
-			( void ) prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempReturn, sbBYTES_TO_STORE_MESSAGE_LENGTH, xBytesAvailable );
+			from the buffer - the tail is not moved. */
+			( void ) prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempReturn, sbBYTES_TO_STORE_MESSAGE_LENGTH, pxStreamBuffer->xTail );
 			xReturn = ( size_t ) xTempReturn;
-			pxStreamBuffer->xTail = xOriginalTail;
 		}
 		else
 		{
@@ -897,7 +983,14 @@ size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
 		/* Was a task waiting for space in the buffer? */
 		if( xReceivedLength != ( size_t ) 0 )
 		{
-			sbRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+			if( sbIS_CHANNEL( pxStreamBuffer ) )
+			{
+				sbRING_SENDER_DOORBELL( pxStreamBuffer );
+			}
+			else
+			{
+				sbRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+			}
 		}
 		else
 		{
@@ -921,17 +1014,20 @@ static size_t prvReadMessageFromBuffer( StreamBuffer_t *pxStreamBuffer,
 										size_t xBytesAvailable,
 										size_t xBytesToStoreMessageLength )
 {
-size_t xOriginalTail, xReceivedLength, xNextMessageLength;
+size_t xOriginalTail, xNextTail, xReceivedLength, xNextMessageLength;
 configMESSAGE_BUFFER_LENGTH_TYPE xTempNextMessageLength;
 
+	/* The reads work on a copy of the tail.  The tail itself is only moved
+	once the whole message has been read out, so the writer never sees the
+	space of a message that is being left in the buffer. */
+	xOriginalTail = pxStreamBuffer->xTail;
+	xNextTail = xOriginalTail;
+
 	if( xBytesToStoreMessageLength != ( size_t ) 0 )
 	{
 		/* A discrete message is being received.  First receive the length
-		of the message.  A copy of the tail is stored so the buffer can be
-		returned to its prior state if the length of the message is too
-		large for the provided buffer. */
-		xOriginalTail = pxStreamBuffer->xTail;
-		( void ) prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempNextMessageLength, xBytesToStoreMessageLength, xBytesAvailable );
+		of the message. */
+		xNextTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempNextMessageLength, xBytesToStoreMessageLength, xNextTail );
 		xNextMessageLength = ( size_t ) xTempNextMessageLength;
 
 		/* Reduce the number of bytes available by the number of bytes just
@@ -943,9 +1039,8 @@ configMESSAGE_BUFFER_LENGTH_TYPE xTempNextMessageLength;
 		if( xNextMessageLength > xBufferLengthBytes )
 		{
 			/* The user has provided insufficient space to read the message
-			so return the buffer to its previous state (so the length of
-			the message is in the buffer again). */
-			pxStreamBuffer->xTail = xOriginalTail;
+			so leave the message, and its length, in the buffer. */
+			xNextTail = xOriginalTail;
 			xNextMessageLength = 0;
 		}
 		else
@@ -961,7 +1056,28 @@ configMESSAGE_BUFFER_LENGTH_TYPE xTempNextMessageLength;
 	}
 
 	/* Read the actual data. */
-	xReceivedLength = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) pvRxData, xNextMessageLength, xBytesAvailable ); /*lint !e9079 Data storage area is implemented as uint8_t array for ease of sizing, indexing and alignment. */
+	xReceivedLength = configMIN( xBytesAvailable, xNextMessageLength );
+
+	if( xReceivedLength > ( size_t ) 0 )
+	{
+		xNextTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) pvRxData, xReceivedLength, xNextTail ); /*lint !e9079 Data storage area is implemented as uint8_t array for ease of sizing, indexing and alignment. */
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( xNextTail != xOriginalTail )
+	{
+		/* The data must be out of the buffer before the space is handed back
+		to the writer. */
+		sbMEMORY_FENCE();
+		pxStreamBuffer->xTail = xNextTail;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
 
 	return xReceivedLength;
 }
@@ -1085,13 +1201,181 @@ UBaseType_t uxSavedInterruptStatus;
 }
 /*-----------------------------------------------------------*/
 
-static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer, const uint8_t *pucData, size_t xCount )
+#if( configUSE_AMP == 1 )
+
+	StreamBufferHandle_t xStreamBufferChannelCreate( uint8_t * const pucChannelMemory,
+													 size_t xChannelMemorySize,
+													 BaseType_t xIsMessageBuffer,
+													 UBaseType_t uxReceiverHartID )
+	{
+	StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) pucChannelMemory; /*lint !e9087 !e740 The control structure sits at the start of the channel memory. */
+	StreamBufferHandle_t xReturn;
+	uint8_t ucFlags;
+
+		configASSERT( pucChannelMemory );
+		configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pucChannelMemory ) & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL );
+		configASSERT( xChannelMemorySize > ( sizeof( StreamBuffer_t ) + sbBYTES_TO_STORE_MESSAGE_LENGTH ) );
+		configASSERT( sbIN_SHARED_WINDOW( pucChannelMemory, xChannelMemorySize ) );
+		configASSERT( uxReceiverHartID != portGET_HART_ID() );
+
+		if( xIsMessageBuffer != pdFALSE )
+		{
+			ucFlags = sbFLAGS_IS_CHANNEL | sbFLAGS_IS_MESSAGE_BUFFER | sbFLAGS_IS_STATICALLY_ALLOCATED;
+		}
+		else
+		{
+			ucFlags = sbFLAGS_IS_CHANNEL | sbFLAGS_IS_STATICALLY_ALLOCATED;
+		}
+
+		/* The control structure is followed by the data storage area, both in
+		the shared window so both kernel instances see the same indexes. */
+		prvInitialiseNewStreamBuffer( pxStreamBuffer,
+									  &( pucChannelMemory[ sizeof( StreamBuffer_t ) ] ),
+									  xChannelMemorySize - sizeof( StreamBuffer_t ),
+									  ( size_t ) 1,
+									  ucFlags );
+
+		pxStreamBuffer->uxSenderHartID = portGET_HART_ID();
+		pxStreamBuffer->uxReceiverHartID = uxReceiverHartID;
+
+		if( prvAddChannelEndpoint( pxStreamBuffer, pdTRUE ) != pdFALSE )
+		{
+			/* Publish the channel to the receiving hart last. */
+			sbMEMORY_FENCE();
+			pxStreamBuffer->ulChannelMagic = sbCHANNEL_MAGIC;
+
+			traceSTREAM_BUFFER_CREATE( pxStreamBuffer, xIsMessageBuffer );
+			xReturn = pxStreamBuffer;
+		}
+		else
+		{
+			traceSTREAM_BUFFER_CREATE_STATIC_FAILED( pxStreamBuffer, xIsMessageBuffer );
+			xReturn = NULL;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_AMP */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_AMP == 1 )
+
+	StreamBufferHandle_t xStreamBufferChannelAttach( uint8_t * const pucChannelMemory )
+	{
+	StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) pucChannelMemory; /*lint !e9087 !e740 The control structure sits at the start of the channel memory. */
+	StreamBufferHandle_t xReturn = NULL;
+
+		configASSERT( pucChannelMemory );
+
+		if( pxStreamBuffer->ulChannelMagic == sbCHANNEL_MAGIC )
+		{
+			/* Don't read the rest of the control structure before the magic
+			value that says it is valid. */
+			sbMEMORY_FENCE();
+
+			configASSERT( sbIS_CHANNEL( pxStreamBuffer ) );
+			configASSERT( pxStreamBuffer->uxReceiverHartID == portGET_HART_ID() );
+
+			if( prvAddChannelEndpoint( pxStreamBuffer, pdFALSE ) != pdFALSE )
+			{
+				xReturn = pxStreamBuffer;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			/* The sending hart has not created the channel yet. */
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_AMP */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_AMP == 1 )
+
+	BaseType_t xStreamBufferChannelDoorbellFromISR( void )
+	{
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+	StreamBuffer_t *pxChannel;
+	UBaseType_t uxEndpoint;
+
+		/* The peer fenced before ringing, match it before looking at the
+		indexes. */
+		sbMEMORY_FENCE();
+
+		for( uxEndpoint = 0U; uxEndpoint < uxChannelEndpointCount; uxEndpoint++ )
+		{
+			pxChannel = xChannelEndpoints[ uxEndpoint ].pxChannel;
+
+			if( xChannelEndpoints[ uxEndpoint ].xIsSender != pdFALSE )
+			{
+				/* The peer read from the channel, a sender waiting for space
+				rechecks it so a spurious wake is harmless. */
+				( void ) xStreamBufferReceiveCompletedFromISR( pxChannel, &xHigherPriorityTaskWoken );
+			}
+			else if( prvBytesInBuffer( pxChannel ) >= pxChannel->xTriggerLevelBytes )
+			{
+				/* A receiver is only woken when there is something to read,
+				as it does not wait again if it finds the channel empty. */
+				( void ) xStreamBufferSendCompletedFromISR( pxChannel, &xHigherPriorityTaskWoken );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		return xHigherPriorityTaskWoken;
+	}
+
+#endif /* configUSE_AMP */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_AMP == 1 )
+
+	static BaseType_t prvAddChannelEndpoint( StreamBuffer_t * const pxChannel, BaseType_t xIsSender )
+	{
+	BaseType_t xReturn;
+
+		taskENTER_CRITICAL();
+		{
+			if( uxChannelEndpointCount < ( UBaseType_t ) configAMP_MAX_CHANNELS )
+			{
+				xChannelEndpoints[ uxChannelEndpointCount ].pxChannel = pxChannel;
+				xChannelEndpoints[ uxChannelEndpointCount ].xIsSender = xIsSender;
+				uxChannelEndpointCount++;
+				xReturn = pdPASS;
+			}
+			else
+			{
+				/* Increase configAMP_MAX_CHANNELS. */
+				xReturn = pdFAIL;
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_AMP */
+/*-----------------------------------------------------------*/
+
+static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer, const uint8_t *pucData, size_t xCount, size_t xHead )
 {
-size_t xNextHead, xFirstLength;
+size_t xNextHead = xHead, xFirstLength;
 
 	configASSERT( xCount > ( size_t ) 0 );
 
-	xNextHead = pxStreamBuffer->xHead;
+	/* The space being written to was freed by the reader, don't let the
+	writes overtake the read of the tail that freed it. */
+	sbMEMORY_FENCE();
 
 	/* Calculate the number of bytes that can be added in the first write -
 	which may be less than the total number of bytes that need to be added if
@@ -1125,64 +1409,55 @@ size_t xNextHead, xFirstLength;
 		mtCOVERAGE_TEST_MARKER();
 	}
 
-	pxStreamBuffer->xHead = xNextHead;
-
-	return xCount;
+	return xNextHead;
 }
 /*-----------------------------------------------------------*/
 
-static size_t prvReadBytesFromBuffer( StreamBuffer_t *pxStreamBuffer, uint8_t *pucData, size_t xMaxCount, size_t xBytesAvailable )
+static size_t prvReadBytesFromBuffer( const StreamBuffer_t * const pxStreamBuffer, uint8_t *pucData, size_t xCount, size_t xTail )
 {
-size_t xCount, xFirstLength, xNextTail;
+size_t xNextTail = xTail, xFirstLength;
 
-	/* Use the minimum of the wanted bytes and the available bytes. */
-	xCount = configMIN( xBytesAvailable, xMaxCount );
-
-	if( xCount > ( size_t ) 0 )
-	{
-		xNextTail = pxStreamBuffer->xTail;
+	configASSERT( xCount > ( size_t ) 0 );
 
-		/* Calculate the number of bytes that can be read - which may be
-		less than the number wanted if the data wraps around to the start of
-		the buffer. */
-		xFirstLength = configMIN( pxStreamBuffer->xLength - xNextTail, xCount );
+	/* Don't read the data before the head that published it. */
+	sbMEMORY_FENCE();
 
-		/* Obtain the number of bytes it is possible to obtain in the first
-		read.  Asserts check bounds of read and write. */
-		configASSERT( xFirstLength <= xMaxCount );
-		configASSERT( ( xNextTail + xFirstLength ) <= pxStreamBuffer->xLength );
-		( void ) memcpy( ( void * ) pucData, ( const void * ) &( pxStreamBuffer->pucBuffer[ xNextTail ] ), xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+	/* Calculate the number of bytes that can be read - which may be less than
+	the number wanted if the data wraps around to the start of the buffer. */
+	xFirstLength = configMIN( pxStreamBuffer->xLength - xNextTail, xCount );
 
-		/* If the total number of wanted bytes is greater than the number
-		that could be read in the first read... */
-		if( xCount > xFirstLength )
-		{
-			/*...then read the remaining bytes from the start of the buffer. */
-			configASSERT( xCount <= xMaxCount );
-			( void ) memcpy( ( void * ) &( pucData[ xFirstLength ] ), ( void * ) ( pxStreamBuffer->pucBuffer ), xCount - xFirstLength ); /*lint !e9087 memcpy() requires void *. */
-		}
-		else
-		{
-			mtCOVERAGE_TEST_MARKER();
-		}
+	/* Obtain the number of bytes it is possible to obtain in the first read.
+	Asserts check bounds of read and write. */
+	configASSERT( ( xNextTail + xFirstLength ) <= pxStreamBuffer->xLength );
+	( void ) memcpy( ( void * ) pucData, ( const void * ) &( pxStreamBuffer->pucBuffer[ xNextTail ] ), xFirstLength ); /*lint !e9087 memcpy() requires void *. */
 
-		/* Move the tail pointer to effectively remove the data read from
-		the buffer. */
-		xNextTail += xCount;
+	/* If the total number of wanted bytes is greater than the number that
+	could be read in the first read... */
+	if( xCount > xFirstLength )
+	{
+		/*...then read the remaining bytes from the start of the buffer. */
+		configASSERT( ( xCount - xFirstLength ) <= pxStreamBuffer->xLength );
+		( void ) memcpy( ( void * ) &( pucData[ xFirstLength ] ), ( void * ) ( pxStreamBuffer->pucBuffer ), xCount - xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
 
-		if( xNextTail >= pxStreamBuffer->xLength )
-		{
-			xNextTail -= pxStreamBuffer->xLength;
-		}
+	/* The index following the data read, which is where the tail moves to
+	once the caller has finished with the data. */
+	xNextTail += xCount;
 
-		pxStreamBuffer->xTail = xNextTail;
+	if( xNextTail >= pxStreamBuffer->xLength )
+	{
+		xNextTail -= pxStreamBuffer->xLength;
 	}
 	else
 	{
 		mtCOVERAGE_TEST_MARKER();
 	}
 
-	return xCount;
+	return xNextTail;
 }
 /*-----------------------------------------------------------*/
 
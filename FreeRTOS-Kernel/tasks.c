@@ -64,21 +64,71 @@ functions but without including stdio.h here. */
 	#define taskYIELD_IF_USING_PREEMPTION() portYIELD_WITHIN_API()
 #endif
 
+#if ( configNUM_CORES > 1 )
+	/* Value held in the xTaskRunState member of a TCB when the task is not
+	running on any core. */
+	#define taskTASK_NOT_RUNNING			( ( BaseType_t ) -1 )
+
+	/* With more than one core a task can be running without being the task
+	the calling core is running, and a task that is readied may have to preempt
+	a core other than the calling one.  prvYieldForTask() interrupts the other
+	core itself and only returns pdTRUE if the calling core should yield. */
+	#define taskTASK_IS_RUNNING( pxTCB )	( ( pxTCB )->xTaskRunState != taskTASK_NOT_RUNNING )
+	#define taskTASK_PREEMPTS_CURRENT( pxTCB )				prvYieldForTask( pxTCB )
+	#define taskTASK_PREEMPTS_CURRENT_OR_EQUALS( pxTCB )	prvYieldForTask( pxTCB )
+
+	#if ( configUSE_CORE_AFFINITY == 1 )
+		#define taskCORE_IS_ALLOWED( pxTCB, xCoreID )	( ( ( pxTCB )->uxCoreAffinityMask & ( ( UBaseType_t ) 1U << ( UBaseType_t ) ( xCoreID ) ) ) != 0U )
+	#else
+		#define taskCORE_IS_ALLOWED( pxTCB, xCoreID )	( pdTRUE )
+	#endif
+#else
+	#define taskTASK_IS_RUNNING( pxTCB )	( ( pxTCB ) == pxCurrentTCB )
+	#if ( configUSE_EDF_SCHEDULING == 1 )
+		/* Within the EDF band a task of the same priority still preempts when
+		it should run first. */
+		#define taskTASK_PREEMPTS_CURRENT( pxTCB )			( ( ( pxTCB )->uxPriority > pxCurrentTCB->uxPriority ) || ( prvEDFTaskIsEarlier( ( pxTCB ), pxCurrentTCB ) != pdFALSE ) )
+	#else
+		#define taskTASK_PREEMPTS_CURRENT( pxTCB )			( ( pxTCB )->uxPriority > pxCurrentTCB->uxPriority )
+	#endif
+	#define taskTASK_PREEMPTS_CURRENT_OR_EQUALS( pxTCB )	( ( pxTCB )->uxPriority >= pxCurrentTCB->uxPriority )
+#endif
+
 /* Values that can be assigned to the ucNotifyState member of the TCB. */
 #define taskNOT_WAITING_NOTIFICATION	( ( uint8_t ) 0 )
 #define taskWAITING_NOTIFICATION		( ( uint8_t ) 1 )
 #define taskNOTIFICATION_RECEIVED		( ( uint8_t ) 2 )
 
+/* Values that can be assigned to the ucRendezvousState member of the TCB. */
+#define taskRENDEZVOUS_IDLE					( ( uint8_t ) 0 )
+#define taskRENDEZVOUS_WAITING_FOR_CALL		( ( uint8_t ) 1 )
+#define taskRENDEZVOUS_CALL_RECEIVED		( ( uint8_t ) 2 )
+#define taskRENDEZVOUS_WAITING_TO_SEND		( ( uint8_t ) 3 )
+#define taskRENDEZVOUS_WAITING_FOR_REPLY	( ( uint8_t ) 4 )
+#define taskRENDEZVOUS_REPLY_RECEIVED		( ( uint8_t ) 5 )
+
 /*
  * The value used to fill the stack of a task when the task is created.  This
  * is used purely for checking the high water mark for tasks.
  */
 #define tskSTACK_FILL_BYTE	( 0xa5U )
 
+/* A stack word that has every byte set to tskSTACK_FILL_BYTE, used to scan the
+stack a word at a time. */
+#define tskSTACK_FILL_WORD	( ( ( StackType_t ) ~( StackType_t ) 0 / ( StackType_t ) 0xffU ) * ( StackType_t ) tskSTACK_FILL_BYTE )
+
 /* Bits used to recored how a task's stack and TCB were allocated. */
 #define tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB 		( ( uint8_t ) 0 )
 #define tskSTATICALLY_ALLOCATED_STACK_ONLY 			( ( uint8_t ) 1 )
 #define tskSTATICALLY_ALLOCATED_STACK_AND_TCB		( ( uint8_t ) 2 )
+#define tskPOOL_ALLOCATED_STACK_AND_TCB				( ( uint8_t ) 3 )
+#define tskBASIC_TASK_SHARED_STACK					( ( uint8_t ) 4 )
+
+#if( configUSE_BASIC_TASKS == 1 )
+	#define taskIS_BASIC_TASK( pxTCB )	( ( pxTCB )->ucStaticallyAllocated == tskBASIC_TASK_SHARED_STACK )
+#else
+	#define taskIS_BASIC_TASK( pxTCB )	pdFALSE
+#endif
 
 /* If any of the following are set then task stacks are filled with a known
 value so the high water mark can be determined.  If none of the following are
@@ -193,6 +243,28 @@ configIDLE_TASK_NAME in FreeRTOSConfig.h. */
 
 /*-----------------------------------------------------------*/
 
+#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+	/* Delayed tasks are hashed on their wake time into the slots of a timing
+	wheel.  A slot holds every task waking at the same tick modulo the wheel
+	size, unsorted, so blocking is O(1) whatever the number of delayed tasks. */
+	#define taskDELAYED_WHEEL_SLOT( xTime )		( ( UBaseType_t ) ( ( xTime ) & ( TickType_t ) ( configDELAYED_TASK_WHEEL_SIZE - 1 ) ) )
+
+	#define taskLIST_IS_DELAYED_WHEEL_SLOT( pxList )	( ( ( pxList ) >= &( xDelayedTaskWheel[ 0 ] ) ) && ( ( pxList ) <= &( xDelayedTaskWheel[ configDELAYED_TASK_WHEEL_SIZE - 1 ] ) ) )
+
+	/* The wheel holds tasks whose wake time has overflowed alongside the
+	others, so there is nothing to switch.  The slot of tick 0 has not been
+	looked at yet when the tick count wraps. */
+	#define taskSWITCH_DELAYED_LISTS()															\
+	{																							\
+		xNumOfOverflows++;																		\
+		xNextTaskUnblockTime = prvGetNextDelayedWheelTime( xTickCount );						\
+	}
+
+	#define taskINSERT_DELAYED_TASK( pxDelayedList, pxTCB )	prvAddTaskToDelayedWheel( pxTCB )
+
+#else /* configUSE_DELAYED_TASK_WHEEL */
+
 /* pxDelayedTaskList and pxOverflowDelayedTaskList are switched when the tick
 count overflows. */
 #define taskSWITCH_DELAYED_LISTS()																	\
@@ -209,17 +281,133 @@ count overflows. */
 	prvResetNextTaskUnblockTime();																	\
 }
 
+	#define taskINSERT_DELAYED_TASK( pxDelayedList, pxTCB )	vListInsert( ( pxDelayedList ), &( ( pxTCB )->xStateListItem ) )
+
+#endif /* configUSE_DELAYED_TASK_WHEEL */
+
+/*-----------------------------------------------------------*/
+
+/* Used by xTaskIncrementTick() to decide whether the running task has had its
+share of processor time, once it is known that an equal priority task is ready
+to run. */
+#if( configUSE_TIME_SLICE_QUANTA == 1 )
+	#define taskTIME_SLICE_EXPIRED( pxTCB )	prvTimeSliceExpired( pxTCB )
+#else
+	#define taskTIME_SLICE_EXPIRED( pxTCB )	( pdTRUE )
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TASK_BUDGETS == 1 )
+
+	/* Value of uxBudgetPriority while a task is running at its own priority. */
+	#define taskBUDGET_NOT_DEMOTED		( ( UBaseType_t ) configMAX_PRIORITIES )
+
+	#if( configUSE_MUTEXES == 1 )
+		#define taskBUDGET_BASE_PRIORITY( pxTCB )	( ( pxTCB )->uxBasePriority )
+	#else
+		#define taskBUDGET_BASE_PRIORITY( pxTCB )	( ( pxTCB )->uxPriority )
+	#endif
+
+	/* The replenishment time of a task is kept within one period of the tick
+	count, so it has passed when it is not in the period that follows the
+	current tick.  This also holds once the tick count has wrapped. */
+	#define taskBUDGET_PERIOD_ENDED( pxTCB, xTime )	( ( TickType_t ) ( ( pxTCB )->xBudgetReplenishTime - ( xTime ) - ( TickType_t ) 1U ) >= ( pxTCB )->xBudgetPeriod )
+
+	#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+		#define taskBUDGET_GET_RUN_TIME_COUNTER( ulValue )	portALT_GET_RUN_TIME_COUNTER_VALUE( ( ulValue ) )
+	#else
+		#define taskBUDGET_GET_RUN_TIME_COUNTER( ulValue )	( ulValue ) = portGET_RUN_TIME_COUNTER_VALUE()
+	#endif
+
+#endif /* configUSE_TASK_BUDGETS */
+
+/*-----------------------------------------------------------*/
+
+#if( configUSE_EDF_SCHEDULING == 1 )
+
+	/* EDF tasks are told apart by a non zero relative deadline. */
+	#define taskIS_EDF_TASK( pxTCB )	( ( pxTCB )->xEDFRelativeDeadline != ( TickType_t ) 0U )
+
+	/* Value of uxEDFHeapIndex while a task is not referenced from the deadline
+	heap. */
+	#define taskEDF_NOT_IN_HEAP		( ( UBaseType_t ) configEDF_MAX_TASKS )
+
+	#if( configUSE_64_BIT_TICK_COUNT == 1 )
+		#define taskEDF_TIME_IS_BEFORE( xTime, xOtherTime )	( ( xTime ) < ( xOtherTime ) )
+	#else
+		/* Release times and deadlines wrap with the tick count, so they are
+		compared over half its range. */
+		#define taskEDF_TIME_IS_BEFORE( xTime, xOtherTime )	( ( TickType_t ) ( ( xOtherTime ) - ( xTime ) - ( TickType_t ) 1U ) < ( portMAX_DELAY >> 1 ) )
+	#endif
+
+	/* A ready EDF task in the EDF band is referenced from the deadline heap as
+	well as from its ready list. */
+	#define taskEDF_ADD_TO_HEAP( pxTCB )																\
+	{																									\
+		if( ( ( pxTCB )->uxPriority == ( UBaseType_t ) configEDF_PRIORITY ) && taskIS_EDF_TASK( pxTCB ) )	\
+		{																								\
+			prvEDFHeapInsert( pxTCB );																	\
+		}																								\
+	}
+
+#else /* configUSE_EDF_SCHEDULING */
+
+	#define taskEDF_ADD_TO_HEAP( pxTCB )
+
+#endif /* configUSE_EDF_SCHEDULING */
+
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TASK_SNAPSHOTS == 1 )
+	/* Stamp pxTCB with a new state generation so uxTaskGetSnapshot() can tell
+	it has changed.  Called with the task lists locked. */
+	#define taskRECORD_STATE_CHANGE( pxTCB )	( ( pxTCB )->ulStateGeneration = ++ulTaskStateGeneration )
+#else
+	#define taskRECORD_STATE_CHANGE( pxTCB )
+#endif
+/*-----------------------------------------------------------*/
+
+#if( configUSE_WAKEUP_LATENCY_STATS == 1 )
+	/* Time stamp pxTCB leaving the Blocked or Suspended state.  Tasks that are
+	only moved between ready lists because their priority changed are not
+	stamped - see prvMoveTaskBetweenReadyLists().  A task can still be readied
+	twice before it runs, for example when it is moved from the pending ready
+	list, so only the first call after the task last ran counts. */
+	#define taskRECORD_WAKE_TIME( pxTCB )											\
+	{																				\
+		if( ( ( pxTCB )->ucLatencyPending == pdFALSE ) && ( ( pxTCB ) != pxCurrentTCB ) ) \
+		{																			\
+			( pxTCB )->ulWakeTime = portGET_CYCLE_COUNT();							\
+			( pxTCB )->ucLatencyPending = pdTRUE;									\
+		}																			\
+	}
+#else
+	#define taskRECORD_WAKE_TIME( pxTCB )
+#endif
 /*-----------------------------------------------------------*/
 
 /*
- * Place the task represented by pxTCB into the appropriate ready list for
- * the task.  It is inserted at the end of the list.
+ * Place the task represented by pxTCB, which has just been removed from the
+ * ready list of its old priority, into the ready list of its new priority.  It
+ * is inserted at the end of the list.  The task was already Ready, so this does
+ * not count as it being woken.
  */
-#define prvAddTaskToReadyList( pxTCB )																\
+#define prvMoveTaskBetweenReadyLists( pxTCB )														\
 	traceMOVED_TASK_TO_READY_STATE( pxTCB );														\
 	taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );												\
 	vListInsertEnd( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
+	taskEDF_ADD_TO_HEAP( pxTCB );																	\
+	taskRECORD_STATE_CHANGE( pxTCB );																\
 	tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
+
+/*
+ * Place the task represented by pxTCB into the appropriate ready list for
+ * the task.  It is inserted at the end of the list.
+ */
+#define prvAddTaskToReadyList( pxTCB )																\
+	taskRECORD_WAKE_TIME( pxTCB );																	\
+	prvMoveTaskBetweenReadyLists( pxTCB )
 /*-----------------------------------------------------------*/
 
 /*
@@ -259,33 +447,42 @@ typedef struct tskTaskControlBlock 			/* The old naming convention is used to pr
 
 	ListItem_t			xStateListItem;	/*< The list that the state list item of a task is reference from denotes the state of that task (Ready, Blocked, Suspended ). */
 	ListItem_t			xEventListItem;		/*< Used to reference a task from an event list. */
-	UBaseType_t			uxPriority;			/*< The priority of the task.  0 is the lowest priority. */
+	tskTCB_PRIORITY_TYPE	uxPriority;		/*< The priority of the task.  0 is the lowest priority. */
+	#if ( configNUM_CORES > 1 )
+		volatile BaseType_t	xTaskRunState;	/*< The core the task is running on, or taskTASK_NOT_RUNNING. */
+		#if ( configUSE_CORE_AFFINITY == 1 )
+			UBaseType_t	uxCoreAffinityMask;	/*< Bit N set means the task may run on core N. */
+		#endif
+	#endif
 	StackType_t			*pxStack;			/*< Points to the start of the stack. */
-	char				pcTaskName[ configMAX_TASK_NAME_LEN ];/*< Descriptive name given to the task when created.  Facilitates debugging only. */ /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+	#if( configUSE_COMPACT_TCB == 0 )
+		char			pcTaskName[ configMAX_TASK_NAME_LEN ];/*< Descriptive name given to the task when created.  Facilitates debugging only. */ /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	#endif
 
 	#if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
 		StackType_t		*pxEndOfStack;		/*< Points to the highest valid address for the stack. */
 	#endif
 
 	#if ( portCRITICAL_NESTING_IN_TCB == 1 )
-		UBaseType_t		uxCriticalNesting;	/*< Holds the critical section nesting depth for ports that do not maintain their own count in the port layer. */
+		tskTCB_NESTING_TYPE	uxCriticalNesting;	/*< Holds the critical section nesting depth for ports that do not maintain their own count in the port layer. */
 	#endif
 
-	#if ( configUSE_TRACE_FACILITY == 1 )
+	#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_COMPACT_TCB == 0 ) )
 		UBaseType_t		uxTCBNumber;		/*< Stores a number that increments each time a TCB is created.  It allows debuggers to determine when a task has been deleted and then recreated. */
 		UBaseType_t		uxTaskNumber;		/*< Stores a number specifically for use by third party trace code. */
 	#endif
 
 	#if ( configUSE_MUTEXES == 1 )
-		UBaseType_t		uxBasePriority;		/*< The priority last assigned to the task - used by the priority inheritance mechanism. */
-		UBaseType_t		uxMutexesHeld;
+		tskTCB_PRIORITY_TYPE	uxBasePriority;	/*< The priority last assigned to the task - used by the priority inheritance mechanism. */
+		tskTCB_NESTING_TYPE	uxMutexesHeld;
 	#endif
 
-	#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+	#if ( ( configUSE_APPLICATION_TASK_TAG == 1 ) && ( configUSE_COMPACT_TCB == 0 ) )
 		TaskHookFunction_t pxTaskTag;
 	#endif
 
-	#if( configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0 )
+	#if( ( configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0 ) && ( configUSE_COMPACT_TCB == 0 ) )
 		void			*pvThreadLocalStoragePointers[ configNUM_THREAD_LOCAL_STORAGE_POINTERS ];
 	#endif
 
@@ -293,7 +490,7 @@ typedef struct tskTaskControlBlock 			/* The old naming convention is used to pr
 		uint32_t		ulRunTimeCounter;	/*< Stores the amount of time the task has spent in the Running state. */
 	#endif
 
-	#if ( configUSE_NEWLIB_REENTRANT == 1 )
+	#if ( ( configUSE_NEWLIB_REENTRANT == 1 ) && ( configUSE_COMPACT_TCB == 0 ) )
 		/* Allocate a Newlib reent structure that is specific to this task.
 		Note Newlib support has been included by popular demand, but is not
 		used by the FreeRTOS maintainers themselves.  FreeRTOS is not
@@ -303,13 +500,13 @@ typedef struct tskTaskControlBlock 			/* The old naming convention is used to pr
 		implements a system-wide malloc() that must be provided with locks. */
 		struct	_reent xNewLib_reent;
 	#endif
-	#if ( configUSE_PICOLIBC_TLS == 1 && configTLS_STATIC_SIZE > 0 )
+	#if ( configUSE_PICOLIBC_TLS == 1 && portTLS_IN_TASK_CONTEXT == 0 && configTLS_STATIC_SIZE > 0 && configUSE_COMPACT_TCB == 0 )
 		uint8_t ucTls[configTLS_STATIC_SIZE];
 	#endif
 
 	#if( configUSE_TASK_NOTIFICATIONS == 1 )
-		volatile uint32_t ulNotifiedValue;
-		volatile uint8_t ucNotifyState;
+		volatile uint32_t ulNotifiedValue[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
+		volatile uint8_t ucNotifyState[ configTASK_NOTIFICATION_ARRAY_ENTRIES ];
 	#endif
 
 	/* See the comments in FreeRTOS.h with the definition of
@@ -326,9 +523,113 @@ typedef struct tskTaskControlBlock 			/* The old naming convention is used to pr
 		int iTaskErrno;
 	#endif
 
+	#if( configUSE_EDF_SCHEDULING == 1 )
+		TickType_t		xEDFRelativeDeadline;	/*< Deadline of each job relative to its release.  Zero for tasks outside the EDF class. */
+		TickType_t		xEDFPeriod;				/*< Time between the releases of two jobs. */
+		TickCount_t		xEDFRelease;			/*< Release time of the current job. */
+		TickCount_t		xEDFDeadline;			/*< Absolute deadline of the current job, the key of the deadline heap. */
+		UBaseType_t		uxEDFHeapIndex;			/*< Position in the deadline heap, or taskEDF_NOT_IN_HEAP. */
+	#endif
+
+	#if( configUSE_TIME_SLICE_QUANTA == 1 )
+		UBaseType_t		uxTimeSliceQuantum;		/*< Number of ticks the task runs before an equal priority task is selected. */
+		UBaseType_t		uxTimeSliceRemaining;	/*< Ticks left in the current time slice. */
+	#endif
+
+	#if( configUSE_TASK_BUDGETS == 1 )
+		ListItem_t		xBudgetListItem;		/*< Used to reference the task from xBudgetExhaustedTaskList. */
+		uint32_t		ulBudget;				/*< Run time the task may use in each replenishment period, in run time counter units.  Zero for tasks without a budget. */
+		uint32_t		ulBudgetUsed;			/*< Run time used in the current replenishment period. */
+		TickType_t		xBudgetPeriod;			/*< Length of the replenishment period in ticks. */
+		TickType_t		xBudgetReplenishTime;	/*< Tick at which the current replenishment period ends. */
+		UBaseType_t		uxBudgetPriority;		/*< Priority to return to once the budget is replenished, or taskBUDGET_NOT_DEMOTED. */
+	#endif
+
+	#if( configUSE_TASK_NAME_INDEX == 1 )
+		struct tskTaskControlBlock *pxNextInNameIndex;	/*< Next task whose name hashes to the same bucket of pxTaskNameIndex[]. */
+	#endif
+
+	#if( configUSE_TASK_POOLS == 1 )
+		struct tskTaskPool *pxTaskPool;			/*< The pool the TCB and stack were taken from.  Only valid if ucStaticallyAllocated is tskPOOL_ALLOCATED_STACK_AND_TCB. */
+	#endif
+
+	#if( configUSE_INCREMENTAL_STACK_HIGH_WATER_MARK == 1 )
+		StackType_t *pxStackHighWaterMark;		/*< The deepest stack word the task is known to have used. */
+	#endif
+
+	#if( configUSE_TASK_SNAPSHOTS == 1 )
+		ListItem_t		xAllTasksListItem;		/*< Used to reference the task from xAllTasksList. */
+		uint32_t		ulStateGeneration;		/*< Value of ulTaskStateGeneration when the state or priority of the task last changed. */
+	#endif
+
+	#if( configUSE_WAKEUP_LATENCY_STATS == 1 )
+		uint32_t		ulWakeups;				/*< Number of latencies recorded. */
+		uint32_t		ulMaxLatency;			/*< Longest latency recorded, in cycles. */
+		uint32_t		ulTotalLatency;			/*< Sum of the latencies recorded, in cycles. */
+		uint32_t		ulLatencyHistogram[ configLATENCY_HISTOGRAM_BUCKETS ];	/*< Latencies recorded, by log2 of the latency. */
+		uint32_t		ulWakeTime;				/*< Cycle count at which the task was made ready.  Only valid if ucLatencyPending is pdTRUE. */
+		uint8_t			ucLatencyPending;		/*< Set to pdTRUE when the task is made ready, and back to pdFALSE when it next runs. */
+	#endif
+
+	#if( configUSE_PERIODIC_TASKS == 1 )
+		TickType_t		xPeriod;				/*< Time between job releases, or 0 if the task is not periodic. */
+		TickType_t		xRelativeDeadline;		/*< Time after its release by which a job must complete. */
+		TickType_t		xReleaseTime;			/*< Release time of the current job. */
+		TickType_t		xLastResponseTime;		/*< Time from release to completion of the last job. */
+		TickType_t		xMaxResponseTime;		/*< Longest time from release to completion of a job. */
+		TickType_t		xMaxReleaseJitter;		/*< Longest time from release of a job to the task starting it. */
+		uint32_t		ulJobs;					/*< Number of jobs completed. */
+		uint32_t		ulOverruns;				/*< Number of jobs completed after their deadline. */
+	#endif
+
+	#if( configUSE_BASIC_TASKS == 1 )
+		TaskFunction_t	pxBasicTaskCode;		/*< Function called each time a basic task is activated.  Only valid if ucStaticallyAllocated is tskBASIC_TASK_SHARED_STACK. */
+		void			*pvBasicTaskParameters;	/*< Parameter passed to pxBasicTaskCode. */
+		UBaseType_t		uxSharedStack;			/*< Index into pxSharedStacks[] of the stack the basic task runs on. */
+	#endif
+
+	#if( configUSE_TASK_RENDEZVOUS == 1 )
+		List_t			xRendezvousCallers;		/*< Tasks waiting for this task to receive their call, in priority order. */
+		List_t			xRendezvousServed;		/*< Tasks whose call this task has received but not yet replied to. */
+		struct tskTaskControlBlock *pxRendezvousPartner;	/*< The receiver of the call being made, or the caller of the call being received. */
+		const void		*pvRendezvousMessage;	/*< Request of a task waiting to send a call. */
+		void			*pvRendezvousBuffer;	/*< Buffer a call is received into, or a reply is copied into. */
+		size_t			xRendezvousBufferSize;	/*< Size of pvRendezvousBuffer in bytes. */
+		size_t			xRendezvousLength;		/*< Length of the request being sent, or of the call or reply received. */
+		uint8_t			ucRendezvousState;		/*< One of the taskRENDEZVOUS_ values. */
+	#endif
+
+	#if( configUSE_COMPACT_TCB == 1 )
+		/* Members that neither the context switch nor the tick touch are
+		placed last, so the ones that are share as few cache lines as
+		possible. */
+		char			pcTaskName[ configMAX_TASK_NAME_LEN ];/*< Descriptive name given to the task when created.  Facilitates debugging only. */ /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+		#if ( configUSE_TRACE_FACILITY == 1 )
+			UBaseType_t	uxTCBNumber;		/*< Stores a number that increments each time a TCB is created.  It allows debuggers to determine when a task has been deleted and then recreated. */
+			UBaseType_t	uxTaskNumber;		/*< Stores a number specifically for use by third party trace code. */
+		#endif
+
+		#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+			TaskHookFunction_t pxTaskTag;
+		#endif
+
+		#if( configNUM_THREAD_LOCAL_STORAGE_POINTERS > 0 )
+			void		*pvThreadLocalStoragePointers[ configNUM_THREAD_LOCAL_STORAGE_POINTERS ];
+		#endif
+
+		#if ( configUSE_NEWLIB_REENTRANT == 1 )
+			struct	_reent xNewLib_reent;
+		#endif
+
+		#if ( configUSE_PICOLIBC_TLS == 1 && portTLS_IN_TASK_CONTEXT == 0 && configTLS_STATIC_SIZE > 0 )
+			uint8_t ucTls[configTLS_STATIC_SIZE];
+		#endif
+	#endif /* configUSE_COMPACT_TCB */
+
 } tskTCB;
 
-#if ( configUSE_PICOLIBC_TLS == 1 )
+#if ( configUSE_PICOLIBC_TLS == 1 && portTLS_IN_TASK_CONTEXT == 0 )
 extern uint8_t __tls_size[];
 
 /* Place symbols in the output file reporting the allocated TLS area
@@ -347,19 +648,99 @@ __asm(".global __tls_size\n");
 below to enable the use of older kernel aware debuggers. */
 typedef tskTCB TCB_t;
 
+#if( configUSE_TASK_POOLS == 1 )
+
+	/* A block of TCB and stack pairs that all have the same stack depth.  The
+	free pairs are kept as a stack of TCB pointers so taking and returning a
+	pair is O(1).  The TCB pointers and the pairs follow this structure in the
+	same allocation. */
+	typedef struct tskTaskPool
+	{
+		struct tskTaskPool *pxNext;				/*< Next pool in order of increasing stack depth. */
+		configSTACK_DEPTH_TYPE usStackDepth;	/*< Depth of every stack in the pool, in words. */
+		UBaseType_t uxFreeTCBs;					/*< Number of entries of ppxFreeTCBs that are in use. */
+		TCB_t **ppxFreeTCBs;
+	} TaskPool_t;
+
+	/* Size of a part of a pool allocation rounded up so the part that follows
+	it is aligned. */
+	#define taskPOOL_ALIGNED_SIZE( xSize )	( ( ( size_t ) ( xSize ) + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+#endif /* configUSE_TASK_POOLS */
+
 /*lint -save -e956 A manual analysis and inspection has been used to determine
 which static variables must be declared volatile. */
-PRIVILEGED_DATA TCB_t * volatile pxCurrentTCB = NULL;
+#if ( configNUM_CORES > 1 )
+	/* pxCurrentTCBs[ x ] is the task running on core x.  Reading the entry for
+	the calling core is only safe while the calling task cannot be moved to a
+	different core, so outside of the kernel's own locked sections it is read
+	through prvGetCurrentTCB(). */
+	PRIVILEGED_DATA TCB_t * volatile pxCurrentTCBs[ configNUM_CORES ] = { NULL };
+	#define pxCurrentTCB	prvGetCurrentTCB()
+#else
+	PRIVILEGED_DATA TCB_t * volatile pxCurrentTCB = NULL;
+#endif
 
 /* Lists for ready and blocked tasks. --------------------
 xDelayedTaskList1 and xDelayedTaskList2 could be move to function scople but
 doing so breaks some kernel aware debuggers and debuggers that rely on removing
 the static qualifier. */
 PRIVILEGED_DATA static List_t pxReadyTasksLists[ configMAX_PRIORITIES ];/*< Prioritised ready tasks. */
+#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+	PRIVILEGED_DATA static List_t xDelayedTaskWheel[ configDELAYED_TASK_WHEEL_SIZE ];	/*< Delayed tasks, hashed on their wake time. */
+	PRIVILEGED_DATA static uint32_t ulDelayedTaskWheelMap = 0UL;					/*< Bit n is set when slot n of the wheel may hold tasks. */
+#else
 PRIVILEGED_DATA static List_t xDelayedTaskList1;						/*< Delayed tasks. */
-PRIVILEGED_DATA static List_t xDelayedTaskList2;						/*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
 PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;				/*< Points to the delayed task list currently being used. */
+#if( configUSE_64_BIT_TICK_COUNT == 0 )
+PRIVILEGED_DATA static List_t xDelayedTaskList2;						/*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
 PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;		/*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
+#endif /* configUSE_64_BIT_TICK_COUNT */
+#endif /* configUSE_DELAYED_TASK_WHEEL */
+#if( configUSE_EDF_SCHEDULING == 1 )
+	PRIVILEGED_DATA static TCB_t * pxEDFHeap[ configEDF_MAX_TASKS ];	/*< Binary min-heap of the EDF tasks ordered on their absolute deadline. */
+	PRIVILEGED_DATA static UBaseType_t uxEDFHeapLength = ( UBaseType_t ) 0U;
+	PRIVILEGED_DATA static UBaseType_t uxEDFTaskCount = ( UBaseType_t ) 0U;	/*< Number of EDF tasks in existence. */
+#endif /* configUSE_EDF_SCHEDULING */
+#if( configUSE_TASK_BUDGETS == 1 )
+	PRIVILEGED_DATA static List_t xBudgetExhaustedTaskList;				/*< Tasks that have used their budget and run at configTASK_BUDGET_EXHAUSTED_PRIORITY until it is replenished. */
+	PRIVILEGED_DATA static TickType_t xNextBudgetReplenishTime = ( TickType_t ) 0U;	/*< The earliest replenishment time of the tasks in xBudgetExhaustedTaskList. */
+	PRIVILEGED_DATA static uint32_t ulBudgetChargedTime = 0UL;		/*< Run time counter value up to which the running task has been charged. */
+#endif /* configUSE_TASK_BUDGETS */
+#if( configUSE_TASK_POOLS == 1 )
+	PRIVILEGED_DATA static TaskPool_t *pxTaskPools = NULL;				/*< The task pools ordered by increasing stack depth. */
+#endif /* configUSE_TASK_POOLS */
+#if( configUSE_BASIC_TASKS == 1 )
+	PRIVILEGED_DATA static StackType_t *pxSharedStacks[ configMAX_PRIORITIES ];	/*< The stack shared by the basic tasks created at each priority, allocated when the first is created. */
+	PRIVILEGED_DATA static TCB_t *pxSharedStackOwners[ configMAX_PRIORITIES ];	/*< The basic task that started a run on each shared stack and has not yet completed it, or NULL. */
+#endif /* configUSE_BASIC_TASKS */
+#if( configUSE_TASK_RENDEZVOUS == 1 )
+	PRIVILEGED_DATA static TCB_t * volatile pxRendezvousHandoffTCB = NULL;	/*< Task the running task has given the processor to, run by the next context switch ahead of other tasks of its priority. */
+#endif /* configUSE_TASK_RENDEZVOUS */
+#if( configUSE_TASK_NAME_INDEX == 1 )
+	PRIVILEGED_DATA static TCB_t * pxTaskNameIndex[ configTASK_NAME_INDEX_SIZE ];	/*< Every task that has not been deleted, chained by the hash of its name. */
+#endif /* configUSE_TASK_NAME_INDEX */
+#if( configUSE_LOAD_AVERAGES == 1 )
+	/* Number of one second load samples kept, which is the longest window
+	averaged. */
+	#define taskLOAD_SAMPLES		( 60U )
+
+	PRIVILEGED_DATA static uint32_t ulIdleChargedUpTo = 0UL;				/*< Cycle count up to which the idle task has been charged while it is running. */
+	PRIVILEGED_DATA static uint32_t ulIdleCyclesInSample = 0UL;				/*< Cycles spent in the idle task since the current sample started. */
+	PRIVILEGED_DATA static uint32_t ulLoadSampleStartCycles = 0UL;			/*< Cycle count at which the current sample started. */
+	PRIVILEGED_DATA static TickCount_t xLoadSampleStartTick = 0U;			/*< Tick count at which the current sample started. */
+	PRIVILEGED_DATA static uint16_t usLoadSamples[ taskLOAD_SAMPLES ];		/*< The last taskLOAD_SAMPLES loads, in hundredths of a percent. */
+	PRIVILEGED_DATA static UBaseType_t uxNextLoadSample = 0U;				/*< Index into usLoadSamples[] of the next sample to write. */
+	PRIVILEGED_DATA static UBaseType_t uxLoadSamplesTaken = 0U;				/*< Number of valid samples, up to taskLOAD_SAMPLES. */
+	PRIVILEGED_DATA static uint32_t ulLoadSum10 = 0UL;						/*< Sum of the last 10 samples. */
+	PRIVILEGED_DATA static uint32_t ulLoadSum60 = 0UL;						/*< Sum of the last 60 samples. */
+#endif /* configUSE_LOAD_AVERAGES */
+#if( configUSE_TASK_SNAPSHOTS == 1 )
+	PRIVILEGED_DATA static List_t xAllTasksList;						/*< Every task that has not been deleted, in the order they were created. */
+	PRIVILEGED_DATA static uint32_t ulTaskStateGeneration = 0UL;		/*< Incremented each time a task changes state or priority. */
+	PRIVILEGED_DATA static ListItem_t * pxSnapshotNextItem = NULL;		/*< The next task to be copied by the snapshot in progress, or NULL if there is no snapshot in progress. */
+	PRIVILEGED_DATA static TCB_t * pxSnapshotOwner = NULL;				/*< The task taking the snapshot in progress. */
+#endif /* configUSE_TASK_SNAPSHOTS */
 PRIVILEGED_DATA static List_t xPendingReadyList;						/*< Tasks that have been readied while the scheduler was suspended.  They will be moved to the ready list when the scheduler is resumed. */
 
 #if( INCLUDE_vTaskDelete == 1 )
@@ -383,15 +764,32 @@ the errno of the currently running task. */
 
 /* Other file private variables. --------------------------------*/
 PRIVILEGED_DATA static volatile UBaseType_t uxCurrentNumberOfTasks 	= ( UBaseType_t ) 0U;
-PRIVILEGED_DATA static volatile TickType_t xTickCount 				= ( TickType_t ) configINITIAL_TICK_COUNT;
+PRIVILEGED_DATA static volatile TickCount_t xTickCount 				= ( TickCount_t ) configINITIAL_TICK_COUNT;
 PRIVILEGED_DATA static volatile UBaseType_t uxTopReadyPriority 		= tskIDLE_PRIORITY;
 PRIVILEGED_DATA static volatile BaseType_t xSchedulerRunning 		= pdFALSE;
 PRIVILEGED_DATA static volatile TickType_t xPendedTicks 			= ( TickType_t ) 0U;
-PRIVILEGED_DATA static volatile BaseType_t xYieldPending 			= pdFALSE;
-PRIVILEGED_DATA static volatile BaseType_t xNumOfOverflows 			= ( BaseType_t ) 0;
+#if ( configNUM_CORES > 1 )
+	PRIVILEGED_DATA static volatile BaseType_t xYieldPendings[ configNUM_CORES ] = { pdFALSE };
+	#define xYieldPending	xYieldPendings[ portGET_CORE_ID() ]
+#else
+	PRIVILEGED_DATA static volatile BaseType_t xYieldPending 		= pdFALSE;
+#endif
+#if( configUSE_64_BIT_TICK_COUNT == 1 )
+	/* The overflow count of the truncated TickType_t view of the tick count is
+	held in its upper bits.  Shifting in two steps keeps the shift defined when
+	TickType_t is itself 64 bits wide. */
+	#define xNumOfOverflows	( ( BaseType_t ) ( ( xTickCount >> 1 ) >> ( ( sizeof( TickType_t ) * 8U ) - 1U ) ) )
+#else
+	PRIVILEGED_DATA static volatile BaseType_t xNumOfOverflows 		= ( BaseType_t ) 0;
+#endif
 PRIVILEGED_DATA static UBaseType_t uxTaskNumber 					= ( UBaseType_t ) 0U;
-PRIVILEGED_DATA static volatile TickType_t xNextTaskUnblockTime		= ( TickType_t ) 0U; /* Initialised to portMAX_DELAY before the scheduler starts. */
-PRIVILEGED_DATA static TaskHandle_t xIdleTaskHandle					= NULL;			/*< Holds the handle of the idle task.  The idle task is created automatically when the scheduler is started. */
+PRIVILEGED_DATA static volatile TickCount_t xNextTaskUnblockTime		= ( TickCount_t ) 0U; /* Initialised to portMAX_TICK_COUNT before the scheduler starts. */
+#if ( configNUM_CORES > 1 )
+	PRIVILEGED_DATA static TaskHandle_t xIdleTaskHandles[ configNUM_CORES ] = { NULL };	/*< One idle task is created per core so every core always has a task it can run. */
+	#define xIdleTaskHandle	xIdleTaskHandles[ portGET_CORE_ID() ]
+#else
+	PRIVILEGED_DATA static TaskHandle_t xIdleTaskHandle				= NULL;			/*< Holds the handle of the idle task.  The idle task is created automatically when the scheduler is started. */
+#endif
 
 /* Context switches are held pending while the scheduler is suspended.  Also,
 interrupts must not manipulate the xStateListItem of a TCB, or any of the
@@ -407,7 +805,12 @@ PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended	= ( UBaseType_t
 
 	/* Do not move these variables to function scope as doing so prevents the
 	code working with debuggers that need to remove the static qualifier. */
-	PRIVILEGED_DATA static uint32_t ulTaskSwitchedInTime = 0UL;	/*< Holds the value of a timer/counter the last time a task was switched in. */
+	#if ( configNUM_CORES > 1 )
+		PRIVILEGED_DATA static uint32_t ulTaskSwitchedInTimes[ configNUM_CORES ] = { 0UL };
+		#define ulTaskSwitchedInTime	ulTaskSwitchedInTimes[ portGET_CORE_ID() ]
+	#else
+		PRIVILEGED_DATA static uint32_t ulTaskSwitchedInTime = 0UL;	/*< Holds the value of a timer/counter the last time a task was switched in. */
+	#endif
 	PRIVILEGED_DATA static uint32_t ulTotalRunTime = 0UL;		/*< Holds the total amount of execution time as defined by the run time counter clock. */
 
 #endif
@@ -429,10 +832,20 @@ PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended	= ( UBaseType_t
 
 #endif
 
+#if( configUSE_PERIOD_OVERRUN_HOOK == 1 )
+
+	extern void vApplicationPeriodOverrunHook( TaskHandle_t xTask, TickType_t xResponseTime );
+
+#endif
+
 #if( configSUPPORT_STATIC_ALLOCATION == 1 )
 
 	extern void vApplicationGetIdleTaskMemory( StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint32_t *pulIdleTaskStackSize ); /*lint !e526 Symbol not defined as it is an application callback. */
 
+	#if ( configNUM_CORES > 1 )
+		extern void vApplicationGetPassiveIdleTaskMemory( StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint32_t *pulIdleTaskStackSize, BaseType_t xPassiveIdleTaskIndex ); /*lint !e526 Symbol not defined as it is an application callback. */
+	#endif
+
 #endif
 
 /* File private functions. --------------------------------*/
@@ -511,12 +924,28 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait, const BaseT
  * Searches pxList for a task with name pcNameToQuery - returning a handle to
  * the task if it is found, or NULL if the task is not found.
  */
-#if ( INCLUDE_xTaskGetHandle == 1 )
+#if ( ( INCLUDE_xTaskGetHandle == 1 ) && ( configUSE_TASK_NAME_INDEX == 0 ) )
 
 	static TCB_t *prvSearchForNameWithinSingleList( List_t *pxList, const char pcNameToQuery[] ) PRIVILEGED_FUNCTION;
 
 #endif
 
+#if( configUSE_TASK_NAME_INDEX == 1 )
+
+	/*
+	 * Returns the bucket of pxTaskNameIndex[] that holds tasks named pcName.
+	 */
+	static UBaseType_t prvTaskNameHash( const char *pcName ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Add pxTCB to, or remove it from, the name index.  Must be called from a
+	 * critical section.
+	 */
+	static void prvTaskNameIndexInsert( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+	static void prvTaskNameIndexRemove( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TASK_NAME_INDEX */
+
 /*
  * When a task is created, the stack of the task is filled with a known value.
  * This function determines the 'high water mark' of the task stack by
@@ -524,7 +953,17 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait, const BaseT
  */
 #if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
 
-	static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte ) PRIVILEGED_FUNCTION;
+	static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Called as a task is switched out.  Moves the task's recorded high water mark
+ * down to its saved stack pointer if the stack pointer is deeper.
+ */
+#if( configUSE_INCREMENTAL_STACK_HIGH_WATER_MARK == 1 )
+
+	static void prvSampleStackHighWaterMark( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
 
 #endif
 
@@ -549,110 +988,377 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait, const BaseT
  */
 static void prvResetNextTaskUnblockTime( void );
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+#if ( configUSE_LOAD_AVERAGES == 1 )
 
 	/*
-	 * Helper function used to pad task names with spaces when printing out
-	 * human readable tables of task information.
+	 * Add the time since ulIdleChargedUpTo to the idle time of the current
+	 * sample.  Only called while the idle task is running.
 	 */
-	static char *prvWriteNameToBuffer( char *pcBuffer, const char *pcTaskName ) PRIVILEGED_FUNCTION;
+	static void prvChargeIdleTime( const uint32_t ulNow ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Close the current one second load sample and start the next.
+	 */
+	static void prvTakeLoadSample( const TickCount_t xNowTick ) PRIVILEGED_FUNCTION;
 
 #endif
 
-/*
- * Called after a Task_t structure has been allocated either statically or
- * dynamically to fill in the structure's members.
- */
-static void prvInitialiseNewTask( 	TaskFunction_t pxTaskCode,
-									const char * const pcName, 		/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-									const uint32_t ulStackDepth,
-									void * const pvParameters,
-									UBaseType_t uxPriority,
-									TaskHandle_t * const pxCreatedTask,
-									TCB_t *pxNewTCB,
-									const MemoryRegion_t * const xRegions ) PRIVILEGED_FUNCTION;
+#if ( configUSE_WAKEUP_LATENCY_STATS == 1 )
 
-/*
- * Called after a new task has been created and initialised to place the task
- * under the control of the scheduler.
- */
-static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) PRIVILEGED_FUNCTION;
+	/*
+	 * Add a wakeup latency of ulLatency cycles to the statistics of pxTCB.
+	 */
+	static void prvRecordWakeupLatency( TCB_t * const pxTCB, const uint32_t ulLatency ) PRIVILEGED_FUNCTION;
 
-/*
- * freertos_tasks_c_additions_init() should only be called if the user definable
- * macro FREERTOS_TASKS_C_ADDITIONS_INIT() is defined, as that is the only macro
- * called by the function.
- */
-#ifdef FREERTOS_TASKS_C_ADDITIONS_INIT
+#endif
 
-	static void freertos_tasks_c_additions_init( void ) PRIVILEGED_FUNCTION;
+#if ( configUSE_CEILING_MUTEXES == 1 )
+
+	/*
+	 * Move the running task pxTCB to the ready list of uxNewPriority.
+	 */
+	static void prvSetRunningTaskPriority( TCB_t * const pxTCB, const UBaseType_t uxNewPriority ) PRIVILEGED_FUNCTION;
 
 #endif
 
-/*-----------------------------------------------------------*/
+#if( configUSE_TASK_RENDEZVOUS == 1 )
 
-#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	/*
+	 * Copy the request of pxCaller into the buffer of pxReceiver and record
+	 * that the call is waiting for a reply.  Called from a critical section.
+	 */
+	static void prvRendezvousTransfer( TCB_t * const pxCaller, TCB_t * const pxReceiver ) PRIVILEGED_FUNCTION;
 
-	TaskHandle_t xTaskCreateStatic(	TaskFunction_t pxTaskCode,
-									const char * const pcName,		/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-									const uint32_t ulStackDepth,
-									void * const pvParameters,
-									UBaseType_t uxPriority,
-									StackType_t * const puxStackBuffer,
-									StaticTask_t * const pxTaskBuffer )
-	{
-	TCB_t *pxNewTCB;
-	TaskHandle_t xReturn;
+	/*
+	 * Unblock the callers referenced from pxList, one of the rendezvous lists
+	 * of a task that is being deleted.  Their calls return pdFAIL.  Returns
+	 * pdTRUE if one of them should preempt the running task.
+	 */
+	static BaseType_t prvRendezvousReleaseCallers( List_t * const pxList ) PRIVILEGED_FUNCTION;
 
-		configASSERT( puxStackBuffer != NULL );
-		configASSERT( pxTaskBuffer != NULL );
+	/*
+	 * Return the higher of uxPriority and the priority of the highest priority
+	 * task that is calling pxTCB, whether its call has been received or not.
+	 */
+	static UBaseType_t prvRendezvousGetInheritedPriority( const TCB_t * const pxTCB, UBaseType_t uxPriority ) PRIVILEGED_FUNCTION;
 
-		#if( configASSERT_DEFINED == 1 )
-		{
-			/* Sanity check that the size of the structure used to declare a
-			variable of type StaticTask_t equals the size of the real task
-			structure. */
-			volatile size_t xSize = sizeof( StaticTask_t );
-			configASSERT( xSize == sizeof( TCB_t ) );
-			( void ) xSize; /* Prevent lint warning when configASSERT() is not used. */
-		}
-		#endif /* configASSERT_DEFINED */
+	/*
+	 * Set the priority of pxReceiver to the highest of its base priority and
+	 * the priorities of the tasks calling it.  A priority inherited through a
+	 * mutex is kept while any mutex is held.  Returns pdTRUE if the priority
+	 * changed.  Called from a critical section.
+	 */
+	static BaseType_t prvRendezvousUpdatePriority( TCB_t * const pxReceiver ) PRIVILEGED_FUNCTION;
 
+	/*
+	 * Take pxCaller, whose call is being abandoned, out of the lists of the
+	 * task it is calling, and drop the priority that task inherited from it.
+	 * Returns pdTRUE if the running task's priority was lowered.  Called from a
+	 * critical section.
+	 */
+	static BaseType_t prvRendezvousAbandonCall( TCB_t * const pxCaller ) PRIVILEGED_FUNCTION;
 
-		if( ( pxTaskBuffer != NULL ) && ( puxStackBuffer != NULL ) )
-		{
-			/* The memory used for the task's TCB and stack are passed into this
-			function - use them. */
-			pxNewTCB = ( TCB_t * ) pxTaskBuffer; /*lint !e740 !e9087 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
-			pxNewTCB->pxStack = ( StackType_t * ) puxStackBuffer;
+#endif /* configUSE_TASK_RENDEZVOUS */
 
-			#if( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
-			{
-				/* Tasks can be created statically or dynamically, so note this
-				task was created statically in case the task is later deleted. */
-				pxNewTCB->ucStaticallyAllocated = tskSTATICALLY_ALLOCATED_STACK_AND_TCB;
-			}
-			#endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
+/*
+ * Remove a task whose block time has expired from the Blocked state.  Returns
+ * pdTRUE if the task should preempt the running task.
+ */
+static BaseType_t prvUnblockDelayedTask( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
 
-			prvInitialiseNewTask( pxTaskCode, pcName, ulStackDepth, pvParameters, uxPriority, &xReturn, pxNewTCB, NULL );
-			prvAddNewTaskToReadyList( pxNewTCB );
-		}
-		else
-		{
-			xReturn = NULL;
-		}
+#if( configUSE_DELAYED_TASK_WHEEL == 1 )
 
-		return xReturn;
-	}
+	/*
+	 * Add pxTCB to the wheel slot of the wake time already held in its state
+	 * list item.
+	 */
+	static void prvAddTaskToDelayedWheel( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
 
-#endif /* SUPPORT_STATIC_ALLOCATION */
-/*-----------------------------------------------------------*/
+	/*
+	 * Return the first tick, from xFromTick on, whose wheel slot holds tasks.
+	 * No task wakes earlier, although the tasks of that slot may still be whole
+	 * turns of the wheel away.  portMAX_TICK_COUNT is returned if the wheel is
+	 * empty or the tick count overflows first.
+	 */
+	static TickCount_t prvGetNextDelayedWheelTime( const TickCount_t xFromTick ) PRIVILEGED_FUNCTION;
 
-#if( ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+#endif /* configUSE_DELAYED_TASK_WHEEL */
 
-	BaseType_t xTaskCreateRestrictedStatic( const TaskParameters_t * const pxTaskDefinition, TaskHandle_t *pxCreatedTask )
-	{
-	TCB_t *pxNewTCB;
+#if( configUSE_EDF_SCHEDULING == 1 )
+
+	/*
+	 * Reference pxTCB from the deadline heap, if it is not referenced already.
+	 */
+	static void prvEDFHeapInsert( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Stop referencing pxTCB from the deadline heap, if it is referenced.
+	 */
+	static void prvEDFHeapRemove( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Move the task at position uxIndex of the deadline heap up or down until
+	 * the heap is ordered again.
+	 */
+	static void prvEDFHeapRestore( UBaseType_t uxIndex ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Return the ready EDF task with the earliest deadline, or NULL if no EDF
+	 * task is ready.  Tasks are not taken out of the heap when they leave the
+	 * ready list of the EDF band, those found at its top are dropped here.
+	 */
+	static TCB_t *prvEDFGetEarliestReadyTask( void ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Called once the highest priority ready task has been selected.  If it
+	 * is in the EDF band, select the EDF task with the earliest deadline
+	 * instead of the next task in round robin order.
+	 */
+	static void prvEDFSelectTask( void ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Return pdTRUE if pxTCB is an EDF task that should run before pxOtherTCB
+	 * within the EDF band.
+	 */
+	static BaseType_t prvEDFTaskIsEarlier( const TCB_t * const pxTCB, const TCB_t * const pxOtherTCB ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_EDF_SCHEDULING */
+
+#if( configUSE_TIME_SLICE_QUANTA == 1 )
+
+	/*
+	 * Count one tick against the time slice of pxTCB.  Returns pdTRUE, and
+	 * starts a new slice for the task, once the slice has been used up.
+	 */
+	static BaseType_t prvTimeSliceExpired( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TIME_SLICE_QUANTA */
+
+#if( configUSE_TASK_BUDGETS == 1 )
+
+	/*
+	 * Charge the running task for the run time since it was last charged, up
+	 * to the run time counter value ulNow.  A task that uses up its budget is
+	 * moved to configTASK_BUDGET_EXHAUSTED_PRIORITY, in which case pdTRUE is
+	 * returned.
+	 */
+	static BaseType_t prvTaskBudgetCharge( const uint32_t ulNow ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Return the tasks whose budget is replenished at or before xTime to their
+	 * own priority.  Returns pdTRUE if one of them should preempt the running
+	 * task.
+	 */
+	static BaseType_t prvTaskBudgetReplenish( const TickType_t xTime ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Take pxTCB out of xBudgetExhaustedTaskList and return it to its own
+	 * priority.  Returns pdTRUE if it should preempt the running task.
+	 */
+	static BaseType_t prvTaskBudgetRestore( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Change the base priority of pxTCB, moving it to the matching ready list
+	 * if it is ready.  Unlike vTaskPrioritySet() this never yields, so it can
+	 * be used from the tick and context switch paths.
+	 */
+	static void prvTaskBudgetSetPriority( TCB_t * const pxTCB, const UBaseType_t uxNewPriority ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TASK_BUDGETS */
+
+#if( configUSE_TASK_POOLS == 1 )
+
+	/*
+	 * Take a TCB and stack pair from the pool with the smallest stack depth
+	 * that is at least usStackDepth and has a free pair.  The pool is passed
+	 * out through ppxPool.  Returns NULL, and sets *ppxPool to NULL, if there
+	 * is no such pool.
+	 */
+	static TCB_t *prvTaskPoolAllocate( const configSTACK_DEPTH_TYPE usStackDepth, TaskPool_t **ppxPool ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Return the TCB and stack pair of a deleted task to its pool.
+	 */
+	static void prvTaskPoolRelease( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TASK_POOLS */
+
+#if( configUSE_BASIC_TASKS == 1 )
+
+	/*
+	 * The function every basic task starts in.  Calls the task's function,
+	 * then either leaves the task ready to run again, if it was activated while
+	 * it ran, or makes it dormant.  The context it yields from is never
+	 * resumed.
+	 */
+	static void prvBasicTaskEntry( void *pvParameters ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Place a basic task in the suspended list, waiting for a notification, so
+	 * it is activated by the notification and resume paths.
+	 */
+	static void prvBasicTaskSetDormant( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Called once the task to run has been selected.  If it is a basic task,
+	 * either give it its shared stack and a new context to start a run in, or,
+	 * if another basic task has a run on that stack still to complete, select
+	 * that task instead.
+	 */
+	static void prvSelectBasicTask( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_BASIC_TASKS */
+
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+
+	/*
+	 * Helper function used to pad task names with spaces when printing out
+	 * human readable tables of task information.
+	 */
+	static char *prvWriteNameToBuffer( char *pcBuffer, const char *pcTaskName ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Called after a Task_t structure has been allocated either statically or
+ * dynamically to fill in the structure's members.
+ */
+static void prvInitialiseNewTask( 	TaskFunction_t pxTaskCode,
+									const char * const pcName, 		/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+									const uint32_t ulStackDepth,
+									void * const pvParameters,
+									UBaseType_t uxPriority,
+									TaskHandle_t * const pxCreatedTask,
+									TCB_t *pxNewTCB,
+									const MemoryRegion_t * const xRegions ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called after a new task has been created and initialised to place the task
+ * under the control of the scheduler.
+ */
+static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) PRIVILEGED_FUNCTION;
+
+/*
+ * freertos_tasks_c_additions_init() should only be called if the user definable
+ * macro FREERTOS_TASKS_C_ADDITIONS_INIT() is defined, as that is the only macro
+ * called by the function.
+ */
+#ifdef FREERTOS_TASKS_C_ADDITIONS_INIT
+
+	static void freertos_tasks_c_additions_init( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configNUM_CORES > 1 )
+
+	/*
+	 * Returns the task running on the calling core.  Interrupts are masked
+	 * while the core ID is read and used so the calling task cannot be moved
+	 * to another core in between.
+	 */
+	static portFORCE_INLINE TCB_t *prvGetCurrentTCB( void );
+
+	/*
+	 * Called when pxTCB has been placed in a ready list.  Finds the core
+	 * running the lowest priority task pxTCB should preempt.  If that is a
+	 * different core it is interrupted, and pdFALSE is returned.  pdTRUE is
+	 * returned if the calling core should yield.  Must be called with the task
+	 * or ISR lock held.
+	 */
+	static BaseType_t prvYieldForTask( const TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Selects the highest priority ready task that is not already running on
+	 * another core (and, if configUSE_CORE_AFFINITY is 1, that may run on
+	 * xCoreID) and makes it the task running on xCoreID.
+	 */
+	static void prvSelectHighestPriorityTask( const BaseType_t xCoreID ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if ( configNUM_CORES > 1 )
+
+	static portFORCE_INLINE TCB_t *prvGetCurrentTCB( void )
+	{
+	TCB_t *pxTCB;
+	UBaseType_t uxSavedInterruptStatus;
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK();
+		{
+			pxTCB = pxCurrentTCBs[ portGET_CORE_ID() ];
+		}
+		portCLEAR_INTERRUPT_MASK( uxSavedInterruptStatus );
+
+		return pxTCB;
+	}
+
+#endif /* configNUM_CORES */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	TaskHandle_t xTaskCreateStatic(	TaskFunction_t pxTaskCode,
+									const char * const pcName,		/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+									const uint32_t ulStackDepth,
+									void * const pvParameters,
+									UBaseType_t uxPriority,
+									StackType_t * const puxStackBuffer,
+									StaticTask_t * const pxTaskBuffer )
+	{
+	TCB_t *pxNewTCB;
+	TaskHandle_t xReturn;
+
+		configASSERT( puxStackBuffer != NULL );
+		configASSERT( pxTaskBuffer != NULL );
+
+		#if( configASSERT_DEFINED == 1 )
+		{
+			/* Sanity check that the size of the structure used to declare a
+			variable of type StaticTask_t equals the size of the real task
+			structure. */
+			volatile size_t xSize = sizeof( StaticTask_t );
+			configASSERT( xSize == sizeof( TCB_t ) );
+			( void ) xSize; /* Prevent lint warning when configASSERT() is not used. */
+		}
+		#endif /* configASSERT_DEFINED */
+
+
+		if( ( pxTaskBuffer != NULL ) && ( puxStackBuffer != NULL ) )
+		{
+			/* The memory used for the task's TCB and stack are passed into this
+			function - use them. */
+			pxNewTCB = ( TCB_t * ) pxTaskBuffer; /*lint !e740 !e9087 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
+			pxNewTCB->pxStack = ( StackType_t * ) puxStackBuffer;
+
+			#if( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
+			{
+				/* Tasks can be created statically or dynamically, so note this
+				task was created statically in case the task is later deleted. */
+				pxNewTCB->ucStaticallyAllocated = tskSTATICALLY_ALLOCATED_STACK_AND_TCB;
+			}
+			#endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
+
+			prvInitialiseNewTask( pxTaskCode, pcName, ulStackDepth, pvParameters, uxPriority, &xReturn, pxNewTCB, NULL );
+			prvAddNewTaskToReadyList( pxNewTCB );
+		}
+		else
+		{
+			xReturn = NULL;
+		}
+
+		return xReturn;
+	}
+
+#endif /* SUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if( ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+	BaseType_t xTaskCreateRestrictedStatic( const TaskParameters_t * const pxTaskDefinition, TaskHandle_t *pxCreatedTask )
+	{
+	TCB_t *pxNewTCB;
 	BaseType_t xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
 
 		configASSERT( pxTaskDefinition->puxStackBuffer != NULL );
@@ -754,62 +1460,90 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) PRIVILEGED_FUNCTION;
 	{
 	TCB_t *pxNewTCB;
 	BaseType_t xReturn;
+	uint32_t ulStackDepth = ( uint32_t ) usStackDepth;
+	#if( configUSE_TASK_POOLS == 1 )
+		TaskPool_t *pxPool;
+	#endif
 
-		/* If the stack grows down then allocate the stack then the TCB so the stack
-		does not grow into the TCB.  Likewise if the stack grows up then allocate
-		the TCB then the stack. */
-		#if( portSTACK_GROWTH > 0 )
+		#if( configUSE_TASK_POOLS == 1 )
 		{
-			/* Allocate space for the TCB.  Where the memory comes from depends on
-			the implementation of the port malloc function and whether or not static
-			allocation is being used. */
-			pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+			/* Take the TCB and stack from a pool if there is one that fits,
+			in which case the task gets the full stack of the pool. */
+			pxNewTCB = prvTaskPoolAllocate( usStackDepth, &pxPool );
 
 			if( pxNewTCB != NULL )
 			{
-				/* Allocate space for the stack used by the task being created.
-				The base of the stack memory stored in the TCB so the task can
-				be deleted later if required. */
-				pxNewTCB->pxStack = ( StackType_t * ) pvPortMalloc( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-
-				if( pxNewTCB->pxStack == NULL )
-				{
-					/* Could not allocate the stack.  Delete the allocated TCB. */
-					vPortFree( pxNewTCB );
-					pxNewTCB = NULL;
-				}
+				ulStackDepth = ( uint32_t ) pxPool->usStackDepth;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
 			}
 		}
-		#else /* portSTACK_GROWTH */
+		#else
 		{
-		StackType_t *pxStack;
-
-			/* Allocate space for the stack used by the task being created. */
-			pxStack = pvPortMalloc( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack and this allocation is the stack. */
+			pxNewTCB = NULL;
+		}
+		#endif /* configUSE_TASK_POOLS */
 
-			if( pxStack != NULL )
+		if( pxNewTCB == NULL )
+		{
+			/* If the stack grows down then allocate the stack then the TCB so the stack
+			does not grow into the TCB.  Likewise if the stack grows up then allocate
+			the TCB then the stack. */
+			#if( portSTACK_GROWTH > 0 )
 			{
-				/* Allocate space for the TCB. */
-				pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) ); /*lint !e9087 !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack, and the first member of TCB_t is always a pointer to the task's stack. */
+				/* Allocate space for the TCB.  Where the memory comes from depends on
+				the implementation of the port malloc function and whether or not static
+				allocation is being used. */
+				pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
 
 				if( pxNewTCB != NULL )
 				{
-					/* Store the stack location in the TCB. */
-					pxNewTCB->pxStack = pxStack;
+					/* Allocate space for the stack used by the task being created.
+					The base of the stack memory stored in the TCB so the task can
+					be deleted later if required. */
+					pxNewTCB->pxStack = ( StackType_t * ) pvPortMalloc( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+					if( pxNewTCB->pxStack == NULL )
+					{
+						/* Could not allocate the stack.  Delete the allocated TCB. */
+						vPortFree( pxNewTCB );
+						pxNewTCB = NULL;
+					}
+				}
+			}
+			#else /* portSTACK_GROWTH */
+			{
+			StackType_t *pxStack;
+
+				/* Allocate space for the stack used by the task being created. */
+				pxStack = pvPortMalloc( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack and this allocation is the stack. */
+
+				if( pxStack != NULL )
+				{
+					/* Allocate space for the TCB. */
+					pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) ); /*lint !e9087 !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack, and the first member of TCB_t is always a pointer to the task's stack. */
+
+					if( pxNewTCB != NULL )
+					{
+						/* Store the stack location in the TCB. */
+						pxNewTCB->pxStack = pxStack;
+					}
+					else
+					{
+						/* The stack cannot be used as the TCB was not created.  Free
+						it again. */
+						vPortFree( pxStack );
+					}
 				}
 				else
 				{
-					/* The stack cannot be used as the TCB was not created.  Free
-					it again. */
-					vPortFree( pxStack );
+					pxNewTCB = NULL;
 				}
 			}
-			else
-			{
-				pxNewTCB = NULL;
-			}
+			#endif /* portSTACK_GROWTH */
 		}
-		#endif /* portSTACK_GROWTH */
 
 		if( pxNewTCB != NULL )
 		{
@@ -821,7 +1555,22 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) PRIVILEGED_FUNCTION;
 			}
 			#endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
 
-			prvInitialiseNewTask( pxTaskCode, pcName, ( uint32_t ) usStackDepth, pvParameters, uxPriority, pxCreatedTask, pxNewTCB, NULL );
+			prvInitialiseNewTask( pxTaskCode, pcName, ulStackDepth, pvParameters, uxPriority, pxCreatedTask, pxNewTCB, NULL );
+
+			#if( configUSE_TASK_POOLS == 1 )
+			{
+				if( pxPool != NULL )
+				{
+					pxNewTCB->ucStaticallyAllocated = tskPOOL_ALLOCATED_STACK_AND_TCB;
+					pxNewTCB->pxTaskPool = pxPool;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif
+
 			prvAddNewTaskToReadyList( pxNewTCB );
 			xReturn = pdPASS;
 		}
@@ -836,25 +1585,250 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) PRIVILEGED_FUNCTION;
 #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 /*-----------------------------------------------------------*/
 
-static void prvInitialiseNewTask( 	TaskFunction_t pxTaskCode,
-									const char * const pcName,		/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-									const uint32_t ulStackDepth,
-									void * const pvParameters,
-									UBaseType_t uxPriority,
-									TaskHandle_t * const pxCreatedTask,
-									TCB_t *pxNewTCB,
-									const MemoryRegion_t * const xRegions )
-{
-StackType_t *pxTopOfStack;
-UBaseType_t x;
+#if( configUSE_TASK_POOLS == 1 )
 
-	#if( portUSING_MPU_WRAPPERS == 1 )
-		/* Should the task be created in privileged mode? */
-		BaseType_t xRunPrivileged;
-		if( ( uxPriority & portPRIVILEGE_BIT ) != 0U )
+	BaseType_t xTaskPoolCreate( configSTACK_DEPTH_TYPE usStackDepth, UBaseType_t uxNumberOfTasks )
+	{
+	TaskPool_t *pxPool;
+	TaskPool_t **ppxInsertAfter;
+	TCB_t *pxTCB;
+	uint8_t *pucPair;
+	UBaseType_t ux;
+	const size_t xHeaderSize = taskPOOL_ALIGNED_SIZE( sizeof( TaskPool_t ) + ( ( size_t ) uxNumberOfTasks * sizeof( TCB_t * ) ) );
+	const size_t xTCBSize = taskPOOL_ALIGNED_SIZE( sizeof( TCB_t ) );
+	const size_t xStackSize = taskPOOL_ALIGNED_SIZE( ( size_t ) usStackDepth * sizeof( StackType_t ) );
+	BaseType_t xReturn;
+
+		configASSERT( usStackDepth > ( configSTACK_DEPTH_TYPE ) 0 );
+		configASSERT( uxNumberOfTasks > ( UBaseType_t ) 0U );
+
+		pxPool = ( TaskPool_t * ) pvPortMalloc( xHeaderSize + ( ( size_t ) uxNumberOfTasks * ( xTCBSize + xStackSize ) ) ); /*lint !e9087 !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack. */
+
+		if( pxPool != NULL )
 		{
-			xRunPrivileged = pdTRUE;
-		}
+			pucPair = ( uint8_t * ) pxPool;
+			pxPool->ppxFreeTCBs = ( TCB_t ** ) &( pucPair[ sizeof( TaskPool_t ) ] ); /*lint !e9087 !e826 TaskPool_t ends on a pointer boundary. */
+			pxPool->usStackDepth = usStackDepth;
+			pxPool->uxFreeTCBs = uxNumberOfTasks;
+			pucPair += xHeaderSize; /*lint !e9016 Pointer arithmetic allowed on char types, especially when it assists conveying intent. */
+
+			/* Lay out each pair as xTaskCreate() allocates them, with the
+			stack placed so it does not grow into its own TCB. */
+			for( ux = ( UBaseType_t ) 0U; ux < uxNumberOfTasks; ux++ )
+			{
+				#if( portSTACK_GROWTH > 0 )
+				{
+					pxTCB = ( TCB_t * ) pucPair; /*lint !e9087 !e826 Each pair is aligned. */
+					pxTCB->pxStack = ( StackType_t * ) &( pucPair[ xTCBSize ] ); /*lint !e9087 !e826 Each pair is aligned. */
+				}
+				#else /* portSTACK_GROWTH */
+				{
+					pxTCB = ( TCB_t * ) &( pucPair[ xStackSize ] ); /*lint !e9087 !e826 Each pair is aligned. */
+					pxTCB->pxStack = ( StackType_t * ) pucPair; /*lint !e9087 !e826 Each pair is aligned. */
+				}
+				#endif /* portSTACK_GROWTH */
+
+				pxPool->ppxFreeTCBs[ ux ] = pxTCB;
+				pucPair += xTCBSize + xStackSize; /*lint !e9016 Pointer arithmetic allowed on char types, especially when it assists conveying intent. */
+			}
+
+			taskENTER_CRITICAL();
+			{
+				/* Pools of the same depth are used in the order they were
+				created. */
+				ppxInsertAfter = &pxTaskPools;
+				while( ( *ppxInsertAfter != NULL ) && ( ( *ppxInsertAfter )->usStackDepth <= usStackDepth ) )
+				{
+					ppxInsertAfter = &( ( *ppxInsertAfter )->pxNext );
+				}
+
+				pxPool->pxNext = *ppxInsertAfter;
+				*ppxInsertAfter = pxPool;
+			}
+			taskEXIT_CRITICAL();
+
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TASK_POOLS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_BASIC_TASKS == 1 )
+
+	BaseType_t xTaskCreateBasic(	TaskFunction_t pxTaskCode,
+									const char * const pcName,		/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+									void * const pvParameters,
+									UBaseType_t uxPriority,
+									TaskHandle_t * const pxCreatedTask )
+	{
+	TCB_t *pxNewTCB;
+	StackType_t *pxStack;
+	BaseType_t xReturn;
+
+		configASSERT( pxTaskCode );
+
+		if( uxPriority >= ( UBaseType_t ) configMAX_PRIORITIES )
+		{
+			uxPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* The shared stack of the priority is allocated with its first basic
+		task.  Suspending the scheduler ensures two tasks creating basic tasks
+		of the same priority cannot both allocate it. */
+		vTaskSuspendAll();
+		{
+			if( pxSharedStacks[ uxPriority ] == NULL )
+			{
+				pxSharedStacks[ uxPriority ] = ( StackType_t * ) pvPortMalloc( ( ( size_t ) configBASIC_TASK_STACK_DEPTH ) * sizeof( StackType_t ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack. */
+
+				#if( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 )
+				{
+					if( pxSharedStacks[ uxPriority ] != NULL )
+					{
+						( void ) memset( pxSharedStacks[ uxPriority ], ( int ) tskSTACK_FILL_BYTE, ( size_t ) configBASIC_TASK_STACK_DEPTH * sizeof( StackType_t ) );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* tskSET_NEW_STACKS_TO_KNOWN_VALUE */
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxStack = pxSharedStacks[ uxPriority ];
+		}
+		( void ) xTaskResumeAll();
+
+		if( pxStack != NULL )
+		{
+			pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) ); /*lint !e9087 !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack, and the first member of TCB_t is always a pointer to the task's stack. */
+		}
+		else
+		{
+			pxNewTCB = NULL;
+		}
+
+		if( pxNewTCB != NULL )
+		{
+			/* The TCB must be marked as a basic task before it is
+			initialised, as a basic task's stack is neither filled nor given an
+			initial context until the task is activated. */
+			pxNewTCB->pxStack = pxStack;
+			pxNewTCB->ucStaticallyAllocated = tskBASIC_TASK_SHARED_STACK;
+			pxNewTCB->pxBasicTaskCode = pxTaskCode;
+			pxNewTCB->pvBasicTaskParameters = pvParameters;
+			pxNewTCB->uxSharedStack = uxPriority;
+
+			prvInitialiseNewTask( prvBasicTaskEntry, pcName, ( uint32_t ) configBASIC_TASK_STACK_DEPTH, ( void * ) pxNewTCB, uxPriority, pxCreatedTask, pxNewTCB, NULL );
+			prvAddNewTaskToReadyList( pxNewTCB );
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_BASIC_TASKS */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_EDF_SCHEDULING == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+	BaseType_t xTaskCreateEDF(	TaskFunction_t pxTaskCode,
+								const char * const pcName,		/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+								const configSTACK_DEPTH_TYPE usStackDepth,
+								void * const pvParameters,
+								const TickType_t xRelativeDeadline,
+								const TickType_t xPeriod,
+								TaskHandle_t * const pxCreatedTask )
+	{
+	TCB_t *pxNewTCB = NULL;
+	BaseType_t xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+
+		configASSERT( xRelativeDeadline > ( TickType_t ) 0U );
+		configASSERT( xPeriod > ( TickType_t ) 0U );
+
+		/* The scheduler is suspended so the new task cannot run before it has
+		been made an EDF task. */
+		vTaskSuspendAll();
+		{
+			if( uxEDFTaskCount < ( UBaseType_t ) configEDF_MAX_TASKS )
+			{
+				xReturn = xTaskCreate( pxTaskCode, pcName, usStackDepth, pvParameters, ( UBaseType_t ) configEDF_PRIORITY, &pxNewTCB );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( xReturn == pdPASS )
+			{
+				uxEDFTaskCount++;
+
+				/* The first job is released now. */
+				pxNewTCB->xEDFRelativeDeadline = xRelativeDeadline;
+				pxNewTCB->xEDFPeriod = xPeriod;
+				pxNewTCB->xEDFRelease = xTickCount;
+				pxNewTCB->xEDFDeadline = pxNewTCB->xEDFRelease + ( TickCount_t ) xRelativeDeadline;
+
+				/* The task was added to its ready list before it was an EDF
+				task. */
+				prvEDFHeapInsert( pxNewTCB );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		( void ) xTaskResumeAll();
+
+		if( pxCreatedTask != NULL )
+		{
+			*pxCreatedTask = pxNewTCB;
+		}
+
+		return xReturn;
+	}
+
+#endif /* ( configUSE_EDF_SCHEDULING == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewTask( 	TaskFunction_t pxTaskCode,
+									const char * const pcName,		/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+									const uint32_t ulStackDepth,
+									void * const pvParameters,
+									UBaseType_t uxPriority,
+									TaskHandle_t * const pxCreatedTask,
+									TCB_t *pxNewTCB,
+									const MemoryRegion_t * const xRegions )
+{
+StackType_t *pxTopOfStack;
+UBaseType_t x;
+
+	#if( portUSING_MPU_WRAPPERS == 1 )
+		/* Should the task be created in privileged mode? */
+		BaseType_t xRunPrivileged;
+		if( ( uxPriority & portPRIVILEGE_BIT ) != 0U )
+		{
+			xRunPrivileged = pdTRUE;
+		}
 		else
 		{
 			xRunPrivileged = pdFALSE;
@@ -865,8 +1839,17 @@ UBaseType_t x;
 	/* Avoid dependency on memset() if it is not required. */
 	#if( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 )
 	{
-		/* Fill the stack with a known value to assist debugging. */
-		( void ) memset( pxNewTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) ulStackDepth * sizeof( StackType_t ) );
+		/* Fill the stack with a known value to assist debugging.  A shared
+		stack is filled when it is allocated, as a basic task running on it
+		might be preempted. */
+		if( taskIS_BASIC_TASK( pxNewTCB ) == pdFALSE )
+		{
+			( void ) memset( pxNewTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) ulStackDepth * sizeof( StackType_t ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 	}
 	#endif /* tskSET_NEW_STACKS_TO_KNOWN_VALUE */
 
@@ -953,6 +1936,18 @@ UBaseType_t x;
 	}
 	#endif /* configUSE_MUTEXES */
 
+	#if ( configNUM_CORES > 1 )
+	{
+		pxNewTCB->xTaskRunState = taskTASK_NOT_RUNNING;
+
+		#if ( configUSE_CORE_AFFINITY == 1 )
+		{
+			pxNewTCB->uxCoreAffinityMask = tskNO_AFFINITY;
+		}
+		#endif
+	}
+	#endif /* configNUM_CORES */
+
 	vListInitialiseItem( &( pxNewTCB->xStateListItem ) );
 	vListInitialiseItem( &( pxNewTCB->xEventListItem ) );
 
@@ -1004,8 +1999,8 @@ UBaseType_t x;
 
 	#if ( configUSE_TASK_NOTIFICATIONS == 1 )
 	{
-		pxNewTCB->ulNotifiedValue = 0;
-		pxNewTCB->ucNotifyState = taskNOT_WAITING_NOTIFICATION;
+		( void ) memset( ( void * ) &( pxNewTCB->ulNotifiedValue[ 0 ] ), 0x00, sizeof( pxNewTCB->ulNotifiedValue ) );
+		( void ) memset( ( void * ) &( pxNewTCB->ucNotifyState[ 0 ] ), taskNOT_WAITING_NOTIFICATION, sizeof( pxNewTCB->ucNotifyState ) );
 	}
 	#endif
 
@@ -1015,7 +2010,7 @@ UBaseType_t x;
 		_REENT_INIT_PTR( ( &( pxNewTCB->xNewLib_reent ) ) );
 	}
 	#endif
-	#if ( configUSE_PICOLIBC_TLS == 1 && configTLS_STATIC_SIZE > 0 )
+	#if ( configUSE_PICOLIBC_TLS == 1 && portTLS_IN_TASK_CONTEXT == 0 && configTLS_STATIC_SIZE > 0 )
 	{
 		/* Make sure we reserved enough space for the TLS variables. That
 		 * value is determined at link time, yet we want it statically allocated
@@ -1034,57 +2029,129 @@ UBaseType_t x;
 	}
 	#endif
 
+	#if( configUSE_EDF_SCHEDULING == 1 )
+	{
+		/* xTaskCreateEDF() makes the task an EDF task once it is created. */
+		pxNewTCB->xEDFRelativeDeadline = ( TickType_t ) 0U;
+		pxNewTCB->uxEDFHeapIndex = taskEDF_NOT_IN_HEAP;
+	}
+	#endif
+
+	#if( configUSE_TIME_SLICE_QUANTA == 1 )
+	{
+		pxNewTCB->uxTimeSliceQuantum = ( UBaseType_t ) configDEFAULT_TIME_SLICE_QUANTUM;
+		pxNewTCB->uxTimeSliceRemaining = ( UBaseType_t ) configDEFAULT_TIME_SLICE_QUANTUM;
+	}
+	#endif
+
+	#if( configUSE_TASK_BUDGETS == 1 )
+	{
+		/* vTaskSetBudget() gives the task a budget once it is created. */
+		vListInitialiseItem( &( pxNewTCB->xBudgetListItem ) );
+		listSET_LIST_ITEM_OWNER( &( pxNewTCB->xBudgetListItem ), pxNewTCB );
+		pxNewTCB->ulBudget = 0UL;
+		pxNewTCB->uxBudgetPriority = taskBUDGET_NOT_DEMOTED;
+	}
+	#endif
+
 	/* Initialize the TCB stack to look as if the task was already running,
 	but had been interrupted by the scheduler.  The return address is set
 	to the start of the task function. Once the stack has been initialised
 	the top of stack variable is updated. */
-	#if( portUSING_MPU_WRAPPERS == 1 )
+	if( taskIS_BASIC_TASK( pxNewTCB ) == pdFALSE )
 	{
-		/* If the port has capability to detect stack overflow,
-		pass the stack end address to the stack initialization
-		function as well. */
-		#if( portHAS_STACK_OVERFLOW_CHECKING == 1 )
+		#if( portUSING_MPU_WRAPPERS == 1 )
 		{
-			#if( portSTACK_GROWTH < 0 )
+			/* If the port has capability to detect stack overflow,
+			pass the stack end address to the stack initialization
+			function as well. */
+			#if( portHAS_STACK_OVERFLOW_CHECKING == 1 )
 			{
-				pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxStack, pxTaskCode, pvParameters, xRunPrivileged );
+				#if( portSTACK_GROWTH < 0 )
+				{
+					pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxStack, pxTaskCode, pvParameters, xRunPrivileged );
+				}
+				#else /* portSTACK_GROWTH */
+				{
+					pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxEndOfStack, pxTaskCode, pvParameters, xRunPrivileged );
+				}
+				#endif /* portSTACK_GROWTH */
 			}
-			#else /* portSTACK_GROWTH */
+			#else /* portHAS_STACK_OVERFLOW_CHECKING */
 			{
-				pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxEndOfStack, pxTaskCode, pvParameters, xRunPrivileged );
+				pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters, xRunPrivileged );
 			}
-			#endif /* portSTACK_GROWTH */
-		}
-		#else /* portHAS_STACK_OVERFLOW_CHECKING */
-		{
-			pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters, xRunPrivileged );
+			#endif /* portHAS_STACK_OVERFLOW_CHECKING */
 		}
-		#endif /* portHAS_STACK_OVERFLOW_CHECKING */
-	}
-	#else /* portUSING_MPU_WRAPPERS */
-	{
-		/* If the port has capability to detect stack overflow,
-		pass the stack end address to the stack initialization
-		function as well. */
-		#if( portHAS_STACK_OVERFLOW_CHECKING == 1 )
+		#else /* portUSING_MPU_WRAPPERS */
 		{
-			#if( portSTACK_GROWTH < 0 )
+			/* If the port has capability to detect stack overflow,
+			pass the stack end address to the stack initialization
+			function as well. */
+			#if( portHAS_STACK_OVERFLOW_CHECKING == 1 )
 			{
-				pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxStack, pxTaskCode, pvParameters );
+				#if( portSTACK_GROWTH < 0 )
+				{
+					pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxStack, pxTaskCode, pvParameters );
+				}
+				#else /* portSTACK_GROWTH */
+				{
+					pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxEndOfStack, pxTaskCode, pvParameters );
+				}
+				#endif /* portSTACK_GROWTH */
 			}
-			#else /* portSTACK_GROWTH */
+			#else /* portHAS_STACK_OVERFLOW_CHECKING */
 			{
-				pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxEndOfStack, pxTaskCode, pvParameters );
+				pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters );
 			}
-			#endif /* portSTACK_GROWTH */
+			#endif /* portHAS_STACK_OVERFLOW_CHECKING */
 		}
-		#else /* portHAS_STACK_OVERFLOW_CHECKING */
-		{
-			pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters );
-		}
-		#endif /* portHAS_STACK_OVERFLOW_CHECKING */
+		#endif /* portUSING_MPU_WRAPPERS */
+	}
+	else
+	{
+		/* A basic task is given a context each time it is activated, so only
+		the top of its stack is recorded now. */
+		pxNewTCB->pxTopOfStack = pxTopOfStack;
+	}
+
+	#if( configUSE_TASK_SNAPSHOTS == 1 )
+	{
+		vListInitialiseItem( &( pxNewTCB->xAllTasksListItem ) );
+		listSET_LIST_ITEM_OWNER( &( pxNewTCB->xAllTasksListItem ), pxNewTCB );
 	}
-	#endif /* portUSING_MPU_WRAPPERS */
+	#endif
+
+	#if( configUSE_WAKEUP_LATENCY_STATS == 1 )
+	{
+		pxNewTCB->ulWakeups = 0UL;
+		pxNewTCB->ulMaxLatency = 0UL;
+		pxNewTCB->ulTotalLatency = 0UL;
+		( void ) memset( ( void * ) pxNewTCB->ulLatencyHistogram, 0x00, sizeof( pxNewTCB->ulLatencyHistogram ) );
+		pxNewTCB->ucLatencyPending = pdFALSE;
+	}
+	#endif
+
+	#if( configUSE_PERIODIC_TASKS == 1 )
+	{
+		pxNewTCB->xPeriod = ( TickType_t ) 0U;
+	}
+	#endif
+
+	#if( configUSE_TASK_RENDEZVOUS == 1 )
+	{
+		vListInitialise( &( pxNewTCB->xRendezvousCallers ) );
+		vListInitialise( &( pxNewTCB->xRendezvousServed ) );
+		pxNewTCB->ucRendezvousState = taskRENDEZVOUS_IDLE;
+	}
+	#endif
+
+	#if( configUSE_INCREMENTAL_STACK_HIGH_WATER_MARK == 1 )
+	{
+		/* The initial context is the first thing the task uses. */
+		pxNewTCB->pxStackHighWaterMark = ( StackType_t * ) pxNewTCB->pxTopOfStack;
+	}
+	#endif
 
 	if( pxCreatedTask != NULL )
 	{
@@ -1106,12 +2173,11 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 	taskENTER_CRITICAL();
 	{
 		uxCurrentNumberOfTasks++;
-		if( pxCurrentTCB == NULL )
-		{
-			/* There are no other tasks, or all the other tasks are in
-			the suspended state - make this the current task. */
-			pxCurrentTCB = pxNewTCB;
 
+		#if ( configNUM_CORES > 1 )
+		{
+			/* Tasks are only given a core when the scheduler starts, so there
+			is no current task to maintain here. */
 			if( uxCurrentNumberOfTasks == ( UBaseType_t ) 1 )
 			{
 				/* This is the first task to be created so do the preliminary
@@ -1124,16 +2190,20 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 				mtCOVERAGE_TEST_MARKER();
 			}
 		}
-		else
+		#else
 		{
-			/* If the scheduler is not already running, make this task the
-			current task if it is the highest priority task to be created
-			so far. */
-			if( xSchedulerRunning == pdFALSE )
+			if( pxCurrentTCB == NULL )
 			{
-				if( pxCurrentTCB->uxPriority <= pxNewTCB->uxPriority )
+				/* There are no other tasks, or all the other tasks are in
+				the suspended state - make this the current task. */
+				pxCurrentTCB = pxNewTCB;
+
+				if( uxCurrentNumberOfTasks == ( UBaseType_t ) 1 )
 				{
-					pxCurrentTCB = pxNewTCB;
+					/* This is the first task to be created so do the preliminary
+					initialisation required.  We will not recover if this call
+					fails, but we will report the failure. */
+					prvInitialiseTaskLists();
 				}
 				else
 				{
@@ -1142,9 +2212,30 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 			}
 			else
 			{
-				mtCOVERAGE_TEST_MARKER();
+				/* If the scheduler is not already running, make this task the
+				current task if it is the highest priority task to be created
+				so far. */
+				if( xSchedulerRunning == pdFALSE )
+				{
+					/* Basic tasks are created dormant, so one is never chosen
+					over, and is always replaced by, a task that is not. */
+					if( ( taskIS_BASIC_TASK( pxNewTCB ) == pdFALSE ) &&
+						( ( pxCurrentTCB->uxPriority <= pxNewTCB->uxPriority ) || ( taskIS_BASIC_TASK( pxCurrentTCB ) != pdFALSE ) ) )
+					{
+						pxCurrentTCB = pxNewTCB;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
 		}
+		#endif /* configNUM_CORES */
 
 		uxTaskNumber++;
 
@@ -1156,44 +2247,154 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 		#endif /* configUSE_TRACE_FACILITY */
 		traceTASK_CREATE( pxNewTCB );
 
-		prvAddTaskToReadyList( pxNewTCB );
-
-		portSETUP_TCB( pxNewTCB );
-	}
-	taskEXIT_CRITICAL();
-
-	if( xSchedulerRunning != pdFALSE )
-	{
-		/* If the created task is of a higher priority than the current task
-		then it should run now. */
-		if( pxCurrentTCB->uxPriority < pxNewTCB->uxPriority )
+		#if( configUSE_BASIC_TASKS == 1 )
 		{
-			taskYIELD_IF_USING_PREEMPTION();
+			if( taskIS_BASIC_TASK( pxNewTCB ) != pdFALSE )
+			{
+				prvBasicTaskSetDormant( pxNewTCB );
+			}
+			else
+			{
+				prvAddTaskToReadyList( pxNewTCB );
+			}
 		}
-		else
+		#else
 		{
-			mtCOVERAGE_TEST_MARKER();
+			prvAddTaskToReadyList( pxNewTCB );
 		}
-	}
-	else
-	{
-		mtCOVERAGE_TEST_MARKER();
-	}
-}
-/*-----------------------------------------------------------*/
+		#endif /* configUSE_BASIC_TASKS */
 
-#if ( INCLUDE_vTaskDelete == 1 )
-
-	void vTaskDelete( TaskHandle_t xTaskToDelete )
-	{
-	TCB_t *pxTCB;
+		#if( configUSE_TASK_NAME_INDEX == 1 )
+		{
+			prvTaskNameIndexInsert( pxNewTCB );
+		}
+		#endif /* configUSE_TASK_NAME_INDEX */
 
-		taskENTER_CRITICAL();
+		#if( configUSE_TASK_SNAPSHOTS == 1 )
+		{
+			vListInsertEnd( &xAllTasksList, &( pxNewTCB->xAllTasksListItem ) );
+		}
+		#endif /* configUSE_TASK_SNAPSHOTS */
+
+		portSETUP_TCB( pxNewTCB );
+
+		#if ( configNUM_CORES > 1 )
+		{
+			/* The tasks running on the other cores can only be inspected
+			while the locks are held, so the new task is given a core from
+			within the critical section.  The yield is deferred until the
+			critical section is exited. */
+			if( xSchedulerRunning != pdFALSE )
+			{
+				if( taskTASK_PREEMPTS_CURRENT( pxNewTCB ) != pdFALSE )
+				{
+					taskYIELD_IF_USING_PREEMPTION();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configNUM_CORES */
+	}
+	taskEXIT_CRITICAL();
+
+	#if ( configNUM_CORES == 1 )
+	{
+		if( xSchedulerRunning != pdFALSE )
+		{
+			/* If the created task is of a higher priority than the current task
+			then it should run now. */
+			if( pxCurrentTCB->uxPriority < pxNewTCB->uxPriority )
+			{
+				taskYIELD_IF_USING_PREEMPTION();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configNUM_CORES */
+}
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskDelete == 1 )
+
+	void vTaskDelete( TaskHandle_t xTaskToDelete )
+	{
+	TCB_t *pxTCB;
+	#if( configUSE_TASK_RENDEZVOUS == 1 )
+		BaseType_t xCallerWoken = pdFALSE;
+	#endif
+
+		taskENTER_CRITICAL();
 		{
 			/* If null is passed in here then it is the calling task that is
 			being deleted. */
 			pxTCB = prvGetTCBFromHandle( xTaskToDelete );
 
+			#if( configUSE_BASIC_TASKS == 1 )
+			{
+				/* A basic task deleted part way through a run gives up its
+				shared stack. */
+				if( ( taskIS_BASIC_TASK( pxTCB ) != pdFALSE ) && ( pxSharedStackOwners[ pxTCB->uxSharedStack ] == pxTCB ) )
+				{
+					pxSharedStackOwners[ pxTCB->uxSharedStack ] = NULL;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configUSE_BASIC_TASKS */
+
+			#if( configUSE_TASK_RENDEZVOUS == 1 )
+			{
+				/* Tasks waiting to call the deleted task, and those whose call
+				it received but never replied to, are unblocked.  A call the
+				deleted task was making no longer raises the priority of its
+				receiver.  The yield is left until the task has been removed. */
+				xCallerWoken = prvRendezvousAbandonCall( pxTCB );
+
+				if( prvRendezvousReleaseCallers( &( pxTCB->xRendezvousCallers ) ) != pdFALSE )
+				{
+					xCallerWoken = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				if( prvRendezvousReleaseCallers( &( pxTCB->xRendezvousServed ) ) != pdFALSE )
+				{
+					xCallerWoken = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				if( pxRendezvousHandoffTCB == pxTCB )
+				{
+					pxRendezvousHandoffTCB = NULL;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configUSE_TASK_RENDEZVOUS */
+
 			/* Remove task from the ready/delayed list. */
 			if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
 			{
@@ -1214,13 +2415,90 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 				mtCOVERAGE_TEST_MARKER();
 			}
 
+			#if( configUSE_EDF_SCHEDULING == 1 )
+			{
+				/* The heap must not reference the TCB once it is freed. */
+				if( taskIS_EDF_TASK( pxTCB ) )
+				{
+					prvEDFHeapRemove( pxTCB );
+					uxEDFTaskCount--;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configUSE_EDF_SCHEDULING */
+
+			#if( configUSE_TASK_BUDGETS == 1 )
+			{
+				/* Clearing the budget stops the task being charged, and so
+				demoted, when it is switched out for the last time. */
+				if( listIS_CONTAINED_WITHIN( &xBudgetExhaustedTaskList, &( pxTCB->xBudgetListItem ) ) != pdFALSE )
+				{
+					( void ) uxListRemove( &( pxTCB->xBudgetListItem ) );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+				pxTCB->ulBudget = 0UL;
+			}
+			#endif /* configUSE_TASK_BUDGETS */
+
+			#if( configUSE_TASK_NAME_INDEX == 1 )
+			{
+				/* A deleted task can no longer be found by name, even if its
+				memory has not been freed yet. */
+				prvTaskNameIndexRemove( pxTCB );
+			}
+			#endif /* configUSE_TASK_NAME_INDEX */
+
+			#if( configUSE_TASK_SNAPSHOTS == 1 )
+			{
+				/* Abandon a snapshot that the task was taking, as it will
+				never be completed, otherwise move a snapshot in progress past
+				the task before it is removed. */
+				if( pxSnapshotOwner == pxTCB )
+				{
+					pxSnapshotNextItem = NULL;
+					pxSnapshotOwner = NULL;
+				}
+				else if( pxSnapshotNextItem == &( pxTCB->xAllTasksListItem ) )
+				{
+					pxSnapshotNextItem = listGET_NEXT( pxSnapshotNextItem );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				( void ) uxListRemove( &( pxTCB->xAllTasksListItem ) );
+			}
+			#endif /* configUSE_TASK_SNAPSHOTS */
+
 			/* Increment the uxTaskNumber also so kernel aware debuggers can
 			detect that the task lists need re-generating.  This is done before
 			portPRE_TASK_DELETE_HOOK() as in the Windows port that macro will
 			not return. */
 			uxTaskNumber++;
 
-			if( pxTCB == pxCurrentTCB )
+			#if( ( configUSE_TASK_POOLS == 1 ) && ( configNUM_CORES == 1 ) )
+				if( ( pxTCB->ucStaticallyAllocated == tskPOOL_ALLOCATED_STACK_AND_TCB ) && ( pxTCB == pxCurrentTCB ) && ( xSchedulerRunning != pdFALSE ) )
+				{
+					/* A task from a pool is deleting itself.  Nothing else can
+					run until this task has been switched out, and once switched
+					out it never runs again, so its TCB and stack can go back
+					to the pool now rather than waiting for the idle task. */
+					--uxCurrentNumberOfTasks;
+					prvDeleteTCB( pxTCB );
+
+					/* See the comment on the hook below. */
+					portPRE_TASK_DELETE_HOOK( pxTCB, &xYieldPending );
+				}
+				else
+			#endif /* configUSE_TASK_POOLS */
+			if( taskTASK_IS_RUNNING( pxTCB ) )
 			{
 				/* A task is deleting itself.  This cannot complete within the
 				task itself, as a context switch to another task is required.
@@ -1240,6 +2518,22 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 				hence xYieldPending is used to latch that a context switch is
 				required. */
 				portPRE_TASK_DELETE_HOOK( pxTCB, &xYieldPending );
+
+				#if ( configNUM_CORES > 1 )
+				{
+					/* The task may be running on another core, in which case
+					that core must switch away from it before the idle task
+					can free it. */
+					if( pxTCB->xTaskRunState != ( BaseType_t ) portGET_CORE_ID() )
+					{
+						portYIELD_CORE( pxTCB->xTaskRunState );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configNUM_CORES */
 			}
 			else
 			{
@@ -1266,7 +2560,22 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 			}
 			else
 			{
-				mtCOVERAGE_TEST_MARKER();
+				#if( configUSE_TASK_RENDEZVOUS == 1 )
+				{
+					if( xCallerWoken != pdFALSE )
+					{
+						taskYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+				#endif /* configUSE_TASK_RENDEZVOUS */
 			}
 		}
 	}
@@ -1289,7 +2598,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 		{
 			/* Minor optimisation.  The tick count cannot change in this
 			block. */
-			const TickType_t xConstTickCount = xTickCount;
+			const TickType_t xConstTickCount = ( TickType_t ) xTickCount;
 
 			/* Generate the tick time at which the task wants to wake. */
 			xTimeToWake = *pxPreviousWakeTime + xTimeIncrement;
@@ -1358,6 +2667,54 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 #endif /* INCLUDE_vTaskDelayUntil */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+	void vTaskEDFWaitForNextPeriod( void )
+	{
+	TCB_t * const pxTCB = pxCurrentTCB;
+
+		configASSERT( taskIS_EDF_TASK( pxTCB ) );
+		configASSERT( uxSchedulerSuspended == 0 );
+
+		vTaskSuspendAll();
+		{
+			/* The heap is ordered on the deadline, so the task leaves it before
+			its deadline moves to that of the next job. */
+			prvEDFHeapRemove( pxTCB );
+			pxTCB->xEDFRelease += ( TickCount_t ) pxTCB->xEDFPeriod;
+			pxTCB->xEDFDeadline = pxTCB->xEDFRelease + ( TickCount_t ) pxTCB->xEDFRelativeDeadline;
+
+			if( taskEDF_TIME_IS_BEFORE( xTickCount, pxTCB->xEDFRelease ) )
+			{
+				traceTASK_DELAY_UNTIL( ( TickType_t ) pxTCB->xEDFRelease );
+
+				/* prvAddCurrentTaskToDelayedList() needs the block time, not
+				the time to wake.  The task is added to the heap again when it
+				is readied. */
+				prvAddCurrentTaskToDelayedList( ( TickType_t ) ( pxTCB->xEDFRelease - xTickCount ), pdFALSE );
+			}
+			else
+			{
+				/* The current job overran, the next one is already released. */
+				prvEDFHeapInsert( pxTCB );
+			}
+		}
+
+		/* Yield even if the task did not block, as another EDF task may now
+		have an earlier deadline. */
+		if( xTaskResumeAll() == pdFALSE )
+		{
+			portYIELD_WITHIN_API();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
+
 #if ( INCLUDE_vTaskDelay == 1 )
 
 	void vTaskDelay( const TickType_t xTicksToDelay )
@@ -1408,14 +2765,21 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 	eTaskState eTaskGetState( TaskHandle_t xTask )
 	{
 	eTaskState eReturn;
-	List_t const * pxStateList, *pxDelayedList, *pxOverflowedDelayedList;
+	List_t const * pxStateList;
+	#if( configUSE_DELAYED_TASK_WHEEL == 0 )
+		List_t const *pxDelayedList;
+		#if( configUSE_64_BIT_TICK_COUNT == 0 )
+			List_t const *pxOverflowedDelayedList;
+		#endif
+	#endif
 	const TCB_t * const pxTCB = xTask;
 
 		configASSERT( pxTCB );
 
-		if( pxTCB == pxCurrentTCB )
+		if( taskTASK_IS_RUNNING( pxTCB ) )
 		{
-			/* The task calling this function is querying its own state. */
+			/* The task calling this function is querying its own state, or
+			that of a task running on another core. */
 			eReturn = eRunning;
 		}
 		else
@@ -1423,12 +2787,26 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 			taskENTER_CRITICAL();
 			{
 				pxStateList = listLIST_ITEM_CONTAINER( &( pxTCB->xStateListItem ) );
-				pxDelayedList = pxDelayedTaskList;
-				pxOverflowedDelayedList = pxOverflowDelayedTaskList;
+				#if( configUSE_DELAYED_TASK_WHEEL == 0 )
+				{
+					pxDelayedList = pxDelayedTaskList;
+					#if( configUSE_64_BIT_TICK_COUNT == 0 )
+					{
+						pxOverflowedDelayedList = pxOverflowDelayedTaskList;
+					}
+					#endif
+				}
+				#endif
 			}
 			taskEXIT_CRITICAL();
 
+			#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+			if( taskLIST_IS_DELAYED_WHEEL_SLOT( pxStateList ) )
+			#elif( configUSE_64_BIT_TICK_COUNT == 1 )
+			if( pxStateList == pxDelayedList )
+			#else
 			if( ( pxStateList == pxDelayedList ) || ( pxStateList == pxOverflowedDelayedList ) )
+			#endif
 			{
 				/* The task being queried is referenced from one of the Blocked
 				lists. */
@@ -1445,17 +2823,21 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 					{
 						#if( configUSE_TASK_NOTIFICATIONS == 1 )
 						{
+						BaseType_t x;
+
 							/* The task does not appear on the event list item of
 							and of the RTOS objects, but could still be in the
-							blocked state if it is waiting on its notification
-							rather than waiting on an object. */
-							if( pxTCB->ucNotifyState == taskWAITING_NOTIFICATION )
-							{
-								eReturn = eBlocked;
-							}
-							else
+							blocked state if it is waiting on one of its
+							notifications rather than waiting on an object. */
+							eReturn = eSuspended;
+
+							for( x = 0; x < configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
 							{
-								eReturn = eSuspended;
+								if( pxTCB->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
+								{
+									eReturn = eBlocked;
+									break;
+								}
 							}
 						}
 						#else
@@ -1463,6 +2845,20 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 							eReturn = eSuspended;
 						}
 						#endif
+
+						#if( configUSE_TASK_RENDEZVOUS == 1 )
+						{
+							/* Nor is a task waiting for a rendezvous call. */
+							if( pxTCB->ucRendezvousState == taskRENDEZVOUS_WAITING_FOR_CALL )
+							{
+								eReturn = eBlocked;
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						#endif /* configUSE_TASK_RENDEZVOUS */
 					}
 					else
 					{
@@ -1557,84 +2953,205 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 #endif /* INCLUDE_uxTaskPriorityGet */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskPrioritySet == 1 )
+#if ( configUSE_TIME_SLICE_QUANTA == 1 )
 
-	void vTaskPrioritySet( TaskHandle_t xTask, UBaseType_t uxNewPriority )
+	void vTaskSetTimeSliceQuantum( TaskHandle_t xTask, UBaseType_t uxTicks )
 	{
 	TCB_t *pxTCB;
-	UBaseType_t uxCurrentBasePriority, uxPriorityUsedOnEntry;
-	BaseType_t xYieldRequired = pdFALSE;
 
-		configASSERT( ( uxNewPriority < configMAX_PRIORITIES ) );
+		configASSERT( uxTicks > ( UBaseType_t ) 0U );
 
-		/* Ensure the new priority is valid. */
-		if( uxNewPriority >= ( UBaseType_t ) configMAX_PRIORITIES )
+		taskENTER_CRITICAL();
 		{
-			uxNewPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
+			/* If null is passed in here then it is the quantum of the calling
+			task that is being changed. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+			pxTCB->uxTimeSliceQuantum = uxTicks;
+
+			/* A shorter quantum also cuts the slice already under way. */
+			if( pxTCB->uxTimeSliceRemaining > uxTicks )
+			{
+				pxTCB->uxTimeSliceRemaining = uxTicks;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
-		else
+		taskEXIT_CRITICAL();
+	}
+
+#endif /* configUSE_TIME_SLICE_QUANTA */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIME_SLICE_QUANTA == 1 )
+
+	UBaseType_t uxTaskGetTimeSliceQuantum( const TaskHandle_t xTask )
+	{
+	TCB_t const *pxTCB;
+	UBaseType_t uxReturn;
+
+		taskENTER_CRITICAL();
 		{
-			mtCOVERAGE_TEST_MARKER();
+			pxTCB = prvGetTCBFromHandle( xTask );
+			uxReturn = pxTCB->uxTimeSliceQuantum;
 		}
+		taskEXIT_CRITICAL();
+
+		return uxReturn;
+	}
+
+#endif /* configUSE_TIME_SLICE_QUANTA */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_BUDGETS == 1 )
+
+	void vTaskSetBudget( TaskHandle_t xTask, uint32_t ulBudget, TickType_t xPeriod )
+	{
+	TCB_t *pxTCB;
+	BaseType_t xYieldRequired = pdFALSE;
+
+		configASSERT( ( ulBudget == 0UL ) || ( xPeriod > ( TickType_t ) 0U ) );
+		configASSERT( xPeriod <= ( portMAX_DELAY >> 1 ) );
 
 		taskENTER_CRITICAL();
 		{
-			/* If null is passed in here then it is the priority of the calling
+			/* If null is passed in here then it is the budget of the calling
 			task that is being changed. */
 			pxTCB = prvGetTCBFromHandle( xTask );
 
-			traceTASK_PRIORITY_SET( pxTCB, uxNewPriority );
-
-			#if ( configUSE_MUTEXES == 1 )
+			/* The new budget starts with a full replenishment period, so a
+			task that had used up the old one gets its priority back. */
+			if( pxTCB->uxBudgetPriority != taskBUDGET_NOT_DEMOTED )
 			{
-				uxCurrentBasePriority = pxTCB->uxBasePriority;
+				xYieldRequired = prvTaskBudgetRestore( pxTCB );
 			}
-			#else
+			else
 			{
-				uxCurrentBasePriority = pxTCB->uxPriority;
+				mtCOVERAGE_TEST_MARKER();
 			}
-			#endif
 
-			if( uxCurrentBasePriority != uxNewPriority )
+			pxTCB->ulBudget = ulBudget;
+			pxTCB->ulBudgetUsed = 0UL;
+			pxTCB->xBudgetPeriod = xPeriod;
+
+			/* The period starts when the task is next charged for run time. */
+			pxTCB->xBudgetReplenishTime = ( TickType_t ) xTickCount;
+
+			if( xYieldRequired != pdFALSE )
 			{
-				/* The priority change may have readied a task of higher
-				priority than the calling task. */
-				if( uxNewPriority > uxCurrentBasePriority )
-				{
-					if( pxTCB != pxCurrentTCB )
+				taskYIELD_IF_USING_PREEMPTION();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+
+#endif /* configUSE_TASK_BUDGETS */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskPrioritySet == 1 )
+
+	void vTaskPrioritySet( TaskHandle_t xTask, UBaseType_t uxNewPriority )
+	{
+	TCB_t *pxTCB;
+	UBaseType_t uxCurrentBasePriority, uxPriorityUsedOnEntry;
+	BaseType_t xYieldRequired = pdFALSE;
+
+		configASSERT( ( uxNewPriority < configMAX_PRIORITIES ) );
+
+		/* Ensure the new priority is valid. */
+		if( uxNewPriority >= ( UBaseType_t ) configMAX_PRIORITIES )
+		{
+			uxNewPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		taskENTER_CRITICAL();
+		{
+			/* If null is passed in here then it is the priority of the calling
+			task that is being changed. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+
+			traceTASK_PRIORITY_SET( pxTCB, uxNewPriority );
+
+			#if ( configUSE_MUTEXES == 1 )
+			{
+				uxCurrentBasePriority = pxTCB->uxBasePriority;
+			}
+			#else
+			{
+				uxCurrentBasePriority = pxTCB->uxPriority;
+			}
+			#endif
+
+			#if ( configUSE_TASK_BUDGETS == 1 )
+			{
+				/* A task that has used its budget keeps running at the
+				exhausted priority.  The new priority is the one it returns to
+				when the budget is replenished. */
+				if( pxTCB->uxBudgetPriority != taskBUDGET_NOT_DEMOTED )
+				{
+					pxTCB->uxBudgetPriority = uxNewPriority;
+					uxNewPriority = uxCurrentBasePriority;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configUSE_TASK_BUDGETS */
+
+			if( uxCurrentBasePriority != uxNewPriority )
+			{
+				#if ( configNUM_CORES == 1 )
+				{
+					/* The priority change may have readied a task of higher
+					priority than the calling task. */
+					if( uxNewPriority > uxCurrentBasePriority )
 					{
-						/* The priority of a task other than the currently
-						running task is being raised.  Is the priority being
-						raised above that of the running task? */
-						if( uxNewPriority >= pxCurrentTCB->uxPriority )
+						if( pxTCB != pxCurrentTCB )
 						{
-							xYieldRequired = pdTRUE;
+							/* The priority of a task other than the currently
+							running task is being raised.  Is the priority being
+							raised above that of the running task? */
+							if( uxNewPriority >= pxCurrentTCB->uxPriority )
+							{
+								xYieldRequired = pdTRUE;
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
 						}
 						else
 						{
-							mtCOVERAGE_TEST_MARKER();
+							/* The priority of the running task is being raised,
+							but the running task must already be the highest
+							priority task able to run so no yield is required. */
 						}
 					}
+					else if( pxTCB == pxCurrentTCB )
+					{
+						/* Setting the priority of the running task down means
+						there may now be another task of higher priority that
+						is ready to execute. */
+						xYieldRequired = pdTRUE;
+					}
 					else
 					{
-						/* The priority of the running task is being raised,
-						but the running task must already be the highest
-						priority task able to run so no yield is required. */
+						/* Setting the priority of any other task down does not
+						require a yield as the running task must be above the
+						new priority of the task being modified. */
 					}
 				}
-				else if( pxTCB == pxCurrentTCB )
-				{
-					/* Setting the priority of the running task down means
-					there may now be another task of higher priority that
-					is ready to execute. */
-					xYieldRequired = pdTRUE;
-				}
-				else
-				{
-					/* Setting the priority of any other task down does not
-					require a yield as the running task must be above the
-					new priority of the task being modified. */
-				}
+				#endif /* configNUM_CORES */
 
 				/* Remember the ready list the task might be referenced from
 				before its uxPriority member is changed so the
@@ -1663,6 +3180,8 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 				}
 				#endif
 
+				taskRECORD_STATE_CHANGE( pxTCB );
+
 				/* Only reset the event list item value if the value is not
 				being used for anything else. */
 				if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
@@ -1694,13 +3213,48 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 					{
 						mtCOVERAGE_TEST_MARKER();
 					}
-					prvAddTaskToReadyList( pxTCB );
+					prvMoveTaskBetweenReadyLists( pxTCB );
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
 
+				#if ( configNUM_CORES > 1 )
+				{
+					/* With more than one core the decision can only be made
+					once the task is in the ready list for its new priority. */
+					if( taskTASK_IS_RUNNING( pxTCB ) )
+					{
+						if( uxNewPriority < uxCurrentBasePriority )
+						{
+							/* The core running the task may now have a higher
+							priority task to run instead. */
+							if( pxTCB->xTaskRunState == ( BaseType_t ) portGET_CORE_ID() )
+							{
+								xYieldRequired = pdTRUE;
+							}
+							else
+							{
+								portYIELD_CORE( pxTCB->xTaskRunState );
+							}
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else if( ( uxNewPriority > uxCurrentBasePriority ) && ( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) != pdFALSE ) )
+					{
+						xYieldRequired = taskTASK_PREEMPTS_CURRENT( pxTCB );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configNUM_CORES */
+
 				if( xYieldRequired != pdFALSE )
 				{
 					taskYIELD_IF_USING_PREEMPTION();
@@ -1726,6 +3280,9 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 	void vTaskSuspend( TaskHandle_t xTaskToSuspend )
 	{
 	TCB_t *pxTCB;
+	#if( configUSE_TASK_RENDEZVOUS == 1 )
+		BaseType_t xReceiverLowered = pdFALSE;
+	#endif
 
 		taskENTER_CRITICAL();
 		{
@@ -1733,6 +3290,14 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 			being suspended. */
 			pxTCB = prvGetTCBFromHandle( xTaskToSuspend );
 
+			#if( configUSE_BASIC_TASKS == 1 )
+			{
+				/* A basic task cannot be suspended part way through a run, as
+				no other basic task could use its stack until it completes. */
+				configASSERT( ( taskIS_BASIC_TASK( pxTCB ) == pdFALSE ) || ( pxSharedStackOwners[ pxTCB->uxSharedStack ] != pxTCB ) );
+			}
+			#endif /* configUSE_BASIC_TASKS */
+
 			traceTASK_SUSPEND( pxTCB );
 
 			/* Remove task from the ready/delayed list and place in the
@@ -1757,17 +3322,67 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 			}
 
 			vListInsertEnd( &xSuspendedTaskList, &( pxTCB->xStateListItem ) );
+			taskRECORD_STATE_CHANGE( pxTCB );
+
+			#if( configUSE_WAKEUP_LATENCY_STATS == 1 )
+			{
+				/* A ready task that is suspended before it runs has not
+				responded to the event that readied it. */
+				pxTCB->ucLatencyPending = pdFALSE;
+			}
+			#endif
 
 			#if( configUSE_TASK_NOTIFICATIONS == 1 )
 			{
-				if( pxTCB->ucNotifyState == taskWAITING_NOTIFICATION )
+			BaseType_t x;
+
+				for( x = 0; x < configTASK_NOTIFICATION_ARRAY_ENTRIES; x++ )
 				{
-					/* The task was blocked to wait for a notification, but is
-					now suspended, so no notification was received. */
-					pxTCB->ucNotifyState = taskNOT_WAITING_NOTIFICATION;
+					if( pxTCB->ucNotifyState[ x ] == taskWAITING_NOTIFICATION )
+					{
+						/* The task was blocked to wait for a notification, but is
+						now suspended, so no notification was received. */
+						pxTCB->ucNotifyState[ x ] = taskNOT_WAITING_NOTIFICATION;
+					}
 				}
 			}
 			#endif
+
+			#if( configUSE_TASK_RENDEZVOUS == 1 )
+			{
+				/* Likewise a rendezvous the task was blocked on fails.  Its
+				event list item has already been taken out of the other task's
+				list, so a reply can no longer find it, and the receiver of a
+				call no longer inherits its priority. */
+				xReceiverLowered = prvRendezvousAbandonCall( pxTCB );
+
+				if( ( pxTCB->ucRendezvousState == taskRENDEZVOUS_WAITING_FOR_CALL ) ||
+					( pxTCB->ucRendezvousState == taskRENDEZVOUS_WAITING_TO_SEND ) ||
+					( pxTCB->ucRendezvousState == taskRENDEZVOUS_WAITING_FOR_REPLY ) )
+				{
+					pxTCB->ucRendezvousState = taskRENDEZVOUS_IDLE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configUSE_TASK_RENDEZVOUS */
+
+			#if ( configNUM_CORES > 1 )
+			{
+				/* A task running on another core is switched out by that
+				core. */
+				if( taskTASK_IS_RUNNING( pxTCB ) && ( pxTCB->xTaskRunState != ( BaseType_t ) portGET_CORE_ID() ) )
+				{
+					portYIELD_CORE( pxTCB->xTaskRunState );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configNUM_CORES */
 		}
 		taskEXIT_CRITICAL();
 
@@ -1786,6 +3401,21 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 			mtCOVERAGE_TEST_MARKER();
 		}
 
+		#if( configUSE_TASK_RENDEZVOUS == 1 )
+		{
+			/* The running task suspended a task that was calling it, and no
+			longer runs at that task's priority. */
+			if( xReceiverLowered != pdFALSE )
+			{
+				taskYIELD_IF_USING_PREEMPTION();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_TASK_RENDEZVOUS */
+
 		if( pxTCB == pxCurrentTCB )
 		{
 			if( xSchedulerRunning != pdFALSE )
@@ -1796,21 +3426,31 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 			}
 			else
 			{
-				/* The scheduler is not running, but the task that was pointed
-				to by pxCurrentTCB has just been suspended and pxCurrentTCB
-				must be adjusted to point to a different task. */
-				if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == uxCurrentNumberOfTasks ) /*lint !e931 Right has no side effect, just volatile. */
+				#if ( configNUM_CORES == 1 )
 				{
-					/* No other tasks are ready, so set pxCurrentTCB back to
-					NULL so when the next task is created pxCurrentTCB will
-					be set to point to it no matter what its relative priority
-					is. */
-					pxCurrentTCB = NULL;
+					/* The scheduler is not running, but the task that was pointed
+					to by pxCurrentTCB has just been suspended and pxCurrentTCB
+					must be adjusted to point to a different task. */
+					if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == uxCurrentNumberOfTasks ) /*lint !e931 Right has no side effect, just volatile. */
+					{
+						/* No other tasks are ready, so set pxCurrentTCB back to
+						NULL so when the next task is created pxCurrentTCB will
+						be set to point to it no matter what its relative priority
+						is. */
+						pxCurrentTCB = NULL;
+					}
+					else
+					{
+						vTaskSwitchContext();
+					}
 				}
-				else
+				#else
 				{
-					vTaskSwitchContext();
+					/* Cores are not given tasks until the scheduler starts, so
+					there is no current task to adjust. */
+					mtCOVERAGE_TEST_MARKER();
 				}
+				#endif /* configNUM_CORES */
 			}
 		}
 		else
@@ -1845,7 +3485,24 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 				state, or because is is blocked with no timeout? */
 				if( listIS_CONTAINED_WITHIN( NULL, &( pxTCB->xEventListItem ) ) != pdFALSE ) /*lint !e961.  The cast is only redundant when NULL is used. */
 				{
-					xReturn = pdTRUE;
+					#if( configUSE_TASK_RENDEZVOUS == 1 )
+					{
+						/* A task waiting for a rendezvous call with no timeout
+						is blocked, and must not be taken out of the wait. */
+						if( pxTCB->ucRendezvousState != taskRENDEZVOUS_WAITING_FOR_CALL )
+						{
+							xReturn = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					#else
+					{
+						xReturn = pdTRUE;
+					}
+					#endif /* configUSE_TASK_RENDEZVOUS */
 				}
 				else
 				{
@@ -1893,7 +3550,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 					prvAddTaskToReadyList( pxTCB );
 
 					/* A higher priority task may have just been resumed. */
-					if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+					if( taskTASK_PREEMPTS_CURRENT_OR_EQUALS( pxTCB ) )
 					{
 						/* This yield may not cause the task just resumed to run,
 						but will leave the lists in the correct state for the
@@ -1961,7 +3618,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 				{
 					/* Ready lists can be accessed so move the task from the
 					suspended list to the ready list directly. */
-					if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+					if( taskTASK_PREEMPTS_CURRENT_OR_EQUALS( pxTCB ) )
 					{
 						xYieldRequired = pdTRUE;
 					}
@@ -1979,6 +3636,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 					is held in the pending ready list until the scheduler is
 					unsuspended. */
 					vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
+					taskRECORD_WAKE_TIME( pxTCB );
 				}
 			}
 			else
@@ -1999,7 +3657,64 @@ void vTaskStartScheduler( void )
 BaseType_t xReturn;
 
 	/* Add the idle task at the lowest priority. */
-	#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	#if ( configNUM_CORES > 1 )
+	{
+	BaseType_t xCoreID;
+
+		/* Every core must always have a task it can run, so one idle task is
+		created per core.  When static allocation is used the first obtains
+		its memory from vApplicationGetIdleTaskMemory() and the others from
+		vApplicationGetPassiveIdleTaskMemory(). */
+		xReturn = pdPASS;
+
+		for( xCoreID = 0; ( xCoreID < ( BaseType_t ) configNUM_CORES ) && ( xReturn == pdPASS ); xCoreID++ )
+		{
+			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+			{
+				StaticTask_t *pxIdleTaskTCBBuffer = NULL;
+				StackType_t *pxIdleTaskStackBuffer = NULL;
+				uint32_t ulIdleTaskStackSize;
+
+				if( xCoreID == 0 )
+				{
+					vApplicationGetIdleTaskMemory( &pxIdleTaskTCBBuffer, &pxIdleTaskStackBuffer, &ulIdleTaskStackSize );
+				}
+				else
+				{
+					vApplicationGetPassiveIdleTaskMemory( &pxIdleTaskTCBBuffer, &pxIdleTaskStackBuffer, &ulIdleTaskStackSize, xCoreID - 1 );
+				}
+
+				xIdleTaskHandles[ xCoreID ] = xTaskCreateStatic(	prvIdleTask,
+																	configIDLE_TASK_NAME,
+																	ulIdleTaskStackSize,
+																	( void * ) NULL, /*lint !e961.  The cast is not redundant for all compilers. */
+																	portPRIVILEGE_BIT, /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
+																	pxIdleTaskStackBuffer,
+																	pxIdleTaskTCBBuffer ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+
+				if( xIdleTaskHandles[ xCoreID ] == NULL )
+				{
+					xReturn = pdFAIL;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#else
+			{
+				/* The Idle task is being created using dynamically allocated RAM. */
+				xReturn = xTaskCreate(	prvIdleTask,
+										configIDLE_TASK_NAME,
+										configMINIMAL_STACK_SIZE,
+										( void * ) NULL,
+										portPRIVILEGE_BIT, /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
+										&( xIdleTaskHandles[ xCoreID ] ) ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+			}
+			#endif /* configSUPPORT_STATIC_ALLOCATION */
+		}
+	}
+	#elif( configSUPPORT_STATIC_ALLOCATION == 1 )
 	{
 		StaticTask_t *pxIdleTaskTCBBuffer = NULL;
 		StackType_t *pxIdleTaskStackBuffer = NULL;
@@ -2068,6 +3783,29 @@ BaseType_t xReturn;
 		starts to run. */
 		portDISABLE_INTERRUPTS();
 
+		#if ( configNUM_CORES > 1 )
+		{
+		BaseType_t xCoreID;
+
+			/* Give every core its first task.  Each selection skips the tasks
+			already given to the cores before it, so the highest priority
+			ready tasks are spread across the cores.  The calling core is
+			core 0. */
+			configASSERT( portGET_CORE_ID() == 0 );
+
+			for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUM_CORES; xCoreID++ )
+			{
+				prvSelectHighestPriorityTask( xCoreID );
+			}
+		}
+		#elif ( configUSE_EDF_SCHEDULING == 1 )
+		{
+			/* The tasks were selected on priority alone as they were
+			created. */
+			prvEDFSelectTask();
+		}
+		#endif /* configNUM_CORES */
+
 		#if ( configUSE_NEWLIB_REENTRANT == 1 )
 		{
 			/* Switch Newlib's _impure_ptr variable to point to the _reent
@@ -2076,14 +3814,14 @@ BaseType_t xReturn;
 		}
 		#endif /* configUSE_NEWLIB_REENTRANT */
 
-		#if ( configUSE_PICOLIBC_TLS == 1 && configTLS_STATIC_SIZE > 0 )
+		#if ( configUSE_PICOLIBC_TLS == 1 && portTLS_IN_TASK_CONTEXT == 0 && configTLS_STATIC_SIZE > 0 )
 		{
 			/* Switch TLS pointer */
 			_set_tls( &( pxCurrentTCB->ucTls ) );
 		}
 		#endif
 
-		xNextTaskUnblockTime = portMAX_DELAY;
+		xNextTaskUnblockTime = portMAX_TICK_COUNT;
 		xSchedulerRunning = pdTRUE;
 		xTickCount = ( TickType_t ) configINITIAL_TICK_COUNT;
 
@@ -2136,12 +3874,36 @@ void vTaskEndScheduler( void )
 
 void vTaskSuspendAll( void )
 {
-	/* A critical section is not required as the variable is of type
-	BaseType_t.  Please read Richard Barry's reply in the following link to a
-	post in the FreeRTOS support forum before reporting this as a bug! -
-	http://goo.gl/wu4acr */
-	++uxSchedulerSuspended;
-	portMEMORY_BARRIER();
+	#if ( configNUM_CORES > 1 )
+	{
+	UBaseType_t uxSavedInterruptStatus;
+
+		/* The task lock is held until the matching xTaskResumeAll() so the
+		other cores cannot enter a critical section while the scheduler is
+		suspended.  The tick and context switch only take the ISR lock, so
+		they see uxSchedulerSuspended and pend the tick or the switch instead.
+		Interrupts are masked while the lock is taken so this core cannot be
+		switched away from the task between taking the lock and incrementing
+		uxSchedulerSuspended. */
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK();
+		{
+			portGET_TASK_LOCK();
+			portGET_ISR_LOCK();
+			++uxSchedulerSuspended;
+			portRELEASE_ISR_LOCK();
+		}
+		portCLEAR_INTERRUPT_MASK( uxSavedInterruptStatus );
+	}
+	#else
+	{
+		/* A critical section is not required as the variable is of type
+		BaseType_t.  Please read Richard Barry's reply in the following link to a
+		post in the FreeRTOS support forum before reporting this as a bug! -
+		http://goo.gl/wu4acr */
+		++uxSchedulerSuspended;
+		portMEMORY_BARRIER();
+	}
+	#endif /* configNUM_CORES */
 }
 /*----------------------------------------------------------*/
 
@@ -2197,9 +3959,16 @@ void vTaskSuspendAll( void )
 			configUSE_PREEMPTION is 0. */
 			xReturn = 0;
 		}
+		#if( configUSE_64_BIT_TICK_COUNT == 1 )
+		else if( ( xNextTaskUnblockTime - xTickCount ) > ( TickCount_t ) portMAX_DELAY )
+		{
+			/* Further away than TickType_t can express. */
+			xReturn = portMAX_DELAY;
+		}
+		#endif
 		else
 		{
-			xReturn = xNextTaskUnblockTime - xTickCount;
+			xReturn = ( TickType_t ) ( xNextTaskUnblockTime - xTickCount );
 		}
 
 		return xReturn;
@@ -2227,6 +3996,14 @@ TickType_t xTicksToNextUnblockTime;
 	{
 		--uxSchedulerSuspended;
 
+		#if ( configNUM_CORES > 1 )
+		{
+			/* Drop the reference taken by vTaskSuspendAll().  The lock is
+			still held by the critical section until it is exited. */
+			portRELEASE_TASK_LOCK();
+		}
+		#endif /* configNUM_CORES */
+
 		if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
 		{
 			if( uxCurrentNumberOfTasks > ( UBaseType_t ) 0U )
@@ -2242,7 +4019,7 @@ TickType_t xTicksToNextUnblockTime;
 
 					/* If the moved task has a priority higher than the current
 					task then a yield must be performed. */
-					if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+					if( taskTASK_PREEMPTS_CURRENT_OR_EQUALS( pxTCB ) )
 					{
 						xYieldPending = pdTRUE;
 					}
@@ -2276,9 +4053,10 @@ TickType_t xTicksToNextUnblockTime;
 					then xNextTaskUnblockTime will the tick overflow time.
 					This means xNextTaskUnblockTime can never be less than
 					xTickCount, and the following can therefore not
-					underflow. */
+					underflow.  With a 64-bit tick count the difference is
+					truncated, which can only make the step shorter. */
 					configASSERT( xNextTaskUnblockTime >= xTickCount );
-					xTicksToNextUnblockTime = xNextTaskUnblockTime - xTickCount;
+					xTicksToNextUnblockTime = ( TickType_t ) ( xNextTaskUnblockTime - xTickCount );
 
 					/* Don't want to move the tick count more than the number
 					of ticks that are pending, so cap if necessary. */
@@ -2314,6 +4092,26 @@ TickType_t xTicksToNextUnblockTime;
 					xPendedTicks -= xTicksToNextUnblockTime;
 				}
 
+				#if ( configNUM_CORES > 1 )
+				{
+				BaseType_t xCoreID;
+
+					/* The other cores pend their context switches while the
+					scheduler is suspended, so make them switch now. */
+					for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUM_CORES; xCoreID++ )
+					{
+						if( ( xCoreID != portGET_CORE_ID() ) && ( xYieldPendings[ xCoreID ] != pdFALSE ) )
+						{
+							portYIELD_CORE( xCoreID );
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+				}
+				#endif /* configNUM_CORES */
+
 				if( xYieldPending != pdFALSE )
 				{
 					#if( configUSE_PREEMPTION != 0 )
@@ -2347,7 +4145,7 @@ TickType_t xTicks;
 	/* Critical section required if running on a 16 bit processor. */
 	portTICK_TYPE_ENTER_CRITICAL();
 	{
-		xTicks = xTickCount;
+		xTicks = ( TickType_t ) xTickCount;
 	}
 	portTICK_TYPE_EXIT_CRITICAL();
 
@@ -2378,7 +4176,7 @@ UBaseType_t uxSavedInterruptStatus;
 
 	uxSavedInterruptStatus = portTICK_TYPE_SET_INTERRUPT_MASK_FROM_ISR();
 	{
-		xReturn = xTickCount;
+		xReturn = ( TickType_t ) xTickCount;
 	}
 	portTICK_TYPE_CLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 
@@ -2386,6 +4184,48 @@ UBaseType_t uxSavedInterruptStatus;
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_64_BIT_TICK_COUNT == 1 )
+
+	TickType64_t xTaskGetTickCount64( void )
+	{
+	TickType64_t xTicks;
+
+		/* Critical section required as the 64-bit count is not read
+		atomically on a 32-bit processor. */
+		taskENTER_CRITICAL();
+		{
+			xTicks = xTickCount;
+		}
+		taskEXIT_CRITICAL();
+
+		return xTicks;
+	}
+
+#endif /* configUSE_64_BIT_TICK_COUNT */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_64_BIT_TICK_COUNT == 1 )
+
+	TickType64_t xTaskGetTickCount64FromISR( void )
+	{
+	TickType64_t xReturn;
+	UBaseType_t uxSavedInterruptStatus;
+
+		/* See the comments in xTaskGetTickCountFromISR(). */
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+		{
+			xReturn = xTickCount;
+		}
+		taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+		return xReturn;
+	}
+
+#endif /* configUSE_64_BIT_TICK_COUNT */
+/*-----------------------------------------------------------*/
+
 UBaseType_t uxTaskGetNumberOfTasks( void )
 {
 	/* A critical section is not required because the variables are of type
@@ -2406,7 +4246,7 @@ TCB_t *pxTCB;
 }
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_xTaskGetHandle == 1 )
+#if ( ( INCLUDE_xTaskGetHandle == 1 ) && ( configUSE_TASK_NAME_INDEX == 0 ) )
 
 	static TCB_t *prvSearchForNameWithinSingleList( List_t *pxList, const char pcNameToQuery[] )
 	{
@@ -2474,7 +4314,7 @@ TCB_t *pxTCB;
 #endif /* INCLUDE_xTaskGetHandle */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_xTaskGetHandle == 1 )
+#if ( ( INCLUDE_xTaskGetHandle == 1 ) && ( configUSE_TASK_NAME_INDEX == 0 ) )
 
 	TaskHandle_t xTaskGetHandle( const char *pcNameToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 	{
@@ -2501,15 +4341,32 @@ TCB_t *pxTCB;
 			} while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
 
 			/* Search the delayed lists. */
-			if( pxTCB == NULL )
+			#if( configUSE_DELAYED_TASK_WHEEL == 1 )
 			{
-				pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
-			}
+			UBaseType_t uxSlot;
 
-			if( pxTCB == NULL )
+				for( uxSlot = 0; ( uxSlot < ( UBaseType_t ) configDELAYED_TASK_WHEEL_SIZE ) && ( pxTCB == NULL ); uxSlot++ )
+				{
+					pxTCB = prvSearchForNameWithinSingleList( &( xDelayedTaskWheel[ uxSlot ] ), pcNameToQuery );
+				}
+			}
+			#else
 			{
-				pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+				if( pxTCB == NULL )
+				{
+					pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
+				}
+
+				#if( configUSE_64_BIT_TICK_COUNT == 0 )
+				{
+					if( pxTCB == NULL )
+					{
+						pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+					}
+				}
+				#endif /* configUSE_64_BIT_TICK_COUNT */
 			}
+			#endif /* configUSE_DELAYED_TASK_WHEEL */
 
 			#if ( INCLUDE_vTaskSuspend == 1 )
 			{
@@ -2539,9 +4396,77 @@ TCB_t *pxTCB;
 #endif /* INCLUDE_xTaskGetHandle */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if( configUSE_TASK_NAME_INDEX == 1 )
 
-	UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, uint32_t * const pulTotalRunTime )
+	TaskHandle_t xTaskGetHandle( const char *pcNameToQuery ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	{
+	const UBaseType_t uxBucket = prvTaskNameHash( pcNameToQuery );
+	TCB_t *pxTCB;
+
+		/* Task names will be truncated to configMAX_TASK_NAME_LEN - 1 bytes. */
+		configASSERT( strlen( pcNameToQuery ) < configMAX_TASK_NAME_LEN );
+
+		/* Only the tasks in one bucket are compared, so a critical section is
+		used rather than suspending the scheduler. */
+		taskENTER_CRITICAL();
+		{
+			pxTCB = pxTaskNameIndex[ uxBucket ];
+
+			while( ( pxTCB != NULL ) && ( strcmp( pxTCB->pcTaskName, pcNameToQuery ) != 0 ) )
+			{
+				pxTCB = pxTCB->pxNextInNameIndex;
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		return pxTCB;
+	}
+	/*-----------------------------------------------------------*/
+
+	static UBaseType_t prvTaskNameHash( const char *pcName )
+	{
+	uint32_t ulHash = 2166136261UL;
+	UBaseType_t x;
+
+		/* FNV-1a over the part of the name that is stored in the TCB. */
+		for( x = ( UBaseType_t ) 0; ( x < ( UBaseType_t ) ( configMAX_TASK_NAME_LEN - 1 ) ) && ( pcName[ x ] != ( char ) 0x00 ); x++ )
+		{
+			ulHash ^= ( uint32_t ) ( uint8_t ) pcName[ x ];
+			ulHash *= 16777619UL;
+		}
+
+		return ( UBaseType_t ) ( ulHash & ( uint32_t ) ( configTASK_NAME_INDEX_SIZE - 1 ) );
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvTaskNameIndexInsert( TCB_t * const pxTCB )
+	{
+	const UBaseType_t uxBucket = prvTaskNameHash( pxTCB->pcTaskName );
+
+		pxTCB->pxNextInNameIndex = pxTaskNameIndex[ uxBucket ];
+		pxTaskNameIndex[ uxBucket ] = pxTCB;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvTaskNameIndexRemove( TCB_t * const pxTCB )
+	{
+	TCB_t **ppxLink = &( pxTaskNameIndex[ prvTaskNameHash( pxTCB->pcTaskName ) ] );
+
+		while( *ppxLink != pxTCB )
+		{
+			configASSERT( *ppxLink != NULL );
+			ppxLink = &( ( *ppxLink )->pxNextInNameIndex );
+		}
+
+		*ppxLink = pxTCB->pxNextInNameIndex;
+	}
+
+#endif /* configUSE_TASK_NAME_INDEX */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, uint32_t * const pulTotalRunTime )
 	{
 	UBaseType_t uxTask = 0, uxQueue = configMAX_PRIORITIES;
 
@@ -2561,8 +4486,25 @@ TCB_t *pxTCB;
 
 				/* Fill in an TaskStatus_t structure with information on each
 				task in the Blocked state. */
-				uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
-				uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+				#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+				{
+				UBaseType_t uxSlot;
+
+					for( uxSlot = 0; uxSlot < ( UBaseType_t ) configDELAYED_TASK_WHEEL_SIZE; uxSlot++ )
+					{
+						uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( xDelayedTaskWheel[ uxSlot ] ), eBlocked );
+					}
+				}
+				#else
+				{
+					uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
+					#if( configUSE_64_BIT_TICK_COUNT == 0 )
+					{
+						uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+					}
+					#endif
+				}
+				#endif /* configUSE_DELAYED_TASK_WHEEL */
 
 				#if( INCLUDE_vTaskDelete == 1 )
 				{
@@ -2613,1499 +4555,4102 @@ TCB_t *pxTCB;
 #endif /* configUSE_TRACE_FACILITY */
 /*----------------------------------------------------------*/
 
-#if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
-
-	TaskHandle_t xTaskGetIdleTaskHandle( void )
-	{
-		/* If xTaskGetIdleTaskHandle() is called before the scheduler has been
-		started, then xIdleTaskHandle will be NULL. */
-		configASSERT( ( xIdleTaskHandle != NULL ) );
-		return xIdleTaskHandle;
-	}
-
-#endif /* INCLUDE_xTaskGetIdleTaskHandle */
-/*----------------------------------------------------------*/
-
-/* This conditional compilation should use inequality to 0, not equality to 1.
-This is to ensure vTaskStepTick() is available when user defined low power mode
-implementations require configUSE_TICKLESS_IDLE to be set to a value other than
-1. */
-#if ( configUSE_TICKLESS_IDLE != 0 )
+#if( configUSE_TASK_SNAPSHOTS == 1 )
 
-	void vTaskStepTick( const TickType_t xTicksToJump )
+	UBaseType_t uxTaskGetSnapshot( TaskSnapshot_t * const pxSnapshotArray, const UBaseType_t uxArraySize, const uint32_t ulChangedSince, uint32_t * const pulGeneration, UBaseType_t * const puxResumeAfter )
 	{
-		/* Correct the tick count value after a period during which the tick
-		was suppressed.  Note this does *not* call the tick hook function for
-		each stepped tick. */
-		configASSERT( ( xTickCount + xTicksToJump ) <= xNextTaskUnblockTime );
-		xTickCount += xTicksToJump;
-		traceINCREASE_TICK_COUNT( xTicksToJump );
-	}
-
-#endif /* configUSE_TICKLESS_IDLE */
-/*----------------------------------------------------------*/
-
-BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
-{
-BaseType_t xYieldRequired = pdFALSE;
-
-	/* Must not be called with the scheduler suspended as the implementation
-	relies on xPendedTicks being wound down to 0 in xTaskResumeAll(). */
-	configASSERT( uxSchedulerSuspended == 0 );
-
-	/* Use xPendedTicks to mimic xTicksToCatchUp number of ticks occuring when
-	the scheduler is suspended so the ticks are executed in xTaskResumeAll(). */
-	vTaskSuspendAll();
-	xPendedTicks += xTicksToCatchUp;
-	xYieldRequired = xTaskResumeAll();
-
-	return xYieldRequired;
-}
-/*----------------------------------------------------------*/
-
-#if ( INCLUDE_xTaskAbortDelay == 1 )
+	UBaseType_t uxTask = 0, uxResumeAfter;
+	BaseType_t xComplete = pdFALSE, xStarted = pdFALSE, xTruncated = pdFALSE;
+	uint32_t ulStartGeneration = 0UL;
+	TCB_t *pxTCB;
+	TaskSnapshot_t *pxSnapshot;
 
-	BaseType_t xTaskAbortDelay( TaskHandle_t xTask )
-	{
-	TCB_t *pxTCB = xTask;
-	BaseType_t xReturn;
+		configASSERT( pxSnapshotArray );
+		configASSERT( uxArraySize > ( UBaseType_t ) 0 );
+		configASSERT( pulGeneration );
+		configASSERT( puxResumeAfter );
 
-		configASSERT( pxTCB );
+		uxResumeAfter = *puxResumeAfter;
 
-		vTaskSuspendAll();
+		taskENTER_CRITICAL();
 		{
-			/* A task can only be prematurely removed from the Blocked state if
-			it is actually in the Blocked state. */
-			if( eTaskGetState( xTask ) == eBlocked )
+			if( pxSnapshotNextItem == NULL )
 			{
-				xReturn = pdPASS;
-
-				/* Remove the reference to the task from the blocked list.  An
-				interrupt won't touch the xStateListItem because the
-				scheduler is suspended. */
-				( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-
-				/* Is the task waiting on an event also?  If so remove it from
-				the event list too.  Interrupts can touch the event list item,
-				even though the scheduler is suspended, so a critical section
-				is used. */
-				taskENTER_CRITICAL();
-				{
-					if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
-					{
-						( void ) uxListRemove( &( pxTCB->xEventListItem ) );
-						pxTCB->ucDelayAborted = pdTRUE;
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-				}
-				taskEXIT_CRITICAL();
-
-				/* Place the unblocked task into the appropriate ready list. */
-				prvAddTaskToReadyList( pxTCB );
-
-				/* A task being unblocked cannot cause an immediate context
-				switch if preemption is turned off. */
-				#if (  configUSE_PREEMPTION == 1 )
-				{
-					/* Preemption is on, but a context switch should only be
-					performed if the unblocked task has a priority that is
-					equal to or higher than the currently executing task. */
-					if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
-					{
-						/* Pend the yield to be performed when the scheduler
-						is unsuspended. */
-						xYieldPending = pdTRUE;
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-				}
-				#endif /* configUSE_PREEMPTION */
+				ulStartGeneration = ulTaskStateGeneration;
+				pxSnapshotNextItem = listGET_HEAD_ENTRY( &xAllTasksList );
+				pxSnapshotOwner = pxCurrentTCB;
+				xStarted = pdTRUE;
 			}
 			else
 			{
-				xReturn = pdFAIL;
+				/* Another snapshot is in progress. */
+				xComplete = pdTRUE;
 			}
 		}
-		( void ) xTaskResumeAll();
-
-		return xReturn;
-	}
-
-#endif /* INCLUDE_xTaskAbortDelay */
-/*----------------------------------------------------------*/
-
-BaseType_t xTaskIncrementTick( void )
-{
-TCB_t * pxTCB;
-TickType_t xItemValue;
-BaseType_t xSwitchRequired = pdFALSE;
-
-	/* Called by the portable layer each time a tick interrupt occurs.
-	Increments the tick then checks to see if the new tick value will cause any
-	tasks to be unblocked. */
-	traceTASK_INCREMENT_TICK( xTickCount );
-	if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
-	{
-		/* Minor optimisation.  The tick count cannot change in this
-		block. */
-		const TickType_t xConstTickCount = xTickCount + ( TickType_t ) 1;
-
-		/* Increment the RTOS tick, switching the delayed and overflowed
-		delayed lists if it wraps to 0. */
-		xTickCount = xConstTickCount;
-
-		if( xConstTickCount == ( TickType_t ) 0U ) /*lint !e774 'if' does not always evaluate to false as it is looking for an overflow. */
-		{
-			taskSWITCH_DELAYED_LISTS();
-		}
-		else
-		{
-			mtCOVERAGE_TEST_MARKER();
-		}
+		taskEXIT_CRITICAL();
 
-		/* See if this tick has made a timeout expire.  Tasks are stored in
-		the	queue in the order of their wake time - meaning once one task
-		has been found whose block time has not expired there is no need to
-		look any further down the list. */
-		if( xConstTickCount >= xNextTaskUnblockTime )
+		while( xComplete == pdFALSE )
 		{
-			for( ;; )
+			/* Copy one task per critical section.  vTaskDelete() moves
+			pxSnapshotNextItem on if it deletes the task it references. */
+			taskENTER_CRITICAL();
 			{
-				if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+				if( ( pxSnapshotNextItem == listGET_END_MARKER( &xAllTasksList ) ) || ( xTruncated != pdFALSE ) )
 				{
-					/* The delayed list is empty.  Set xNextTaskUnblockTime
-					to the maximum possible value so it is extremely
-					unlikely that the
-					if( xTickCount >= xNextTaskUnblockTime ) test will pass
-					next time through. */
-					xNextTaskUnblockTime = portMAX_DELAY; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-					break;
+					pxSnapshotNextItem = NULL;
+					pxSnapshotOwner = NULL;
+					xComplete = pdTRUE;
 				}
 				else
 				{
-					/* The delayed list is not empty, get the value of the
-					item at the head of the delayed list.  This is the time
-					at which the task at the head of the delayed list must
-					be removed from the Blocked state. */
-					pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-					xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
-
-					if( xConstTickCount < xItemValue )
+					pxTCB = listGET_LIST_ITEM_OWNER( pxSnapshotNextItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+					pxSnapshotNextItem = listGET_NEXT( pxSnapshotNextItem );
+
+					/* Tasks are held in the order they were created, which
+					is also the order of their task numbers, so the tasks up
+					to uxResumeAfter were dealt with by an earlier call of the
+					same snapshot.  A ulChangedSince of 0 copies every task,
+					however long ago it last changed.  Otherwise the
+					difference is signed so the comparison still works once
+					the generation wraps. */
+					if( pxTCB->uxTCBNumber <= uxResumeAfter )
 					{
-						/* It is not time to unblock this item yet, but the
-						item value is the time at which the task at the head
-						of the blocked list must be removed from the Blocked
-						state -	so record the item value in
-						xNextTaskUnblockTime. */
-						xNextTaskUnblockTime = xItemValue;
-						break; /*lint !e9011 Code structure here is deedmed easier to understand with multiple breaks. */
+						mtCOVERAGE_TEST_MARKER();
 					}
-					else
+					else if( ( ulChangedSince != 0UL ) && ( ( int32_t ) ( pxTCB->ulStateGeneration - ulChangedSince ) <= 0 ) )
 					{
 						mtCOVERAGE_TEST_MARKER();
 					}
-
-					/* It is time to remove the item from the Blocked state. */
-					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-
-					/* Is the task waiting on an event also?  If so remove
-					it from the event list. */
-					if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+					else if( uxTask >= uxArraySize )
 					{
-						( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+						/* A changed task does not fit in the array. */
+						xTruncated = pdTRUE;
 					}
 					else
 					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+						pxSnapshot = &( pxSnapshotArray[ uxTask ] );
+						pxSnapshot->xHandle = ( TaskHandle_t ) pxTCB;
+						pxSnapshot->xTaskNumber = pxTCB->uxTCBNumber;
+						pxSnapshot->eCurrentState = eTaskGetState( pxTCB );
+						pxSnapshot->uxCurrentPriority = pxTCB->uxPriority;
 
-					/* Place the unblocked task into the appropriate ready
-					list. */
-					prvAddTaskToReadyList( pxTCB );
+						#if ( configUSE_MUTEXES == 1 )
+						{
+							pxSnapshot->uxBasePriority = pxTCB->uxBasePriority;
+						}
+						#else
+						{
+							pxSnapshot->uxBasePriority = 0;
+						}
+						#endif
 
-					/* A task being unblocked cannot cause an immediate
-					context switch if preemption is turned off. */
-					#if (  configUSE_PREEMPTION == 1 )
-					{
-						/* Preemption is on, but a context switch should
-						only be performed if the unblocked task has a
-						priority that is equal to or higher than the
-						currently executing task. */
-						if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+						#if ( configGENERATE_RUN_TIME_STATS == 1 )
 						{
-							xSwitchRequired = pdTRUE;
+							pxSnapshot->ulRunTimeCounter = pxTCB->ulRunTimeCounter;
 						}
-						else
+						#else
 						{
-							mtCOVERAGE_TEST_MARKER();
+							pxSnapshot->ulRunTimeCounter = 0;
 						}
+						#endif
+
+						pxSnapshot->ulStateGeneration = pxTCB->ulStateGeneration;
+						uxTask++;
 					}
-					#endif /* configUSE_PREEMPTION */
 				}
 			}
+			taskEXIT_CRITICAL();
 		}
 
-		/* Tasks of equal priority to the currently running task will share
-		processing time (time slice) if preemption is on, and the application
-		writer has not explicitly turned time slicing off. */
-		#if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+		if( xStarted != pdFALSE )
 		{
-			if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
+			/* Only the first call of a snapshot records where it started, so
+			tasks that change while a snapshot is taken over several calls
+			are copied by the next snapshot. */
+			if( uxResumeAfter == ( UBaseType_t ) 0 )
 			{
-				xSwitchRequired = pdTRUE;
+				*pulGeneration = ulStartGeneration;
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
-		}
-		#endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
 
-		#if ( configUSE_TICK_HOOK == 1 )
-		{
-			/* Guard against the tick hook being called when the pended tick
-			count is being unwound (when the scheduler is being unlocked). */
-			if( xPendedTicks == ( TickType_t ) 0 )
+			/* If changed tasks did not fit then the next call carries on
+			after the last task copied. */
+			if( xTruncated != pdFALSE )
 			{
-				vApplicationTickHook();
+				*puxResumeAfter = pxSnapshotArray[ uxTask - ( UBaseType_t ) 1 ].xTaskNumber;
 			}
 			else
 			{
-				mtCOVERAGE_TEST_MARKER();
+				*puxResumeAfter = ( UBaseType_t ) 0;
 			}
 		}
-		#endif /* configUSE_TICK_HOOK */
-	}
-	else
-	{
-		++xPendedTicks;
-
-		/* The tick hook gets called at regular intervals, even if the
-		scheduler is locked. */
-		#if ( configUSE_TICK_HOOK == 1 )
-		{
-			vApplicationTickHook();
-		}
-		#endif
-	}
-
-	#if ( configUSE_PREEMPTION == 1 )
-	{
-		if( xYieldPending != pdFALSE )
+		else if( uxResumeAfter == ( UBaseType_t ) 0 )
 		{
-			xSwitchRequired = pdTRUE;
+			/* Another call is copying tasks, so report no progress. */
+			*pulGeneration = ulChangedSince;
 		}
 		else
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
+
+		return uxTask;
 	}
-	#endif /* configUSE_PREEMPTION */
 
-	return xSwitchRequired;
-}
-/*-----------------------------------------------------------*/
+#endif /* configUSE_TASK_SNAPSHOTS */
+/*----------------------------------------------------------*/
 
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+#if( configUSE_WAKEUP_LATENCY_STATS == 1 )
 
-	void vTaskSetApplicationTaskTag( TaskHandle_t xTask, TaskHookFunction_t pxHookFunction )
+	static void prvRecordWakeupLatency( TCB_t * const pxTCB, const uint32_t ulLatency )
 	{
-	TCB_t *xTCB;
+	UBaseType_t uxBucket = 0;
+	uint32_t ulBucketLimit = ( ( uint32_t ) 1UL ) << configLATENCY_HISTOGRAM_FIRST_BUCKET_SHIFT;
 
-		/* If xTask is NULL then it is the task hook of the calling task that is
-		getting set. */
-		if( xTask == NULL )
+		/* Called from vTaskSwitchContext() as pxTCB is switched in. */
+		pxTCB->ucLatencyPending = pdFALSE;
+		( pxTCB->ulWakeups )++;
+
+		if( ulLatency > pxTCB->ulMaxLatency )
 		{
-			xTCB = ( TCB_t * ) pxCurrentTCB;
+			pxTCB->ulMaxLatency = ulLatency;
 		}
 		else
 		{
-			xTCB = xTask;
+			mtCOVERAGE_TEST_MARKER();
 		}
 
-		/* Save the hook function in the TCB.  A critical section is required as
-		the value can be accessed from an interrupt. */
-		taskENTER_CRITICAL();
+		if( ( pxTCB->ulTotalLatency + ulLatency ) >= pxTCB->ulTotalLatency )
 		{
-			xTCB->pxTaskTag = pxHookFunction;
+			pxTCB->ulTotalLatency += ulLatency;
+		}
+		else
+		{
+			pxTCB->ulTotalLatency = 0xffffffffUL;
 		}
-		taskEXIT_CRITICAL();
-	}
 
-#endif /* configUSE_APPLICATION_TASK_TAG */
-/*-----------------------------------------------------------*/
+		/* Find the log2 bucket.  The loop is bounded by the number of
+		buckets. */
+		while( ( uxBucket < ( ( UBaseType_t ) configLATENCY_HISTOGRAM_BUCKETS - ( UBaseType_t ) 1U ) ) && ( ulLatency >= ulBucketLimit ) )
+		{
+			ulBucketLimit <<= 1;
+			uxBucket++;
+		}
 
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+		( pxTCB->ulLatencyHistogram[ uxBucket ] )++;
+	}
+	/*-----------------------------------------------------------*/
 
-	TaskHookFunction_t xTaskGetApplicationTaskTag( TaskHandle_t xTask )
+	void vTaskGetLatencyStats( TaskHandle_t xTask, TaskLatencyStats_t *pxLatencyStats, BaseType_t xReset )
 	{
 	TCB_t *pxTCB;
-	TaskHookFunction_t xReturn;
 
-		/* If xTask is NULL then set the calling task's hook. */
-		pxTCB = prvGetTCBFromHandle( xTask );
+		configASSERT( pxLatencyStats );
 
-		/* Save the hook function in the TCB.  A critical section is required as
-		the value can be accessed from an interrupt. */
 		taskENTER_CRITICAL();
 		{
-			xReturn = pxTCB->pxTaskTag;
+			/* If null is passed in here then the calling task is being
+			queried. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+
+			pxLatencyStats->ulWakeups = pxTCB->ulWakeups;
+			pxLatencyStats->ulMaxLatency = pxTCB->ulMaxLatency;
+			pxLatencyStats->ulTotalLatency = pxTCB->ulTotalLatency;
+			( void ) memcpy( ( void * ) pxLatencyStats->ulHistogram, ( void * ) pxTCB->ulLatencyHistogram, sizeof( pxLatencyStats->ulHistogram ) );
+
+			if( xReset != pdFALSE )
+			{
+				pxTCB->ulWakeups = 0UL;
+				pxTCB->ulMaxLatency = 0UL;
+				pxTCB->ulTotalLatency = 0UL;
+				( void ) memset( ( void * ) pxTCB->ulLatencyHistogram, 0x00, sizeof( pxTCB->ulLatencyHistogram ) );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
 		taskEXIT_CRITICAL();
-
-		return xReturn;
 	}
 
-#endif /* configUSE_APPLICATION_TASK_TAG */
-/*-----------------------------------------------------------*/
+#endif /* configUSE_WAKEUP_LATENCY_STATS */
+/*----------------------------------------------------------*/
 
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+#if( configUSE_PERIODIC_TASKS == 1 )
 
-	TaskHookFunction_t xTaskGetApplicationTaskTagFromISR( TaskHandle_t xTask )
+	void vTaskSetPeriod( TaskHandle_t xTask, TickType_t xPeriod, TickType_t xDeadline )
 	{
 	TCB_t *pxTCB;
-	TaskHookFunction_t xReturn;
-	UBaseType_t uxSavedInterruptStatus;
 
-		/* If xTask is NULL then set the calling task's hook. */
-		pxTCB = prvGetTCBFromHandle( xTask );
+		configASSERT( xPeriod > ( TickType_t ) 0U );
+		configASSERT( xDeadline <= xPeriod );
 
-		/* Save the hook function in the TCB.  A critical section is required as
-		the value can be accessed from an interrupt. */
-		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		if( xDeadline == ( TickType_t ) 0U )
 		{
-			xReturn = pxTCB->pxTaskTag;
+			xDeadline = xPeriod;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
 		}
-		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
-
-		return xReturn;
-	}
 
-#endif /* configUSE_APPLICATION_TASK_TAG */
-/*-----------------------------------------------------------*/
+		taskENTER_CRITICAL();
+		{
+			/* If null is passed in here then the period of the calling task is
+			being set. */
+			pxTCB = prvGetTCBFromHandle( xTask );
 
-#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+			pxTCB->xPeriod = xPeriod;
+			pxTCB->xRelativeDeadline = xDeadline;
+			pxTCB->xReleaseTime = ( TickType_t ) xTickCount;
+			pxTCB->xLastResponseTime = ( TickType_t ) 0U;
+			pxTCB->xMaxResponseTime = ( TickType_t ) 0U;
+			pxTCB->xMaxReleaseJitter = ( TickType_t ) 0U;
+			pxTCB->ulJobs = 0UL;
+			pxTCB->ulOverruns = 0UL;
+		}
+		taskEXIT_CRITICAL();
+	}
+	/*-----------------------------------------------------------*/
 
-	BaseType_t xTaskCallApplicationTaskHook( TaskHandle_t xTask, void *pvParameter )
+	BaseType_t xTaskWaitForNextPeriod( void )
 	{
-	TCB_t *xTCB;
-	BaseType_t xReturn;
+	TCB_t * const pxTCB = prvGetTCBFromHandle( NULL );
+	TickType_t xResponseTime, xReleaseJitter, xReleaseTime;
+	BaseType_t xReturn = pdPASS;
 
-		/* If xTask is NULL then we are calling our own task hook. */
-		if( xTask == NULL )
-		{
-			xTCB = pxCurrentTCB;
-		}
-		else
+		configASSERT( pxTCB->xPeriod > ( TickType_t ) 0U );
+
+		taskENTER_CRITICAL();
 		{
-			xTCB = xTask;
+			xResponseTime = ( TickType_t ) xTickCount - pxTCB->xReleaseTime;
+			pxTCB->xLastResponseTime = xResponseTime;
+			( pxTCB->ulJobs )++;
+
+			if( xResponseTime > pxTCB->xMaxResponseTime )
+			{
+				pxTCB->xMaxResponseTime = xResponseTime;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( xResponseTime > pxTCB->xRelativeDeadline )
+			{
+				( pxTCB->ulOverruns )++;
+				traceTASK_PERIOD_OVERRUN( pxTCB, xResponseTime );
+				xReturn = pdFAIL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
+		taskEXIT_CRITICAL();
 
-		if( xTCB->pxTaskTag != NULL )
+		#if( configUSE_PERIOD_OVERRUN_HOOK == 1 )
 		{
-			xReturn = xTCB->pxTaskTag( pvParameter );
+			if( xReturn == pdFAIL )
+			{
+				vApplicationPeriodOverrunHook( pxTCB, xResponseTime );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
-		else
+		#endif /* configUSE_PERIOD_OVERRUN_HOOK */
+
+		/* vTaskDelayUntil() does not block if the next release has already
+		passed, in which case the jitter below shows how late the job starts. */
+		xReleaseTime = pxTCB->xReleaseTime;
+		vTaskDelayUntil( &xReleaseTime, pxTCB->xPeriod );
+
+		taskENTER_CRITICAL();
 		{
-			xReturn = pdFAIL;
+			pxTCB->xReleaseTime = xReleaseTime;
+			xReleaseJitter = ( TickType_t ) xTickCount - xReleaseTime;
+
+			if( xReleaseJitter > pxTCB->xMaxReleaseJitter )
+			{
+				pxTCB->xMaxReleaseJitter = xReleaseJitter;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
+		taskEXIT_CRITICAL();
 
 		return xReturn;
 	}
+	/*-----------------------------------------------------------*/
 
-#endif /* configUSE_APPLICATION_TASK_TAG */
-/*-----------------------------------------------------------*/
-
-void vTaskSwitchContext( void )
-{
-	if( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE )
-	{
-		/* The scheduler is currently suspended - do not allow a context
-		switch. */
-		xYieldPending = pdTRUE;
-	}
-	else
+	void vTaskGetPeriodStats( TaskHandle_t xTask, TaskPeriodStats_t *pxPeriodStats, BaseType_t xReset )
 	{
-		xYieldPending = pdFALSE;
-		traceTASK_SWITCHED_OUT();
+	TCB_t *pxTCB;
 
-		#if ( configGENERATE_RUN_TIME_STATS == 1 )
+		configASSERT( pxPeriodStats );
+
+		taskENTER_CRITICAL();
 		{
-			#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
-				portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalRunTime );
-			#else
-				ulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
-			#endif
+			/* If null is passed in here then the calling task is being
+			queried. */
+			pxTCB = prvGetTCBFromHandle( xTask );
 
-			/* Add the amount of time the task has been running to the
-			accumulated time so far.  The time the task started running was
-			stored in ulTaskSwitchedInTime.  Note that there is no overflow
-			protection here so count values are only valid until the timer
-			overflows.  The guard against negative values is to protect
-			against suspect run time stat counter implementations - which
-			are provided by the application, not the kernel. */
-			if( ulTotalRunTime > ulTaskSwitchedInTime )
+			pxPeriodStats->xPeriod = pxTCB->xPeriod;
+			pxPeriodStats->xDeadline = pxTCB->xRelativeDeadline;
+			pxPeriodStats->ulJobs = pxTCB->ulJobs;
+			pxPeriodStats->ulOverruns = pxTCB->ulOverruns;
+			pxPeriodStats->xLastResponseTime = pxTCB->xLastResponseTime;
+			pxPeriodStats->xMaxResponseTime = pxTCB->xMaxResponseTime;
+			pxPeriodStats->xMaxReleaseJitter = pxTCB->xMaxReleaseJitter;
+
+			if( xReset != pdFALSE )
 			{
-				pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime - ulTaskSwitchedInTime );
+				pxTCB->ulJobs = 0UL;
+				pxTCB->ulOverruns = 0UL;
+				pxTCB->xMaxResponseTime = ( TickType_t ) 0U;
+				pxTCB->xMaxReleaseJitter = ( TickType_t ) 0U;
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
-			ulTaskSwitchedInTime = ulTotalRunTime;
 		}
-		#endif /* configGENERATE_RUN_TIME_STATS */
+		taskEXIT_CRITICAL();
+	}
 
-		/* Check for stack overflow, if configured. */
-		taskCHECK_FOR_STACK_OVERFLOW();
+#endif /* configUSE_PERIODIC_TASKS */
+/*----------------------------------------------------------*/
 
-		/* Before the currently running task is switched out, save its errno. */
-		#if( configUSE_POSIX_ERRNO == 1 )
+#if( configUSE_LOAD_AVERAGES == 1 )
+
+	static void prvChargeIdleTime( const uint32_t ulNow )
+	{
+		ulIdleCyclesInSample += ulNow - ulIdleChargedUpTo;
+		ulIdleChargedUpTo = ulNow;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvTakeLoadSample( const TickCount_t xNowTick )
+	{
+	const uint32_t ulNow = portGET_CYCLE_COUNT();
+	const uint32_t ulMaxLoad = 10000UL;
+	uint32_t ulElapsed, ulBusy, ulLoad;
+	UBaseType_t uxOldest;
+
+		/* Called from the tick interrupt.  Charge the idle task for the part
+		of the sample it has been running, so no idle period spans more than
+		one sample. */
+		if( pxCurrentTCB == xIdleTaskHandle )
 		{
-			pxCurrentTCB->iTaskErrno = FreeRTOS_errno;
+			prvChargeIdleTime( ulNow );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
 		}
-		#endif
 
-		/* Select a new task to run using either the generic C or port
-		optimised asm code. */
-		taskSELECT_HIGHEST_PRIORITY_TASK(); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-		traceTASK_SWITCHED_IN();
+		ulElapsed = ulNow - ulLoadSampleStartCycles;
 
-		/* After the new task is switched in, update the global errno. */
-		#if( configUSE_POSIX_ERRNO == 1 )
+		if( ulIdleCyclesInSample < ulElapsed )
 		{
-			FreeRTOS_errno = pxCurrentTCB->iTaskErrno;
+			ulBusy = ulElapsed - ulIdleCyclesInSample;
+		}
+		else
+		{
+			ulBusy = 0UL;
 		}
-		#endif
 
-		#if ( configUSE_NEWLIB_REENTRANT == 1 )
+		/* Scale to hundredths of a percent without overflowing 32 bits. */
+		if( ulElapsed >= ulMaxLoad )
 		{
-			/* Switch Newlib's _impure_ptr variable to point to the _reent
-			structure specific to this task. */
-			_impure_ptr = &( pxCurrentTCB->xNewLib_reent );
+			ulLoad = ulBusy / ( ulElapsed / ulMaxLoad );
 		}
-		#endif /* configUSE_NEWLIB_REENTRANT */
-		#if ( configUSE_PICOLIBC_TLS == 1 && configTLS_STATIC_SIZE > 0 )
+		else if( ulElapsed > 0UL )
 		{
-			/* Switch TLS pointer */
-			_set_tls( &( pxCurrentTCB->ucTls ) );
+			ulLoad = ( ulBusy * ulMaxLoad ) / ulElapsed;
+		}
+		else
+		{
+			ulLoad = 0UL;
 		}
-		#endif
-	}
-}
-/*-----------------------------------------------------------*/
 
-void vTaskPlaceOnEventList( List_t * const pxEventList, const TickType_t xTicksToWait )
-{
-	configASSERT( pxEventList );
+		if( ulLoad > ulMaxLoad )
+		{
+			ulLoad = ulMaxLoad;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 
-	/* THIS FUNCTION MUST BE CALLED WITH EITHER INTERRUPTS DISABLED OR THE
-	SCHEDULER SUSPENDED AND THE QUEUE BEING ACCESSED LOCKED. */
+		/* Keep running sums of the last 10 and 60 samples by removing the
+		sample that drops out of each window as the new one is added. */
+		if( uxLoadSamplesTaken >= ( UBaseType_t ) 10U )
+		{
+			uxOldest = ( uxNextLoadSample + ( UBaseType_t ) taskLOAD_SAMPLES - ( UBaseType_t ) 10U ) % ( UBaseType_t ) taskLOAD_SAMPLES;
+			ulLoadSum10 -= ( uint32_t ) usLoadSamples[ uxOldest ];
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 
-	/* Place the event list item of the TCB in the appropriate event list.
-	This is placed in the list in priority order so the highest priority task
-	is the first to be woken by the event.  The queue that contains the event
-	list is locked, preventing simultaneous access from interrupts. */
-	vListInsert( pxEventList, &( pxCurrentTCB->xEventListItem ) );
-
-	prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
-}
-/*-----------------------------------------------------------*/
+		if( uxLoadSamplesTaken >= ( UBaseType_t ) taskLOAD_SAMPLES )
+		{
+			ulLoadSum60 -= ( uint32_t ) usLoadSamples[ uxNextLoadSample ];
+		}
+		else
+		{
+			( uxLoadSamplesTaken )++;
+		}
 
-void vTaskPlaceOnUnorderedEventList( List_t * pxEventList, const TickType_t xItemValue, const TickType_t xTicksToWait )
-{
-	configASSERT( pxEventList );
+		usLoadSamples[ uxNextLoadSample ] = ( uint16_t ) ulLoad;
+		ulLoadSum10 += ulLoad;
+		ulLoadSum60 += ulLoad;
+		uxNextLoadSample = ( uxNextLoadSample + ( UBaseType_t ) 1U ) % ( UBaseType_t ) taskLOAD_SAMPLES;
 
-	/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
-	the event groups implementation. */
-	configASSERT( uxSchedulerSuspended != 0 );
+		/* Start the next sample. */
+		ulIdleCyclesInSample = 0UL;
+		ulLoadSampleStartCycles = ulNow;
+		xLoadSampleStartTick = xNowTick;
+	}
+	/*-----------------------------------------------------------*/
 
-	/* Store the item value in the event list item.  It is safe to access the
-	event list item here as interrupts won't access the event list item of a
-	task that is not in the Blocked state. */
-	listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+	void vTaskGetLoadAverages( uint16_t * const pusLoad1s, uint16_t * const pusLoad10s, uint16_t * const pusLoad60s )
+	{
+	UBaseType_t uxSamples;
 
-	/* Place the event list item of the TCB at the end of the appropriate event
-	list.  It is safe to access the event list here because it is part of an
-	event group implementation - and interrupts don't access event groups
-	directly (instead they access them indirectly by pending function calls to
-	the task level). */
-	vListInsertEnd( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+		configASSERT( pusLoad1s );
+		configASSERT( pusLoad10s );
+		configASSERT( pusLoad60s );
 
-	prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
-}
-/*-----------------------------------------------------------*/
+		taskENTER_CRITICAL();
+		{
+			if( uxLoadSamplesTaken == ( UBaseType_t ) 0U )
+			{
+				*pusLoad1s = 0U;
+				*pusLoad10s = 0U;
+				*pusLoad60s = 0U;
+			}
+			else
+			{
+				*pusLoad1s = usLoadSamples[ ( uxNextLoadSample + ( UBaseType_t ) taskLOAD_SAMPLES - ( UBaseType_t ) 1U ) % ( UBaseType_t ) taskLOAD_SAMPLES ];
 
-#if( configUSE_TIMERS == 1 )
+				uxSamples = ( uxLoadSamplesTaken < ( UBaseType_t ) 10U ) ? uxLoadSamplesTaken : ( UBaseType_t ) 10U;
+				*pusLoad10s = ( uint16_t ) ( ulLoadSum10 / ( uint32_t ) uxSamples );
+				*pusLoad60s = ( uint16_t ) ( ulLoadSum60 / ( uint32_t ) uxLoadSamplesTaken );
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
 
-	void vTaskPlaceOnEventListRestricted( List_t * const pxEventList, TickType_t xTicksToWait, const BaseType_t xWaitIndefinitely )
-	{
-		configASSERT( pxEventList );
+#endif /* configUSE_LOAD_AVERAGES */
+/*----------------------------------------------------------*/
 
-		/* This function should not be called by application code hence the
-		'Restricted' in its name.  It is not part of the public API.  It is
-		designed for use by kernel code, and has special calling requirements -
-		it should be called with the scheduler suspended. */
+#if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
 
+	TaskHandle_t xTaskGetIdleTaskHandle( void )
+	{
+		/* If xTaskGetIdleTaskHandle() is called before the scheduler has been
+		started, then xIdleTaskHandle will be NULL. */
+		configASSERT( ( xIdleTaskHandle != NULL ) );
+		return xIdleTaskHandle;
+	}
 
-		/* Place the event list item of the TCB in the appropriate event list.
-		In this case it is assume that this is the only task that is going to
-		be waiting on this event list, so the faster vListInsertEnd() function
-		can be used in place of vListInsert. */
-		vListInsertEnd( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+#endif /* INCLUDE_xTaskGetIdleTaskHandle */
+/*----------------------------------------------------------*/
 
-		/* If the task should block indefinitely then set the block time to a
-		value that will be recognised as an indefinite delay inside the
-		prvAddCurrentTaskToDelayedList() function. */
-		if( xWaitIndefinitely != pdFALSE )
-		{
-			xTicksToWait = portMAX_DELAY;
-		}
+/* This conditional compilation should use inequality to 0, not equality to 1.
+This is to ensure vTaskStepTick() is available when user defined low power mode
+implementations require configUSE_TICKLESS_IDLE to be set to a value other than
+1. */
+#if ( configUSE_TICKLESS_IDLE != 0 )
 
-		traceTASK_DELAY_UNTIL( ( xTickCount + xTicksToWait ) );
-		prvAddCurrentTaskToDelayedList( xTicksToWait, xWaitIndefinitely );
+	void vTaskStepTick( const TickType_t xTicksToJump )
+	{
+		/* Correct the tick count value after a period during which the tick
+		was suppressed.  Note this does *not* call the tick hook function for
+		each stepped tick. */
+		configASSERT( ( xTickCount + xTicksToJump ) <= xNextTaskUnblockTime );
+		xTickCount += xTicksToJump;
+		traceINCREASE_TICK_COUNT( xTicksToJump );
 	}
 
-#endif /* configUSE_TIMERS */
-/*-----------------------------------------------------------*/
+#endif /* configUSE_TICKLESS_IDLE */
+/*----------------------------------------------------------*/
 
-BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
+BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
 {
-TCB_t *pxUnblockedTCB;
-BaseType_t xReturn;
+BaseType_t xYieldRequired = pdFALSE;
 
-	/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  It can also be
-	called from a critical section within an ISR. */
+	/* Must not be called with the scheduler suspended as the implementation
+	relies on xPendedTicks being wound down to 0 in xTaskResumeAll(). */
+	configASSERT( uxSchedulerSuspended == 0 );
 
-	/* The event list is sorted in priority order, so the first in the list can
-	be removed as it is known to be the highest priority.  Remove the TCB from
-	the delayed list, and add it to the ready list.
+	/* Use xPendedTicks to mimic xTicksToCatchUp number of ticks occuring when
+	the scheduler is suspended so the ticks are executed in xTaskResumeAll(). */
+	vTaskSuspendAll();
+	xPendedTicks += xTicksToCatchUp;
+	xYieldRequired = xTaskResumeAll();
 
-	If an event is for a queue that is locked then this function will never
-	get called - the lock count on the queue will get modified instead.  This
-	means exclusive access to the event list is guaranteed here.
+	return xYieldRequired;
+}
+/*----------------------------------------------------------*/
 
-	This function assumes that a check has already been made to ensure that
-	pxEventList is not empty. */
-	pxUnblockedTCB = listGET_OWNER_OF_HEAD_ENTRY( pxEventList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-	configASSERT( pxUnblockedTCB );
-	( void ) uxListRemove( &( pxUnblockedTCB->xEventListItem ) );
+#if ( INCLUDE_xTaskAbortDelay == 1 )
 
-	if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+	BaseType_t xTaskAbortDelay( TaskHandle_t xTask )
 	{
-		( void ) uxListRemove( &( pxUnblockedTCB->xStateListItem ) );
-		prvAddTaskToReadyList( pxUnblockedTCB );
+	TCB_t *pxTCB = xTask;
+	BaseType_t xReturn;
 
-		#if( configUSE_TICKLESS_IDLE != 0 )
+		configASSERT( pxTCB );
+
+		vTaskSuspendAll();
 		{
-			/* If a task is blocked on a kernel object then xNextTaskUnblockTime
-			might be set to the blocked task's time out time.  If the task is
-			unblocked for a reason other than a timeout xNextTaskUnblockTime is
-			normally left unchanged, because it is automatically reset to a new
-			value when the tick count equals xNextTaskUnblockTime.  However if
-			tickless idling is used it might be more important to enter sleep mode
-			at the earliest possible time - so reset xNextTaskUnblockTime here to
-			ensure it is updated at the earliest possible time. */
-			prvResetNextTaskUnblockTime();
+			/* A task can only be prematurely removed from the Blocked state if
+			it is actually in the Blocked state. */
+			if( eTaskGetState( xTask ) == eBlocked )
+			{
+				xReturn = pdPASS;
+
+				/* Remove the reference to the task from the blocked list.  An
+				interrupt won't touch the xStateListItem because the
+				scheduler is suspended. */
+				( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+
+				/* Is the task waiting on an event also?  If so remove it from
+				the event list too.  Interrupts can touch the event list item,
+				even though the scheduler is suspended, so a critical section
+				is used. */
+				taskENTER_CRITICAL();
+				{
+					if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+					{
+						( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+						pxTCB->ucDelayAborted = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					#if( configUSE_TASK_RENDEZVOUS == 1 )
+					{
+						/* Nor does an aborted rendezvous call raise the
+						priority of its receiver any longer. */
+						if( prvRendezvousAbandonCall( pxTCB ) != pdFALSE )
+						{
+							xYieldPending = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					#endif /* configUSE_TASK_RENDEZVOUS */
+				}
+				taskEXIT_CRITICAL();
+
+				/* Place the unblocked task into the appropriate ready list. */
+				prvAddTaskToReadyList( pxTCB );
+
+				/* A task being unblocked cannot cause an immediate context
+				switch if preemption is turned off. */
+				#if (  configUSE_PREEMPTION == 1 )
+				{
+					/* Preemption is on, but a context switch should only be
+					performed if the unblocked task has a priority that is
+					equal to or higher than the currently executing task. */
+					if( taskTASK_PREEMPTS_CURRENT( pxTCB ) )
+					{
+						/* Pend the yield to be performed when the scheduler
+						is unsuspended. */
+						xYieldPending = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_PREEMPTION */
+			}
+			else
+			{
+				xReturn = pdFAIL;
+			}
 		}
-		#endif
-	}
-	else
-	{
-		/* The delayed and ready lists cannot be accessed, so hold this task
-		pending until the scheduler is resumed. */
-		vListInsertEnd( &( xPendingReadyList ), &( pxUnblockedTCB->xEventListItem ) );
+		( void ) xTaskResumeAll();
+
+		return xReturn;
 	}
 
-	if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
-	{
-		/* Return true if the task removed from the event list has a higher
-		priority than the calling task.  This allows the calling task to know if
-		it should force a context switch now. */
-		xReturn = pdTRUE;
+#endif /* INCLUDE_xTaskAbortDelay */
+/*----------------------------------------------------------*/
 
-		/* Mark that a yield is pending in case the user is not using the
-		"xHigherPriorityTaskWoken" parameter to an ISR safe FreeRTOS function. */
-		xYieldPending = pdTRUE;
-	}
-	else
+BaseType_t xTaskIncrementTick( void )
+{
+TCB_t * pxTCB;
+#if ( configUSE_DELAYED_TASK_WHEEL == 0 )
+	TickCount_t xItemValue;
+#endif
+BaseType_t xSwitchRequired = pdFALSE;
+#if ( configNUM_CORES > 1 )
+	UBaseType_t uxSavedInterruptStatus;
+#endif
+
+	#if ( configNUM_CORES > 1 )
 	{
-		xReturn = pdFALSE;
+		/* Only one core takes the tick, but the lists it walks are shared
+		with the other cores, so the ISR lock is held as by any interrupt
+		safe critical section.  The task lock is not taken, as it is held by
+		a core that has suspended the scheduler for as long as the scheduler
+		is suspended.  The tick is pended instead, whichever core suspended
+		the scheduler. */
+		uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
 	}
+	#endif /* configNUM_CORES */
 
-	return xReturn;
-}
-/*-----------------------------------------------------------*/
+	/* Called by the portable layer each time a tick interrupt occurs.
+	Increments the tick then checks to see if the new tick value will cause any
+	tasks to be unblocked. */
+	traceTASK_INCREMENT_TICK( xTickCount );
+	if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+	{
+		/* Minor optimisation.  The tick count cannot change in this
+		block. */
+		const TickCount_t xConstTickCount = xTickCount + ( TickCount_t ) 1;
 
-void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem, const TickType_t xItemValue )
-{
-TCB_t *pxUnblockedTCB;
+		/* Increment the RTOS tick, switching the delayed and overflowed
+		delayed lists if it wraps to 0.  A 64-bit tick count does not wrap. */
+		xTickCount = xConstTickCount;
+
+		#if( configUSE_LOAD_AVERAGES == 1 )
+		{
+			if( ( TickType_t ) ( xConstTickCount - xLoadSampleStartTick ) >= ( TickType_t ) configTICK_RATE_HZ )
+			{
+				prvTakeLoadSample( xConstTickCount );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_LOAD_AVERAGES */
+
+		#if( configUSE_64_BIT_TICK_COUNT == 0 )
+		{
+			if( xConstTickCount == ( TickType_t ) 0U ) /*lint !e774 'if' does not always evaluate to false as it is looking for an overflow. */
+			{
+				taskSWITCH_DELAYED_LISTS();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_64_BIT_TICK_COUNT */
+
+		/* See if this tick has made a timeout expire.  Tasks are stored in
+		the	queue in the order of their wake time - meaning once one task
+		has been found whose block time has not expired there is no need to
+		look any further down the list. */
+		if( xConstTickCount >= xNextTaskUnblockTime )
+		{
+			#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+			{
+			List_t * const pxSlot = &( xDelayedTaskWheel[ taskDELAYED_WHEEL_SLOT( xConstTickCount ) ] );
+			ListItem_t const * const pxSlotEnd = listGET_END_MARKER( pxSlot );
+			ListItem_t *pxItem, *pxNextItem;
+
+				/* Only the slot of this tick can hold tasks to unblock, the
+				others in it are whole turns of the wheel away. */
+				for( pxItem = listGET_HEAD_ENTRY( pxSlot ); pxItem != pxSlotEnd; pxItem = pxNextItem )
+				{
+					pxNextItem = listGET_NEXT( pxItem );
+
+					if( listGET_LIST_ITEM_VALUE( pxItem ) == xConstTickCount )
+					{
+						pxTCB = listGET_LIST_ITEM_OWNER( pxItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+						if( prvUnblockDelayedTask( pxTCB ) != pdFALSE )
+						{
+							xSwitchRequired = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+
+				xNextTaskUnblockTime = prvGetNextDelayedWheelTime( xConstTickCount + ( TickCount_t ) 1 );
+			}
+			#else
+			for( ;; )
+			{
+				if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+				{
+					/* The delayed list is empty.  Set xNextTaskUnblockTime
+					to the maximum possible value so it is extremely
+					unlikely that the
+					if( xTickCount >= xNextTaskUnblockTime ) test will pass
+					next time through. */
+					xNextTaskUnblockTime = portMAX_TICK_COUNT; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+					break;
+				}
+				else
+				{
+					/* The delayed list is not empty, get the value of the
+					item at the head of the delayed list.  This is the time
+					at which the task at the head of the delayed list must
+					be removed from the Blocked state. */
+					pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+					xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
+
+					if( xConstTickCount < xItemValue )
+					{
+						/* It is not time to unblock this item yet, but the
+						item value is the time at which the task at the head
+						of the blocked list must be removed from the Blocked
+						state -	so record the item value in
+						xNextTaskUnblockTime. */
+						xNextTaskUnblockTime = xItemValue;
+						break; /*lint !e9011 Code structure here is deedmed easier to understand with multiple breaks. */
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					/* It is time to remove the item from the Blocked state. */
+					if( prvUnblockDelayedTask( pxTCB ) != pdFALSE )
+					{
+						xSwitchRequired = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+			}
+			#endif /* configUSE_DELAYED_TASK_WHEEL */
+		}
+
+		#if( configUSE_TASK_BUDGETS == 1 )
+		{
+		uint32_t ulNow;
+
+			/* vTaskStepTick() can move the tick count past the replenishment
+			time, so look for it having passed rather than for it being
+			reached.  The replenishment time is never more than a budget
+			period ahead, so it is in the past if it is less than half the
+			tick range behind the tick count. */
+			if( ( listLIST_IS_EMPTY( &xBudgetExhaustedTaskList ) == pdFALSE ) && ( ( TickType_t ) ( ( TickType_t ) xConstTickCount - xNextBudgetReplenishTime ) < ( TickType_t ) ( portMAX_DELAY >> 1 ) ) )
+			{
+				if( prvTaskBudgetReplenish( ( TickType_t ) xConstTickCount ) != pdFALSE )
+				{
+					xSwitchRequired = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Charge the running task as it goes, so a task that never
+			blocks still loses its priority once its budget is used. */
+			taskBUDGET_GET_RUN_TIME_COUNTER( ulNow );
+			if( prvTaskBudgetCharge( ulNow ) != pdFALSE )
+			{
+				xSwitchRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_TASK_BUDGETS */
+
+		/* Tasks of equal priority to the currently running task will share
+		processing time (time slice) if preemption is on, and the application
+		writer has not explicitly turned time slicing off. */
+		#if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+		{
+			#if ( configNUM_CORES > 1 )
+			{
+			BaseType_t xCoreID, xOtherCoreID;
+			UBaseType_t uxPriority, uxRunningAtPriority;
+
+				/* A core only needs to switch if the ready list at the
+				priority it is running holds more tasks than there are cores
+				running at that priority. */
+				for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUM_CORES; xCoreID++ )
+				{
+					uxPriority = pxCurrentTCBs[ xCoreID ]->uxPriority;
+					uxRunningAtPriority = 0U;
+
+					for( xOtherCoreID = 0; xOtherCoreID < ( BaseType_t ) configNUM_CORES; xOtherCoreID++ )
+					{
+						if( pxCurrentTCBs[ xOtherCoreID ]->uxPriority == uxPriority )
+						{
+							uxRunningAtPriority++;
+						}
+					}
+
+					if( ( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxPriority ] ) ) > uxRunningAtPriority ) && ( taskTIME_SLICE_EXPIRED( pxCurrentTCBs[ xCoreID ] ) != pdFALSE ) )
+					{
+						if( xCoreID == ( BaseType_t ) portGET_CORE_ID() )
+						{
+							xSwitchRequired = pdTRUE;
+						}
+						else
+						{
+							portYIELD_CORE( xCoreID );
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+			}
+			#else
+			{
+				if( ( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 ) && ( taskTIME_SLICE_EXPIRED( pxCurrentTCB ) != pdFALSE ) )
+				{
+					xSwitchRequired = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configNUM_CORES */
+		}
+		#endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
+
+		#if ( configUSE_TICK_HOOK == 1 )
+		{
+			/* Guard against the tick hook being called when the pended tick
+			count is being unwound (when the scheduler is being unlocked). */
+			if( xPendedTicks == ( TickType_t ) 0 )
+			{
+				vApplicationTickHook();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_TICK_HOOK */
+	}
+	else
+	{
+		++xPendedTicks;
+
+		/* The tick hook gets called at regular intervals, even if the
+		scheduler is locked. */
+		#if ( configUSE_TICK_HOOK == 1 )
+		{
+			vApplicationTickHook();
+		}
+		#endif
+	}
+
+	#if ( configUSE_PREEMPTION == 1 )
+	{
+		if( xYieldPending != pdFALSE )
+		{
+			xSwitchRequired = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configUSE_PREEMPTION */
+
+	#if ( configNUM_CORES > 1 )
+	{
+		taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+	}
+	#endif /* configNUM_CORES */
+
+	return xSwitchRequired;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+
+	void vTaskSetApplicationTaskTag( TaskHandle_t xTask, TaskHookFunction_t pxHookFunction )
+	{
+	TCB_t *xTCB;
+
+		/* If xTask is NULL then it is the task hook of the calling task that is
+		getting set. */
+		if( xTask == NULL )
+		{
+			xTCB = ( TCB_t * ) pxCurrentTCB;
+		}
+		else
+		{
+			xTCB = xTask;
+		}
+
+		/* Save the hook function in the TCB.  A critical section is required as
+		the value can be accessed from an interrupt. */
+		taskENTER_CRITICAL();
+		{
+			xTCB->pxTaskTag = pxHookFunction;
+		}
+		taskEXIT_CRITICAL();
+	}
+
+#endif /* configUSE_APPLICATION_TASK_TAG */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+
+	TaskHookFunction_t xTaskGetApplicationTaskTag( TaskHandle_t xTask )
+	{
+	TCB_t *pxTCB;
+	TaskHookFunction_t xReturn;
+
+		/* If xTask is NULL then set the calling task's hook. */
+		pxTCB = prvGetTCBFromHandle( xTask );
+
+		/* Save the hook function in the TCB.  A critical section is required as
+		the value can be accessed from an interrupt. */
+		taskENTER_CRITICAL();
+		{
+			xReturn = pxTCB->pxTaskTag;
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_APPLICATION_TASK_TAG */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+
+	TaskHookFunction_t xTaskGetApplicationTaskTagFromISR( TaskHandle_t xTask )
+	{
+	TCB_t *pxTCB;
+	TaskHookFunction_t xReturn;
+	UBaseType_t uxSavedInterruptStatus;
+
+		/* If xTask is NULL then set the calling task's hook. */
+		pxTCB = prvGetTCBFromHandle( xTask );
+
+		/* Save the hook function in the TCB.  A critical section is required as
+		the value can be accessed from an interrupt. */
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			xReturn = pxTCB->pxTaskTag;
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return xReturn;
+	}
+
+#endif /* configUSE_APPLICATION_TASK_TAG */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+
+	BaseType_t xTaskCallApplicationTaskHook( TaskHandle_t xTask, void *pvParameter )
+	{
+	TCB_t *xTCB;
+	BaseType_t xReturn;
+
+		/* If xTask is NULL then we are calling our own task hook. */
+		if( xTask == NULL )
+		{
+			xTCB = pxCurrentTCB;
+		}
+		else
+		{
+			xTCB = xTask;
+		}
+
+		if( xTCB->pxTaskTag != NULL )
+		{
+			xReturn = xTCB->pxTaskTag( pvParameter );
+		}
+		else
+		{
+			xReturn = pdFAIL;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_APPLICATION_TASK_TAG */
+/*-----------------------------------------------------------*/
+
+#if ( configNUM_CORES > 1 )
+
+	static BaseType_t prvYieldForTask( const TCB_t * const pxTCB )
+	{
+	BaseType_t xCoreID, xTargetCoreID = taskTASK_NOT_RUNNING;
+	const BaseType_t xThisCoreID = ( BaseType_t ) portGET_CORE_ID();
+	UBaseType_t uxTargetPriority = pxTCB->uxPriority;
+	UBaseType_t uxCorePriority;
+	BaseType_t xReturn = pdFALSE;
+
+		if( xSchedulerRunning != pdFALSE )
+		{
+			/* Look for the core running the lowest priority task below the
+			priority of pxTCB.  The calling core is preferred on a tie as it
+			does not need to be interrupted, and other cores that already have
+			a yield pending are skipped as they will reschedule anyway. */
+			for( xCoreID = 0; xCoreID < ( BaseType_t ) configNUM_CORES; xCoreID++ )
+			{
+				if( taskCORE_IS_ALLOWED( pxTCB, xCoreID ) && ( ( xCoreID == xThisCoreID ) || ( xYieldPendings[ xCoreID ] == pdFALSE ) ) )
+				{
+					uxCorePriority = pxCurrentTCBs[ xCoreID ]->uxPriority;
+
+					if( ( uxCorePriority < uxTargetPriority ) ||
+						( ( uxCorePriority == uxTargetPriority ) && ( xCoreID == xThisCoreID ) && ( xTargetCoreID != taskTASK_NOT_RUNNING ) ) )
+					{
+						xTargetCoreID = xCoreID;
+						uxTargetPriority = uxCorePriority;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+
+			if( xTargetCoreID == xThisCoreID )
+			{
+				xReturn = pdTRUE;
+			}
+			else if( xTargetCoreID != taskTASK_NOT_RUNNING )
+			{
+				/* A task readied by this core is never allowed to preempt
+				another core when the co-operative scheduler is used. */
+				#if ( configUSE_PREEMPTION == 1 )
+				{
+					xYieldPendings[ xTargetCoreID ] = pdTRUE;
+					portYIELD_CORE( xTargetCoreID );
+				}
+				#endif /* configUSE_PREEMPTION */
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configNUM_CORES */
+/*-----------------------------------------------------------*/
+
+#if ( configNUM_CORES > 1 )
+
+	static void prvSelectHighestPriorityTask( const BaseType_t xCoreID )
+	{
+	UBaseType_t uxTopPriority;
+	UBaseType_t uxTasksToCheck;
+	TCB_t *pxTCB = NULL;
+	TCB_t *pxCandidateTCB;
+
+		/* The task being switched out may be selected again, so it must not
+		be skipped as running elsewhere. */
+		if( pxCurrentTCBs[ xCoreID ] != NULL )
+		{
+			pxCurrentTCBs[ xCoreID ]->xTaskRunState = taskTASK_NOT_RUNNING;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Find the highest priority queue that contains ready tasks. */
+		#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
+		{
+			uxTopPriority = uxTopReadyPriority;
+
+			while( listLIST_IS_EMPTY( &( pxReadyTasksLists[ uxTopPriority ] ) ) )
+			{
+				configASSERT( uxTopPriority );
+				--uxTopPriority;
+			}
+
+			uxTopReadyPriority = uxTopPriority;
+		}
+		#else
+		{
+			portGET_HIGHEST_PRIORITY( uxTopPriority, uxTopReadyPriority );
+		}
+		#endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+
+		/* Work down from the highest priority.  Tasks already running on
+		another core, or not allowed to run on this one, are skipped.  There is
+		an idle task for each core so the search always ends at the idle
+		priority at the latest. */
+		for( ;; )
+		{
+			/* listGET_OWNER_OF_NEXT_ENTRY indexes through the list, so the
+			tasks of the same priority get an equal share of the cores. */
+			for( uxTasksToCheck = listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxTopPriority ] ) ); uxTasksToCheck > 0U; uxTasksToCheck-- )
+			{
+				listGET_OWNER_OF_NEXT_ENTRY( pxCandidateTCB, &( pxReadyTasksLists[ uxTopPriority ] ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+				if( ( pxCandidateTCB->xTaskRunState == taskTASK_NOT_RUNNING ) && taskCORE_IS_ALLOWED( pxCandidateTCB, xCoreID ) )
+				{
+					pxTCB = pxCandidateTCB;
+					break;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+
+			if( pxTCB != NULL )
+			{
+				break;
+			}
+
+			configASSERT( uxTopPriority > tskIDLE_PRIORITY );
+			--uxTopPriority;
+		}
+
+		pxTCB->xTaskRunState = xCoreID;
+		pxCurrentTCBs[ xCoreID ] = pxTCB;
+	}
+
+#endif /* configNUM_CORES */
+/*-----------------------------------------------------------*/
+
+void vTaskSwitchContext( void )
+{
+	#if ( configNUM_CORES > 1 )
+	{
+		/* Called with interrupts masked.  Only the ISR lock is taken, so the
+		switch does not wait for a core that has suspended the scheduler, and
+		is pended until xTaskResumeAll() instead. */
+		portGET_ISR_LOCK();
+	}
+	#endif /* configNUM_CORES */
+
+	if( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE )
+	{
+		/* The scheduler is currently suspended - do not allow a context
+		switch. */
+		xYieldPending = pdTRUE;
+	}
+	else
+	{
+		xYieldPending = pdFALSE;
+		traceTASK_SWITCHED_OUT();
+
+		#if ( configGENERATE_RUN_TIME_STATS == 1 )
+		{
+			#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+				portALT_GET_RUN_TIME_COUNTER_VALUE( ulTotalRunTime );
+			#else
+				ulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
+			#endif
+
+			/* Add the amount of time the task has been running to the
+			accumulated time so far.  The time the task started running was
+			stored in ulTaskSwitchedInTime.  Note that there is no overflow
+			protection here so count values are only valid until the timer
+			overflows.  The guard against negative values is to protect
+			against suspect run time stat counter implementations - which
+			are provided by the application, not the kernel. */
+			if( ulTotalRunTime > ulTaskSwitchedInTime )
+			{
+				pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime - ulTaskSwitchedInTime );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+			ulTaskSwitchedInTime = ulTotalRunTime;
+		}
+		#endif /* configGENERATE_RUN_TIME_STATS */
+
+		#if( configUSE_TASK_BUDGETS == 1 )
+		{
+			/* Charge the task being switched out before the next task is
+			selected, as using up its budget lowers its priority. */
+			( void ) prvTaskBudgetCharge( ulTotalRunTime );
+		}
+		#endif /* configUSE_TASK_BUDGETS */
+
+		#if( configUSE_LOAD_AVERAGES == 1 )
+		{
+			if( pxCurrentTCB == xIdleTaskHandle )
+			{
+				prvChargeIdleTime( portGET_CYCLE_COUNT() );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_LOAD_AVERAGES */
+
+		/* Check for stack overflow, if configured. */
+		taskCHECK_FOR_STACK_OVERFLOW();
+
+		#if( configUSE_INCREMENTAL_STACK_HIGH_WATER_MARK == 1 )
+		{
+			prvSampleStackHighWaterMark( pxCurrentTCB );
+		}
+		#endif
+
+		/* Before the currently running task is switched out, save its errno. */
+		#if( configUSE_POSIX_ERRNO == 1 )
+		{
+			pxCurrentTCB->iTaskErrno = FreeRTOS_errno;
+		}
+		#endif
+
+		/* Select a new task to run using either the generic C or port
+		optimised asm code. */
+		#if ( configNUM_CORES > 1 )
+		{
+			prvSelectHighestPriorityTask( ( BaseType_t ) portGET_CORE_ID() );
+		}
+		#else
+		{
+			taskSELECT_HIGHEST_PRIORITY_TASK(); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+			#if( configUSE_EDF_SCHEDULING == 1 )
+			{
+				prvEDFSelectTask();
+			}
+			#endif /* configUSE_EDF_SCHEDULING */
+
+			#if( configUSE_TASK_RENDEZVOUS == 1 )
+			{
+				/* A task given the processor by a rendezvous runs ahead of the
+				other tasks of its priority, unless a higher priority task has
+				become ready since.  Round robin continues from it. */
+				if( pxRendezvousHandoffTCB != NULL )
+				{
+					if( ( pxRendezvousHandoffTCB->uxPriority == pxCurrentTCB->uxPriority ) &&
+						( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ), &( pxRendezvousHandoffTCB->xStateListItem ) ) != pdFALSE ) )
+					{
+						pxReadyTasksLists[ pxCurrentTCB->uxPriority ].pxIndex = &( pxRendezvousHandoffTCB->xStateListItem );
+						pxCurrentTCB = pxRendezvousHandoffTCB;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					pxRendezvousHandoffTCB = NULL;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configUSE_TASK_RENDEZVOUS */
+
+			#if( configUSE_BASIC_TASKS == 1 )
+			{
+				prvSelectBasicTask();
+			}
+			#endif /* configUSE_BASIC_TASKS */
+		}
+		#endif /* configNUM_CORES */
+
+		#if( configUSE_LOAD_AVERAGES == 1 )
+		{
+			/* The idle task is charged from the time it is switched in. */
+			ulIdleChargedUpTo = portGET_CYCLE_COUNT();
+		}
+		#endif /* configUSE_LOAD_AVERAGES */
+
+		#if( configUSE_WAKEUP_LATENCY_STATS == 1 )
+		{
+			if( pxCurrentTCB->ucLatencyPending != pdFALSE )
+			{
+				prvRecordWakeupLatency( pxCurrentTCB, portGET_CYCLE_COUNT() - pxCurrentTCB->ulWakeTime );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_WAKEUP_LATENCY_STATS */
+
+		traceTASK_SWITCHED_IN();
+
+		/* After the new task is switched in, update the global errno. */
+		#if( configUSE_POSIX_ERRNO == 1 )
+		{
+			FreeRTOS_errno = pxCurrentTCB->iTaskErrno;
+		}
+		#endif
+
+		#if ( configUSE_NEWLIB_REENTRANT == 1 )
+		{
+			/* Switch Newlib's _impure_ptr variable to point to the _reent
+			structure specific to this task. */
+			_impure_ptr = &( pxCurrentTCB->xNewLib_reent );
+		}
+		#endif /* configUSE_NEWLIB_REENTRANT */
+		#if ( configUSE_PICOLIBC_TLS == 1 && portTLS_IN_TASK_CONTEXT == 0 && configTLS_STATIC_SIZE > 0 )
+		{
+			/* Switch TLS pointer */
+			_set_tls( &( pxCurrentTCB->ucTls ) );
+		}
+		#endif
+	}
+
+	#if ( configNUM_CORES > 1 )
+	{
+		portRELEASE_ISR_LOCK();
+	}
+	#endif /* configNUM_CORES */
+}
+/*-----------------------------------------------------------*/
+
+void vTaskPlaceOnEventList( List_t * const pxEventList, const TickType_t xTicksToWait )
+{
+	configASSERT( pxEventList );
+
+	/* THIS FUNCTION MUST BE CALLED WITH EITHER INTERRUPTS DISABLED OR THE
+	SCHEDULER SUSPENDED AND THE QUEUE BEING ACCESSED LOCKED. */
+
+	/* Place the event list item of the TCB in the appropriate event list.
+	This is placed in the list in priority order so the highest priority task
+	is the first to be woken by the event.  The queue that contains the event
+	list is locked, preventing simultaneous access from interrupts. */
+	vListInsert( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+
+	prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+}
+/*-----------------------------------------------------------*/
+
+void vTaskPlaceOnUnorderedEventList( List_t * pxEventList, const TickType_t xItemValue, const TickType_t xTicksToWait )
+{
+	configASSERT( pxEventList );
+
+	/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
+	the event groups implementation. */
+	configASSERT( uxSchedulerSuspended != 0 );
+
+	/* Store the item value in the event list item.  It is safe to access the
+	event list item here as interrupts won't access the event list item of a
+	task that is not in the Blocked state. */
+	listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+
+	/* Place the event list item of the TCB at the end of the appropriate event
+	list.  It is safe to access the event list here because it is part of an
+	event group implementation - and interrupts don't access event groups
+	directly (instead they access them indirectly by pending function calls to
+	the task level). */
+	vListInsertEnd( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+
+	prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TIMERS == 1 )
+
+	void vTaskPlaceOnEventListRestricted( List_t * const pxEventList, TickType_t xTicksToWait, const BaseType_t xWaitIndefinitely )
+	{
+		configASSERT( pxEventList );
+
+		/* This function should not be called by application code hence the
+		'Restricted' in its name.  It is not part of the public API.  It is
+		designed for use by kernel code, and has special calling requirements -
+		it should be called with the scheduler suspended. */
+
+
+		/* Place the event list item of the TCB in the appropriate event list.
+		In this case it is assume that this is the only task that is going to
+		be waiting on this event list, so the faster vListInsertEnd() function
+		can be used in place of vListInsert. */
+		vListInsertEnd( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+
+		/* If the task should block indefinitely then set the block time to a
+		value that will be recognised as an indefinite delay inside the
+		prvAddCurrentTaskToDelayedList() function. */
+		if( xWaitIndefinitely != pdFALSE )
+		{
+			xTicksToWait = portMAX_DELAY;
+		}
+
+		traceTASK_DELAY_UNTIL( ( xTickCount + xTicksToWait ) );
+		prvAddCurrentTaskToDelayedList( xTicksToWait, xWaitIndefinitely );
+	}
+
+#endif /* configUSE_TIMERS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_PRIORITY_EVENT_LISTS == 1 )
+
+	void vTaskPlaceOnPriorityEventList( PriorityList_t * const pxEventList, const TickType_t xTicksToWait )
+	{
+		configASSERT( pxEventList );
+
+		/* THIS FUNCTION MUST BE CALLED WITH EITHER INTERRUPTS DISABLED OR THE
+		SCHEDULER SUSPENDED AND THE QUEUE BEING ACCESSED LOCKED. */
+
+		/* Tasks of the same priority are woken in the order in which they
+		blocked, as they would be by vTaskPlaceOnEventList(), but without
+		walking the tasks that are already waiting. */
+		vListInsertPriority( pxEventList, &( pxCurrentTCB->xEventListItem ), pxCurrentTCB->uxPriority );
+
+		prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+	}
+
+#endif /* configUSE_PRIORITY_EVENT_LISTS */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_PRIORITY_EVENT_LISTS == 1 ) && ( configUSE_TIMERS == 1 ) )
+
+	void vTaskPlaceOnPriorityEventListRestricted( PriorityList_t * const pxEventList, TickType_t xTicksToWait, const BaseType_t xWaitIndefinitely )
+	{
+		configASSERT( pxEventList );
+
+		/* As vTaskPlaceOnEventListRestricted(). */
+		vListInsertPriority( pxEventList, &( pxCurrentTCB->xEventListItem ), pxCurrentTCB->uxPriority );
+
+		if( xWaitIndefinitely != pdFALSE )
+		{
+			xTicksToWait = portMAX_DELAY;
+		}
+
+		traceTASK_DELAY_UNTIL( ( xTickCount + xTicksToWait ) );
+		prvAddCurrentTaskToDelayedList( xTicksToWait, xWaitIndefinitely );
+	}
+
+#endif /* configUSE_PRIORITY_EVENT_LISTS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_PRIORITY_EVENT_LISTS == 1 )
+
+	BaseType_t xTaskRemoveFromPriorityEventList( PriorityList_t * const pxEventList )
+	{
+	ListItem_t *pxHighestPriorityItem;
+
+		/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  It can also be
+		called from a critical section within an ISR.  As with
+		xTaskRemoveFromEventList(), a check must already have been made to
+		ensure pxEventList is not empty. */
+		pxHighestPriorityItem = pxListGetHighestPriorityItem( pxEventList );
+		configASSERT( pxHighestPriorityItem );
+
+		/* The task to unblock is at the head of the list of its priority. */
+		return xTaskRemoveFromEventList( listLIST_ITEM_CONTAINER( pxHighestPriorityItem ) );
+	}
+
+#endif /* configUSE_PRIORITY_EVENT_LISTS */
+/*-----------------------------------------------------------*/
+
+BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
+{
+TCB_t *pxUnblockedTCB;
+BaseType_t xReturn;
+
+	/* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  It can also be
+	called from a critical section within an ISR. */
+
+	/* The event list is sorted in priority order, so the first in the list can
+	be removed as it is known to be the highest priority.  Remove the TCB from
+	the delayed list, and add it to the ready list.
+
+	If an event is for a queue that is locked then this function will never
+	get called - the lock count on the queue will get modified instead.  This
+	means exclusive access to the event list is guaranteed here.
+
+	This function assumes that a check has already been made to ensure that
+	pxEventList is not empty. */
+	pxUnblockedTCB = listGET_OWNER_OF_HEAD_ENTRY( pxEventList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+	configASSERT( pxUnblockedTCB );
+	( void ) uxListRemove( &( pxUnblockedTCB->xEventListItem ) );
+
+	if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+	{
+		( void ) uxListRemove( &( pxUnblockedTCB->xStateListItem ) );
+		prvAddTaskToReadyList( pxUnblockedTCB );
+
+		#if( configUSE_TICKLESS_IDLE != 0 )
+		{
+			/* If a task is blocked on a kernel object then xNextTaskUnblockTime
+			might be set to the blocked task's time out time.  If the task is
+			unblocked for a reason other than a timeout xNextTaskUnblockTime is
+			normally left unchanged, because it is automatically reset to a new
+			value when the tick count equals xNextTaskUnblockTime.  However if
+			tickless idling is used it might be more important to enter sleep mode
+			at the earliest possible time - so reset xNextTaskUnblockTime here to
+			ensure it is updated at the earliest possible time. */
+			prvResetNextTaskUnblockTime();
+		}
+		#endif
+	}
+	else
+	{
+		/* The delayed and ready lists cannot be accessed, so hold this task
+		pending until the scheduler is resumed. */
+		vListInsertEnd( &( xPendingReadyList ), &( pxUnblockedTCB->xEventListItem ) );
+		taskRECORD_WAKE_TIME( pxUnblockedTCB );
+	}
+
+	if( taskTASK_PREEMPTS_CURRENT( pxUnblockedTCB ) )
+	{
+		/* Return true if the task removed from the event list has a higher
+		priority than the calling task.  This allows the calling task to know if
+		it should force a context switch now. */
+		xReturn = pdTRUE;
+
+		/* Mark that a yield is pending in case the user is not using the
+		"xHigherPriorityTaskWoken" parameter to an ISR safe FreeRTOS function. */
+		xYieldPending = pdTRUE;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem, const TickType_t xItemValue )
+{
+TCB_t *pxUnblockedTCB;
 
 	/* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
 	the event flags implementation. */
 	configASSERT( uxSchedulerSuspended != pdFALSE );
 
-	/* Store the new item value in the event list. */
-	listSET_LIST_ITEM_VALUE( pxEventListItem, xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+	/* Store the new item value in the event list. */
+	listSET_LIST_ITEM_VALUE( pxEventListItem, xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+
+	/* Remove the event list form the event flag.  Interrupts do not access
+	event flags. */
+	pxUnblockedTCB = listGET_LIST_ITEM_OWNER( pxEventListItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+	configASSERT( pxUnblockedTCB );
+	( void ) uxListRemove( pxEventListItem );
+
+	/* Remove the task from the delayed list and add it to the ready list.  The
+	scheduler is suspended so interrupts will not be accessing the ready
+	lists. */
+	( void ) uxListRemove( &( pxUnblockedTCB->xStateListItem ) );
+	prvAddTaskToReadyList( pxUnblockedTCB );
+
+	if( taskTASK_PREEMPTS_CURRENT( pxUnblockedTCB ) )
+	{
+		/* The unblocked task has a priority above that of the calling task, so
+		a context switch is required.  This function is called with the
+		scheduler suspended so xYieldPending is set so the context switch
+		occurs immediately that the scheduler is resumed (unsuspended). */
+		xYieldPending = pdTRUE;
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut )
+{
+	configASSERT( pxTimeOut );
+	taskENTER_CRITICAL();
+	{
+		pxTimeOut->xOverflowCount = xNumOfOverflows;
+		pxTimeOut->xTimeOnEntering = ( TickType_t ) xTickCount;
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vTaskInternalSetTimeOutState( TimeOut_t * const pxTimeOut )
+{
+	/* For internal use only as it does not use a critical section. */
+	pxTimeOut->xOverflowCount = xNumOfOverflows;
+	pxTimeOut->xTimeOnEntering = ( TickType_t ) xTickCount;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xTaskCheckForTimeOut( TimeOut_t * const pxTimeOut, TickType_t * const pxTicksToWait )
+{
+BaseType_t xReturn;
+
+	configASSERT( pxTimeOut );
+	configASSERT( pxTicksToWait );
+
+	taskENTER_CRITICAL();
+	{
+		/* Minor optimisation.  The tick count cannot change in this block. */
+		const TickType_t xConstTickCount = ( TickType_t ) xTickCount;
+		const TickType_t xElapsedTime = xConstTickCount - pxTimeOut->xTimeOnEntering;
+
+		#if( INCLUDE_xTaskAbortDelay == 1 )
+			if( pxCurrentTCB->ucDelayAborted != ( uint8_t ) pdFALSE )
+			{
+				/* The delay was aborted, which is not the same as a time out,
+				but has the same result. */
+				pxCurrentTCB->ucDelayAborted = pdFALSE;
+				xReturn = pdTRUE;
+			}
+			else
+		#endif
+
+		#if ( INCLUDE_vTaskSuspend == 1 )
+			if( *pxTicksToWait == portMAX_DELAY )
+			{
+				/* If INCLUDE_vTaskSuspend is set to 1 and the block time
+				specified is the maximum block time then the task should block
+				indefinitely, and therefore never time out. */
+				xReturn = pdFALSE;
+			}
+			else
+		#endif
+
+		if( ( xNumOfOverflows != pxTimeOut->xOverflowCount ) && ( xConstTickCount >= pxTimeOut->xTimeOnEntering ) ) /*lint !e525 Indentation preferred as is to make code within pre-processor directives clearer. */
+		{
+			/* The tick count is greater than the time at which
+			vTaskSetTimeout() was called, but has also overflowed since
+			vTaskSetTimeOut() was called.  It must have wrapped all the way
+			around and gone past again. This passed since vTaskSetTimeout()
+			was called. */
+			xReturn = pdTRUE;
+		}
+		else if( xElapsedTime < *pxTicksToWait ) /*lint !e961 Explicit casting is only redundant with some compilers, whereas others require it to prevent integer conversion errors. */
+		{
+			/* Not a genuine timeout. Adjust parameters for time remaining. */
+			*pxTicksToWait -= xElapsedTime;
+			vTaskInternalSetTimeOutState( pxTimeOut );
+			xReturn = pdFALSE;
+		}
+		else
+		{
+			*pxTicksToWait = 0;
+			xReturn = pdTRUE;
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vTaskMissedYield( void )
+{
+	xYieldPending = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	UBaseType_t uxTaskGetTaskNumber( TaskHandle_t xTask )
+	{
+	UBaseType_t uxReturn;
+	TCB_t const *pxTCB;
+
+		if( xTask != NULL )
+		{
+			pxTCB = xTask;
+			uxReturn = pxTCB->uxTaskNumber;
+		}
+		else
+		{
+			uxReturn = 0U;
+		}
+
+		return uxReturn;
+	}
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	void vTaskSetTaskNumber( TaskHandle_t xTask, const UBaseType_t uxHandle )
+	{
+	TCB_t * pxTCB;
+
+		if( xTask != NULL )
+		{
+			pxTCB = xTask;
+			pxTCB->uxTaskNumber = uxHandle;
+		}
+	}
+
+#endif /* configUSE_TRACE_FACILITY */
+
+/*
+ * -----------------------------------------------------------
+ * The Idle task.
+ * ----------------------------------------------------------
+ *
+ * The portTASK_FUNCTION() macro is used to allow port/compiler specific
+ * language extensions.  The equivalent prototype for this function is:
+ *
+ * void prvIdleTask( void *pvParameters );
+ *
+ */
+static portTASK_FUNCTION( prvIdleTask, pvParameters )
+{
+	/* Stop warnings. */
+	( void ) pvParameters;
+
+	/** THIS IS THE RTOS IDLE TASK - WHICH IS CREATED AUTOMATICALLY WHEN THE
+	SCHEDULER IS STARTED. **/
+
+	/* In case a task that has a secure context deletes itself, in which case
+	the idle task is responsible for deleting the task's secure context, if
+	any. */
+	portALLOCATE_SECURE_CONTEXT( configMINIMAL_SECURE_STACK_SIZE );
+
+	for( ;; )
+	{
+		/* See if any tasks have deleted themselves - if so then the idle task
+		is responsible for freeing the deleted task's TCB and stack. */
+		prvCheckTasksWaitingTermination();
+
+		#if ( configUSE_PREEMPTION == 0 )
+		{
+			/* If we are not using preemption we keep forcing a task switch to
+			see if any other task has become available.  If we are using
+			preemption we don't need to do this as any task becoming available
+			will automatically get the processor anyway. */
+			taskYIELD();
+		}
+		#endif /* configUSE_PREEMPTION */
+
+		#if ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) )
+		{
+			/* When using preemption tasks of equal priority will be
+			timesliced.  If a task that is sharing the idle priority is ready
+			to run then the idle task should yield before the end of the
+			timeslice.
+
+			A critical region is not required here as we are just reading from
+			the list, and an occasional incorrect value will not matter.  If
+			the ready list at the idle priority contains more than one task
+			then a task other than the idle task is ready to execute.  There is
+			one idle task per core. */
+			if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) configNUM_CORES )
+			{
+				taskYIELD();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) ) */
+
+		#if ( configUSE_IDLE_HOOK == 1 )
+		{
+			extern void vApplicationIdleHook( void );
+
+			/* Call the user defined function from within the idle task.  This
+			allows the application designer to add background functionality
+			without the overhead of a separate task.
+			NOTE: vApplicationIdleHook() MUST NOT, UNDER ANY CIRCUMSTANCES,
+			CALL A FUNCTION THAT MIGHT BLOCK. */
+			vApplicationIdleHook();
+		}
+		#endif /* configUSE_IDLE_HOOK */
+
+		#if ( configUSE_IDLE_WAIT_FOR_INTERRUPT == 1 )
+		{
+			/* Only an interrupt can make another task ready, so stall until
+			one occurs.  Interrupts are disabled between checking that no other
+			task is ready and the wait, otherwise a task readied in between
+			would have to wait for the next interrupt.  A pending interrupt
+			still ends the wait, and is taken once interrupts are enabled. */
+			portDISABLE_INTERRUPTS_FOR_WAIT();
+			{
+				if( ( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) <= ( UBaseType_t ) configNUM_CORES ) && ( xYieldPending == pdFALSE ) )
+				{
+					traceLOW_POWER_IDLE_BEGIN();
+					portWAIT_FOR_INTERRUPT();
+					traceLOW_POWER_IDLE_END();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			portENABLE_INTERRUPTS_AFTER_WAIT();
+		}
+		#endif /* configUSE_IDLE_WAIT_FOR_INTERRUPT */
+
+		/* This conditional compilation should use inequality to 0, not equality
+		to 1.  This is to ensure portSUPPRESS_TICKS_AND_SLEEP() is called when
+		user defined low power mode	implementations require
+		configUSE_TICKLESS_IDLE to be set to a value other than 1. */
+		#if ( configUSE_TICKLESS_IDLE != 0 )
+		{
+		TickType_t xExpectedIdleTime;
+
+			/* It is not desirable to suspend then resume the scheduler on
+			each iteration of the idle task.  Therefore, a preliminary
+			test of the expected idle time is performed without the
+			scheduler suspended.  The result here is not necessarily
+			valid. */
+			xExpectedIdleTime = prvGetExpectedIdleTime();
+
+			if( xExpectedIdleTime >= configEXPECTED_IDLE_TIME_BEFORE_SLEEP )
+			{
+				vTaskSuspendAll();
+				{
+					/* Now the scheduler is suspended, the expected idle
+					time can be sampled again, and this time its value can
+					be used. */
+					configASSERT( xNextTaskUnblockTime >= xTickCount );
+					xExpectedIdleTime = prvGetExpectedIdleTime();
+
+					/* Define the following macro to set xExpectedIdleTime to 0
+					if the application does not want
+					portSUPPRESS_TICKS_AND_SLEEP() to be called. */
+					configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING( xExpectedIdleTime );
+
+					if( xExpectedIdleTime >= configEXPECTED_IDLE_TIME_BEFORE_SLEEP )
+					{
+						traceLOW_POWER_IDLE_BEGIN();
+						portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime );
+						traceLOW_POWER_IDLE_END();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				( void ) xTaskResumeAll();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_TICKLESS_IDLE */
+	}
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TICKLESS_IDLE != 0 )
+
+	eSleepModeStatus eTaskConfirmSleepModeStatus( void )
+	{
+	/* The idle task exists in addition to the application tasks. */
+	const UBaseType_t uxNonApplicationTasks = 1;
+	eSleepModeStatus eReturn = eStandardSleep;
+
+		if( listCURRENT_LIST_LENGTH( &xPendingReadyList ) != 0 )
+		{
+			/* A task was made ready while the scheduler was suspended. */
+			eReturn = eAbortSleep;
+		}
+		else if( xYieldPending != pdFALSE )
+		{
+			/* A yield was pended while the scheduler was suspended. */
+			eReturn = eAbortSleep;
+		}
+		else
+		{
+			/* If all the tasks are in the suspended list (which might mean they
+			have an infinite block time rather than actually being suspended)
+			then it is safe to turn all clocks off and just wait for external
+			interrupts. */
+			if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == ( uxCurrentNumberOfTasks - uxNonApplicationTasks ) )
+			{
+				eReturn = eNoTasksWaitingTimeout;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		return eReturn;
+	}
+
+#endif /* configUSE_TICKLESS_IDLE */
+/*-----------------------------------------------------------*/
+
+#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
+
+	void vTaskSetThreadLocalStoragePointer( TaskHandle_t xTaskToSet, BaseType_t xIndex, void *pvValue )
+	{
+	TCB_t *pxTCB;
+
+		if( xIndex < configNUM_THREAD_LOCAL_STORAGE_POINTERS )
+		{
+			pxTCB = prvGetTCBFromHandle( xTaskToSet );
+			pxTCB->pvThreadLocalStoragePointers[ xIndex ] = pvValue;
+		}
+	}
+
+#endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
+/*-----------------------------------------------------------*/
+
+#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
+
+	void *pvTaskGetThreadLocalStoragePointer( TaskHandle_t xTaskToQuery, BaseType_t xIndex )
+	{
+	void *pvReturn = NULL;
+	TCB_t *pxTCB;
+
+		if( xIndex < configNUM_THREAD_LOCAL_STORAGE_POINTERS )
+		{
+			pxTCB = prvGetTCBFromHandle( xTaskToQuery );
+			pvReturn = pxTCB->pvThreadLocalStoragePointers[ xIndex ];
+		}
+		else
+		{
+			pvReturn = NULL;
+		}
+
+		return pvReturn;
+	}
+
+#endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
+/*-----------------------------------------------------------*/
+
+#if ( portUSING_MPU_WRAPPERS == 1 )
+
+	void vTaskAllocateMPURegions( TaskHandle_t xTaskToModify, const MemoryRegion_t * const xRegions )
+	{
+	TCB_t *pxTCB;
+
+		/* If null is passed in here then we are modifying the MPU settings of
+		the calling task. */
+		pxTCB = prvGetTCBFromHandle( xTaskToModify );
+
+		vPortStoreTaskMPUSettings( &( pxTCB->xMPUSettings ), xRegions, NULL, 0 );
+	}
+
+#endif /* portUSING_MPU_WRAPPERS */
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseTaskLists( void )
+{
+UBaseType_t uxPriority;
+
+	for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configMAX_PRIORITIES; uxPriority++ )
+	{
+		vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
+	}
+
+	#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+	{
+		for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configDELAYED_TASK_WHEEL_SIZE; uxPriority++ )
+		{
+			vListInitialise( &( xDelayedTaskWheel[ uxPriority ] ) );
+		}
+	}
+	#else
+	{
+		vListInitialise( &xDelayedTaskList1 );
+		#if( configUSE_64_BIT_TICK_COUNT == 0 )
+		{
+			vListInitialise( &xDelayedTaskList2 );
+		}
+		#endif
+	}
+	#endif /* configUSE_DELAYED_TASK_WHEEL */
+
+	vListInitialise( &xPendingReadyList );
+
+	#if( configUSE_TASK_SNAPSHOTS == 1 )
+	{
+		vListInitialise( &xAllTasksList );
+	}
+	#endif
+
+	#if ( configUSE_TASK_BUDGETS == 1 )
+	{
+		vListInitialise( &xBudgetExhaustedTaskList );
+	}
+	#endif /* configUSE_TASK_BUDGETS */
+
+	#if ( INCLUDE_vTaskDelete == 1 )
+	{
+		vListInitialise( &xTasksWaitingTermination );
+	}
+	#endif /* INCLUDE_vTaskDelete */
+
+	#if ( INCLUDE_vTaskSuspend == 1 )
+	{
+		vListInitialise( &xSuspendedTaskList );
+	}
+	#endif /* INCLUDE_vTaskSuspend */
+
+	#if( configUSE_DELAYED_TASK_WHEEL == 0 )
+	{
+		/* Start with pxDelayedTaskList using list1 and the
+		pxOverflowDelayedTaskList using list2. */
+		pxDelayedTaskList = &xDelayedTaskList1;
+		#if( configUSE_64_BIT_TICK_COUNT == 0 )
+		{
+			pxOverflowDelayedTaskList = &xDelayedTaskList2;
+		}
+		#endif
+	}
+	#endif /* configUSE_DELAYED_TASK_WHEEL */
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckTasksWaitingTermination( void )
+{
+
+	/** THIS FUNCTION IS CALLED FROM THE RTOS IDLE TASK **/
+
+	#if ( INCLUDE_vTaskDelete == 1 )
+	{
+		TCB_t *pxTCB;
+
+		/* uxDeletedTasksWaitingCleanUp is used to prevent taskENTER_CRITICAL()
+		being called too often in the idle task. */
+		while( uxDeletedTasksWaitingCleanUp > ( UBaseType_t ) 0U )
+		{
+			#if ( configNUM_CORES > 1 )
+			{
+				pxTCB = NULL;
+
+				taskENTER_CRITICAL();
+				{
+					/* The idle task of another core may have emptied the list
+					already, and a task deleted while running on another core
+					cannot be freed until that core has switched away from it. */
+					if( uxDeletedTasksWaitingCleanUp > ( UBaseType_t ) 0U )
+					{
+						pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+						if( pxTCB->xTaskRunState == taskTASK_NOT_RUNNING )
+						{
+							( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+							--uxCurrentNumberOfTasks;
+							--uxDeletedTasksWaitingCleanUp;
+						}
+						else
+						{
+							pxTCB = NULL;
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				taskEXIT_CRITICAL();
+
+				if( pxTCB != NULL )
+				{
+					prvDeleteTCB( pxTCB );
+				}
+				else
+				{
+					break;
+				}
+			}
+			#else
+			{
+				taskENTER_CRITICAL();
+				{
+					pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+					--uxCurrentNumberOfTasks;
+					--uxDeletedTasksWaitingCleanUp;
+				}
+				taskEXIT_CRITICAL();
+
+				prvDeleteTCB( pxTCB );
+			}
+			#endif /* configNUM_CORES */
+		}
+	}
+	#endif /* INCLUDE_vTaskDelete */
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TRACE_FACILITY == 1 )
+
+	void vTaskGetInfo( TaskHandle_t xTask, TaskStatus_t *pxTaskStatus, BaseType_t xGetFreeStackSpace, eTaskState eState )
+	{
+	TCB_t *pxTCB;
+
+		/* xTask is NULL then get the state of the calling task. */
+		pxTCB = prvGetTCBFromHandle( xTask );
+
+		pxTaskStatus->xHandle = ( TaskHandle_t ) pxTCB;
+		pxTaskStatus->pcTaskName = ( const char * ) &( pxTCB->pcTaskName [ 0 ] );
+		pxTaskStatus->uxCurrentPriority = pxTCB->uxPriority;
+		pxTaskStatus->pxStackBase = pxTCB->pxStack;
+		pxTaskStatus->xTaskNumber = pxTCB->uxTCBNumber;
+
+		#if ( configUSE_MUTEXES == 1 )
+		{
+			pxTaskStatus->uxBasePriority = pxTCB->uxBasePriority;
+		}
+		#else
+		{
+			pxTaskStatus->uxBasePriority = 0;
+		}
+		#endif
+
+		#if ( configGENERATE_RUN_TIME_STATS == 1 )
+		{
+			pxTaskStatus->ulRunTimeCounter = pxTCB->ulRunTimeCounter;
+		}
+		#else
+		{
+			pxTaskStatus->ulRunTimeCounter = 0;
+		}
+		#endif
+
+		/* Obtaining the task state is a little fiddly, so is only done if the
+		value of eState passed into this function is eInvalid - otherwise the
+		state is just set to whatever is passed in. */
+		if( eState != eInvalid )
+		{
+			if( taskTASK_IS_RUNNING( pxTCB ) )
+			{
+				pxTaskStatus->eCurrentState = eRunning;
+			}
+			else
+			{
+				pxTaskStatus->eCurrentState = eState;
+
+				#if ( INCLUDE_vTaskSuspend == 1 )
+				{
+					/* If the task is in the suspended list then there is a
+					chance it is actually just blocked indefinitely - so really
+					it should be reported as being in the Blocked state. */
+					if( eState == eSuspended )
+					{
+						vTaskSuspendAll();
+						{
+							if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+							{
+								pxTaskStatus->eCurrentState = eBlocked;
+							}
+						}
+						( void ) xTaskResumeAll();
+					}
+				}
+				#endif /* INCLUDE_vTaskSuspend */
+			}
+		}
+		else
+		{
+			pxTaskStatus->eCurrentState = eTaskGetState( pxTCB );
+		}
+
+		/* Obtaining the stack space takes some time, so the xGetFreeStackSpace
+		parameter is provided to allow it to be skipped. */
+		if( xGetFreeStackSpace != pdFALSE )
+		{
+			pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( pxTCB );
+		}
+		else
+		{
+			pxTaskStatus->usStackHighWaterMark = 0;
+		}
+	}
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	static UBaseType_t prvListTasksWithinSingleList( TaskStatus_t *pxTaskStatusArray, List_t *pxList, eTaskState eState )
+	{
+	configLIST_VOLATILE TCB_t *pxNextTCB, *pxFirstTCB;
+	UBaseType_t uxTask = 0;
+
+		if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
+		{
+			listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+			/* Populate an TaskStatus_t structure within the
+			pxTaskStatusArray array for each task that is referenced from
+			pxList.  See the definition of TaskStatus_t in task.h for the
+			meaning of each TaskStatus_t structure member. */
+			do
+			{
+				listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+				vTaskGetInfo( ( TaskHandle_t ) pxNextTCB, &( pxTaskStatusArray[ uxTask ] ), pdTRUE, eState );
+				uxTask++;
+			} while( pxNextTCB != pxFirstTCB );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return uxTask;
+	}
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
+
+	#if( configUSE_INCREMENTAL_STACK_HIGH_WATER_MARK == 0 )
+
+		static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( TCB_t * const pxTCB )
+		{
+		const StackType_t *pxStackWord;
+		uint32_t ulCount = 0U;
+
+			#if( portSTACK_GROWTH < 0 )
+			{
+				pxStackWord = pxTCB->pxStack;
+			}
+			#else
+			{
+				pxStackWord = pxTCB->pxEndOfStack;
+			}
+			#endif
+
+			/* Count the words from the end of the stack that still hold the
+			value the stack was filled with when the task was created. */
+			while( *pxStackWord == tskSTACK_FILL_WORD )
+			{
+				pxStackWord -= portSTACK_GROWTH;
+				ulCount++;
+			}
+
+			return ( configSTACK_DEPTH_TYPE ) ulCount;
+		}
+
+	#else /* configUSE_INCREMENTAL_STACK_HIGH_WATER_MARK */
+
+		static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( TCB_t * const pxTCB )
+		{
+		StackType_t *pxStackWord = pxTCB->pxStackHighWaterMark;
+		uint32_t ulCount;
+
+			/* Everything from the recorded high water mark up is known to
+			have been used, so only the words below it are examined.  The
+			scan moves the mark down over the words that have been written
+			since the last scan and stops at the first word that still holds
+			the fill value, so in steady state it reads a single word.
+
+			This is an approximation.  A region that was reserved but never
+			written, such as an unused local buffer, stops the scan above any
+			deeper use, so the free space can be over-reported by the size of
+			that region.  The error is corrected the next time the task is
+			switched out with its stack pointer below the region.  Use the
+			full scan (configUSE_INCREMENTAL_STACK_HIGH_WATER_MARK set to 0)
+			where the exact figure is needed. */
+			#if( portSTACK_GROWTH < 0 )
+			{
+				while( ( pxStackWord > pxTCB->pxStack ) && ( pxStackWord[ -1 ] != tskSTACK_FILL_WORD ) )
+				{
+					pxStackWord--;
+				}
+			}
+			#else
+			{
+				while( ( pxStackWord < pxTCB->pxEndOfStack ) && ( pxStackWord[ 1 ] != tskSTACK_FILL_WORD ) )
+				{
+					pxStackWord++;
+				}
+			}
+			#endif
+
+			/* The task may have been switched out with a deeper stack pointer
+			since the scan started. */
+			taskENTER_CRITICAL();
+			{
+				#if( portSTACK_GROWTH < 0 )
+				{
+					if( pxStackWord < pxTCB->pxStackHighWaterMark )
+					{
+						pxTCB->pxStackHighWaterMark = pxStackWord;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+					ulCount = ( uint32_t ) ( pxTCB->pxStackHighWaterMark - pxTCB->pxStack );
+				}
+				#else
+				{
+					if( pxStackWord > pxTCB->pxStackHighWaterMark )
+					{
+						pxTCB->pxStackHighWaterMark = pxStackWord;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+					ulCount = ( uint32_t ) ( pxTCB->pxEndOfStack - pxTCB->pxStackHighWaterMark );
+				}
+				#endif
+			}
+			taskEXIT_CRITICAL();
+
+			return ( configSTACK_DEPTH_TYPE ) ulCount;
+		}
+
+	#endif /* configUSE_INCREMENTAL_STACK_HIGH_WATER_MARK */
+
+#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_INCREMENTAL_STACK_HIGH_WATER_MARK == 1 )
+
+	static void prvSampleStackHighWaterMark( TCB_t * const pxTCB )
+	{
+	StackType_t * const pxTopOfStack = ( StackType_t * ) pxTCB->pxTopOfStack;
+
+		/* The context of the task has been saved, so its stack pointer is as
+		deep as it is going to be at this point.  A stack pointer outside of
+		the stack is left to the stack overflow checks. */
+		#if( portSTACK_GROWTH < 0 )
+		{
+			if( ( pxTopOfStack < pxTCB->pxStackHighWaterMark ) && ( pxTopOfStack >= pxTCB->pxStack ) )
+			{
+				pxTCB->pxStackHighWaterMark = pxTopOfStack;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#else
+		{
+			if( ( pxTopOfStack > pxTCB->pxStackHighWaterMark ) && ( pxTopOfStack <= pxTCB->pxEndOfStack ) )
+			{
+				pxTCB->pxStackHighWaterMark = pxTopOfStack;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif
+	}
+
+#endif /* configUSE_INCREMENTAL_STACK_HIGH_WATER_MARK */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 )
+
+	/* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are the
+	same except for their return type.  Using configSTACK_DEPTH_TYPE allows the
+	user to determine the return type.  It gets around the problem of the value
+	overflowing on 8-bit types without breaking backward compatibility for
+	applications that expect an 8-bit return type. */
+	configSTACK_DEPTH_TYPE uxTaskGetStackHighWaterMark2( TaskHandle_t xTask )
+	{
+	TCB_t *pxTCB;
+	configSTACK_DEPTH_TYPE uxReturn;
+
+		/* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are
+		the same except for their return type.  Using configSTACK_DEPTH_TYPE
+		allows the user to determine the return type.  It gets around the
+		problem of the value overflowing on 8-bit types without breaking
+		backward compatibility for applications that expect an 8-bit return
+		type. */
+
+		pxTCB = prvGetTCBFromHandle( xTask );
+
+		uxReturn = prvTaskCheckFreeStackSpace( pxTCB );
+
+		return uxReturn;
+	}
+
+#endif /* INCLUDE_uxTaskGetStackHighWaterMark2 */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_uxTaskGetStackHighWaterMark == 1 )
+
+	UBaseType_t uxTaskGetStackHighWaterMark( TaskHandle_t xTask )
+	{
+	TCB_t *pxTCB;
+	UBaseType_t uxReturn;
+
+		pxTCB = prvGetTCBFromHandle( xTask );
+
+		uxReturn = ( UBaseType_t ) prvTaskCheckFreeStackSpace( pxTCB );
+
+		return uxReturn;
+	}
+
+#endif /* INCLUDE_uxTaskGetStackHighWaterMark */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskDelete == 1 )
+
+	static void prvDeleteTCB( TCB_t *pxTCB )
+	{
+		/* This call is required specifically for the TriCore port.  It must be
+		above the vPortFree() calls.  The call is also used by ports/demos that
+		want to allocate and clean RAM statically. */
+		portCLEAN_UP_TCB( pxTCB );
+
+		/* Free up the memory allocated by the scheduler for the task.  It is up
+		to the task to free any memory allocated at the application level. */
+		#if ( configUSE_NEWLIB_REENTRANT == 1 )
+		{
+			_reclaim_reent( &( pxTCB->xNewLib_reent ) );
+		}
+		#endif /* configUSE_NEWLIB_REENTRANT */
+
+		#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( portUSING_MPU_WRAPPERS == 0 ) && ( configUSE_TASK_POOLS == 0 ) && ( configUSE_BASIC_TASKS == 0 ) )
+		{
+			/* The task can only have been allocated dynamically - free both
+			the stack and TCB. */
+			vPortFree( pxTCB->pxStack );
+			vPortFree( pxTCB );
+		}
+		#elif( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
+		{
+			/* The task could have been allocated statically or dynamically, so
+			check what was statically allocated before trying to free the
+			memory. */
+			if( pxTCB->ucStaticallyAllocated == tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
+			{
+				/* Both the stack and TCB were allocated dynamically, so both
+				must be freed. */
+				vPortFree( pxTCB->pxStack );
+				vPortFree( pxTCB );
+			}
+			else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
+			{
+				/* Only the stack was statically allocated, so the TCB is the
+				only memory that must be freed. */
+				vPortFree( pxTCB );
+			}
+			#if( configUSE_TASK_POOLS == 1 )
+				else if( pxTCB->ucStaticallyAllocated == tskPOOL_ALLOCATED_STACK_AND_TCB )
+				{
+					/* The stack and TCB were taken from a pool, so return them
+					to it. */
+					prvTaskPoolRelease( pxTCB );
+				}
+			#endif /* configUSE_TASK_POOLS */
+			#if( configUSE_BASIC_TASKS == 1 )
+				else if( pxTCB->ucStaticallyAllocated == tskBASIC_TASK_SHARED_STACK )
+				{
+					/* The stack is shared with other basic tasks, so only the
+					TCB is freed. */
+					vPortFree( pxTCB );
+				}
+			#endif /* configUSE_BASIC_TASKS */
+			else
+			{
+				/* Neither the stack nor the TCB were allocated dynamically, so
+				nothing needs to be freed. */
+				configASSERT( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_AND_TCB	);
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+	}
+
+#endif /* INCLUDE_vTaskDelete */
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvUnblockDelayedTask( TCB_t * const pxTCB )
+{
+BaseType_t xReturn = pdFALSE;
+
+	( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+
+	/* Is the task waiting on an event also?  If so remove it from the event
+	list. */
+	if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+	{
+		( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	#if( configUSE_TASK_RENDEZVOUS == 1 )
+	{
+		/* A rendezvous call that has timed out no longer raises the priority
+		of its receiver, which might be the running task. */
+		xReturn = prvRendezvousAbandonCall( pxTCB );
+	}
+	#endif /* configUSE_TASK_RENDEZVOUS */
+
+	/* Place the unblocked task into the appropriate ready list. */
+	prvAddTaskToReadyList( pxTCB );
+
+	/* A task being unblocked cannot cause an immediate context switch if
+	preemption is turned off. */
+	#if (  configUSE_PREEMPTION == 1 )
+	{
+		/* Preemption is on, but a context switch should only be performed if
+		the unblocked task has a priority that is equal to or higher than the
+		currently executing task. */
+		if( taskTASK_PREEMPTS_CURRENT_OR_EQUALS( pxTCB ) )
+		{
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configUSE_PREEMPTION */
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+static void prvAddTaskToDelayedWheel( TCB_t * const pxTCB )
+{
+const UBaseType_t uxSlot = taskDELAYED_WHEEL_SLOT( listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) ) );
+
+	vListInsertEnd( &( xDelayedTaskWheel[ uxSlot ] ), &( pxTCB->xStateListItem ) );
+	ulDelayedTaskWheelMap |= ( 1UL << uxSlot );
+}
+/*-----------------------------------------------------------*/
+
+static TickCount_t prvGetNextDelayedWheelTime( const TickCount_t xFromTick )
+{
+TickCount_t xReturn = portMAX_TICK_COUNT;
+UBaseType_t uxDistance, uxSlot;
+
+	for( uxDistance = ( UBaseType_t ) 0U; uxDistance < ( UBaseType_t ) configDELAYED_TASK_WHEEL_SIZE; uxDistance++ )
+	{
+		uxSlot = taskDELAYED_WHEEL_SLOT( xFromTick + ( TickCount_t ) uxDistance );
+
+		if( ( ulDelayedTaskWheelMap & ( 1UL << uxSlot ) ) != 0UL )
+		{
+			if( listLIST_IS_EMPTY( &( xDelayedTaskWheel[ uxSlot ] ) ) == pdFALSE )
+			{
+				xReturn = xFromTick + ( TickCount_t ) uxDistance;
+
+				if( xReturn < xFromTick )
+				{
+					/* The tick count overflows first, the wheel is looked at
+					again by taskSWITCH_DELAYED_LISTS(). */
+					xReturn = portMAX_TICK_COUNT;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				break;
+			}
+			else
+			{
+				/* The tasks of the slot were removed by uxListRemove(), for
+				example when the event they waited for occurred. */
+				ulDelayedTaskWheelMap &= ~( 1UL << uxSlot );
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvResetNextTaskUnblockTime( void )
+{
+	/* The slot of the current tick count has already been processed by
+	xTaskIncrementTick(). */
+	xNextTaskUnblockTime = prvGetNextDelayedWheelTime( xTickCount + ( TickCount_t ) 1 );
+}
+/*-----------------------------------------------------------*/
+
+#else /* configUSE_DELAYED_TASK_WHEEL */
+
+static void prvResetNextTaskUnblockTime( void )
+{
+TCB_t *pxTCB;
+
+	if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+	{
+		/* The new current delayed list is empty.  Set xNextTaskUnblockTime to
+		the maximum possible value so it is	extremely unlikely that the
+		if( xTickCount >= xNextTaskUnblockTime ) test will pass until
+		there is an item in the delayed list. */
+		xNextTaskUnblockTime = portMAX_TICK_COUNT;
+	}
+	else
+	{
+		/* The new current delayed list is not empty, get the value of
+		the item at the head of the delayed list.  This is the time at
+		which the task at the head of the delayed list should be removed
+		from the Blocked state. */
+		( pxTCB ) = listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+		xNextTaskUnblockTime = listGET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ) );
+	}
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_DELAYED_TASK_WHEEL */
+
+#if( configUSE_EDF_SCHEDULING == 1 )
+
+static void prvEDFHeapInsert( TCB_t * const pxTCB )
+{
+	if( pxTCB->uxEDFHeapIndex == taskEDF_NOT_IN_HEAP )
+	{
+		/* Each of the at most configEDF_MAX_TASKS EDF tasks is referenced
+		once at most, so there is always room. */
+		configASSERT( uxEDFHeapLength < ( UBaseType_t ) configEDF_MAX_TASKS );
+		pxEDFHeap[ uxEDFHeapLength ] = pxTCB;
+		uxEDFHeapLength++;
+		prvEDFHeapRestore( uxEDFHeapLength - ( UBaseType_t ) 1U );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvEDFHeapRemove( TCB_t * const pxTCB )
+{
+const UBaseType_t uxIndex = pxTCB->uxEDFHeapIndex;
+
+	if( uxIndex != taskEDF_NOT_IN_HEAP )
+	{
+		pxTCB->uxEDFHeapIndex = taskEDF_NOT_IN_HEAP;
+		uxEDFHeapLength--;
+
+		if( uxIndex != uxEDFHeapLength )
+		{
+			/* Fill the hole with the last task of the heap. */
+			pxEDFHeap[ uxIndex ] = pxEDFHeap[ uxEDFHeapLength ];
+			prvEDFHeapRestore( uxIndex );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvEDFHeapRestore( UBaseType_t uxIndex )
+{
+TCB_t * const pxTCB = pxEDFHeap[ uxIndex ];
+UBaseType_t uxParent, uxChild;
+
+	/* Move the task towards the top while its deadline is earlier than that
+	of its parent... */
+	while( uxIndex > ( UBaseType_t ) 0U )
+	{
+		uxParent = ( uxIndex - ( UBaseType_t ) 1U ) / ( UBaseType_t ) 2U;
+
+		if( taskEDF_TIME_IS_BEFORE( pxTCB->xEDFDeadline, pxEDFHeap[ uxParent ]->xEDFDeadline ) )
+		{
+			pxEDFHeap[ uxIndex ] = pxEDFHeap[ uxParent ];
+			pxEDFHeap[ uxIndex ]->uxEDFHeapIndex = uxIndex;
+			uxIndex = uxParent;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	/* ...then towards the bottom while the deadline of one of its children is
+	earlier. */
+	for( ;; )
+	{
+		uxChild = ( uxIndex * ( UBaseType_t ) 2U ) + ( UBaseType_t ) 1U;
+
+		if( uxChild >= uxEDFHeapLength )
+		{
+			break;
+		}
+
+		if( ( ( uxChild + ( UBaseType_t ) 1U ) < uxEDFHeapLength ) && taskEDF_TIME_IS_BEFORE( pxEDFHeap[ uxChild + ( UBaseType_t ) 1U ]->xEDFDeadline, pxEDFHeap[ uxChild ]->xEDFDeadline ) )
+		{
+			uxChild++;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( taskEDF_TIME_IS_BEFORE( pxEDFHeap[ uxChild ]->xEDFDeadline, pxTCB->xEDFDeadline ) )
+		{
+			pxEDFHeap[ uxIndex ] = pxEDFHeap[ uxChild ];
+			pxEDFHeap[ uxIndex ]->uxEDFHeapIndex = uxIndex;
+			uxIndex = uxChild;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	pxEDFHeap[ uxIndex ] = pxTCB;
+	pxTCB->uxEDFHeapIndex = uxIndex;
+}
+/*-----------------------------------------------------------*/
+
+static TCB_t *prvEDFGetEarliestReadyTask( void )
+{
+TCB_t *pxTCB = NULL;
+
+	while( uxEDFHeapLength > ( UBaseType_t ) 0U )
+	{
+		if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ configEDF_PRIORITY ] ), &( pxEDFHeap[ 0 ]->xStateListItem ) ) != pdFALSE )
+		{
+			pxTCB = pxEDFHeap[ 0 ];
+			break;
+		}
+		else
+		{
+			/* The task blocked, was suspended or changed priority since it
+			was last readied.  It is added again when it is next readied in
+			the EDF band. */
+			prvEDFHeapRemove( pxEDFHeap[ 0 ] );
+		}
+	}
+
+	return pxTCB;
+}
+/*-----------------------------------------------------------*/
+
+static void prvEDFSelectTask( void )
+{
+TCB_t *pxEarliestTCB;
+
+	if( pxCurrentTCB->uxPriority == ( UBaseType_t ) configEDF_PRIORITY )
+	{
+		pxEarliestTCB = prvEDFGetEarliestReadyTask();
+
+		if( pxEarliestTCB != NULL )
+		{
+			pxCurrentTCB = pxEarliestTCB;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvEDFTaskIsEarlier( const TCB_t * const pxTCB, const TCB_t * const pxOtherTCB )
+{
+BaseType_t xReturn = pdFALSE;
+
+	if( ( pxTCB->uxPriority == ( UBaseType_t ) configEDF_PRIORITY ) && ( pxOtherTCB->uxPriority == ( UBaseType_t ) configEDF_PRIORITY ) && taskIS_EDF_TASK( pxTCB ) )
+	{
+		/* EDF tasks run before the fixed priority tasks that share their
+		band. */
+		if( ( taskIS_EDF_TASK( pxOtherTCB ) == pdFALSE ) || taskEDF_TIME_IS_BEFORE( pxTCB->xEDFDeadline, pxOtherTCB->xEDFDeadline ) )
+		{
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_EDF_SCHEDULING */
+
+#if( configUSE_TIME_SLICE_QUANTA == 1 )
+
+	static BaseType_t prvTimeSliceExpired( TCB_t * const pxTCB )
+	{
+	BaseType_t xReturn;
+
+		if( pxTCB->uxTimeSliceRemaining > ( UBaseType_t ) 1U )
+		{
+			( pxTCB->uxTimeSliceRemaining )--;
+			xReturn = pdFALSE;
+		}
+		else
+		{
+			/* The task goes to the back of its ready list with a full slice
+			for the next time it is selected. */
+			pxTCB->uxTimeSliceRemaining = pxTCB->uxTimeSliceQuantum;
+			xReturn = pdTRUE;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TIME_SLICE_QUANTA */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TASK_BUDGETS == 1 )
+
+	static BaseType_t prvTaskBudgetCharge( const uint32_t ulNow )
+	{
+	TCB_t * const pxTCB = pxCurrentTCB;
+	const TickType_t xConstTickCount = ( TickType_t ) xTickCount;
+	BaseType_t xReturn = pdFALSE;
+
+		if( ( pxTCB->ulBudget != 0UL ) && ( pxTCB->uxBudgetPriority == taskBUDGET_NOT_DEMOTED ) )
+		{
+			if( taskBUDGET_PERIOD_ENDED( pxTCB, xConstTickCount ) )
+			{
+				/* The first run time charged after the end of a period starts
+				the next one. */
+				pxTCB->ulBudgetUsed = 0UL;
+				pxTCB->xBudgetReplenishTime = xConstTickCount + pxTCB->xBudgetPeriod;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxTCB->ulBudgetUsed += ulNow - ulBudgetChargedTime;
+
+			if( ( pxTCB->ulBudgetUsed >= pxTCB->ulBudget ) && ( taskBUDGET_BASE_PRIORITY( pxTCB ) > ( UBaseType_t ) configTASK_BUDGET_EXHAUSTED_PRIORITY ) )
+			{
+				traceTASK_BUDGET_EXHAUSTED( pxTCB );
+
+				pxTCB->uxBudgetPriority = taskBUDGET_BASE_PRIORITY( pxTCB );
+				prvTaskBudgetSetPriority( pxTCB, ( UBaseType_t ) configTASK_BUDGET_EXHAUSTED_PRIORITY );
+
+				/* The replenishment time is in the future, so measuring from
+				the current tick finds the earliest. */
+				if( ( listLIST_IS_EMPTY( &xBudgetExhaustedTaskList ) != pdFALSE ) ||
+					( ( TickType_t ) ( pxTCB->xBudgetReplenishTime - xConstTickCount ) < ( TickType_t ) ( xNextBudgetReplenishTime - xConstTickCount ) ) )
+				{
+					xNextBudgetReplenishTime = pxTCB->xBudgetReplenishTime;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				vListInsertEnd( &xBudgetExhaustedTaskList, &( pxTCB->xBudgetListItem ) );
+				xReturn = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		ulBudgetChargedTime = ulNow;
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvTaskBudgetReplenish( const TickType_t xTime )
+	{
+	ListItem_t const * const pxEnd = listGET_END_MARKER( &xBudgetExhaustedTaskList );
+	ListItem_t *pxItem, *pxNextItem;
+	TCB_t *pxTCB;
+	TickType_t xNextDelay = portMAX_DELAY;
+	BaseType_t xReturn = pdFALSE;
+
+		for( pxItem = listGET_HEAD_ENTRY( &xBudgetExhaustedTaskList ); pxItem != pxEnd; pxItem = pxNextItem )
+		{
+			pxNextItem = listGET_NEXT( pxItem );
+			pxTCB = listGET_LIST_ITEM_OWNER( pxItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+			if( taskBUDGET_PERIOD_ENDED( pxTCB, xTime ) )
+			{
+				if( prvTaskBudgetRestore( pxTCB ) != pdFALSE )
+				{
+					xReturn = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else if( ( TickType_t ) ( pxTCB->xBudgetReplenishTime - xTime ) < xNextDelay )
+			{
+				xNextDelay = ( TickType_t ) ( pxTCB->xBudgetReplenishTime - xTime );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		xNextBudgetReplenishTime = xTime + xNextDelay;
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvTaskBudgetRestore( TCB_t * const pxTCB )
+	{
+	const UBaseType_t uxPriority = pxTCB->uxBudgetPriority;
+
+		traceTASK_BUDGET_REPLENISHED( pxTCB );
+
+		( void ) uxListRemove( &( pxTCB->xBudgetListItem ) );
+		pxTCB->uxBudgetPriority = taskBUDGET_NOT_DEMOTED;
+		prvTaskBudgetSetPriority( pxTCB, uxPriority );
+
+		/* The next period follows on from the one that has just ended. */
+		pxTCB->ulBudgetUsed = 0UL;
+		pxTCB->xBudgetReplenishTime = ( TickType_t ) xTickCount + pxTCB->xBudgetPeriod;
+
+		return ( pxTCB->uxPriority > pxCurrentTCB->uxPriority ) ? pdTRUE : pdFALSE;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvTaskBudgetSetPriority( TCB_t * const pxTCB, const UBaseType_t uxNewPriority )
+	{
+	const UBaseType_t uxPriorityUsedOnEntry = pxTCB->uxPriority;
+
+		#if ( configUSE_MUTEXES == 1 )
+		{
+			/* A task holding a mutex keeps any priority it has inherited
+			until the mutex is given back. */
+			if( pxTCB->uxBasePriority == pxTCB->uxPriority )
+			{
+				pxTCB->uxPriority = uxNewPriority;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxTCB->uxBasePriority = uxNewPriority;
+		}
+		#else
+		{
+			pxTCB->uxPriority = uxNewPriority;
+		}
+		#endif
+
+		taskRECORD_STATE_CHANGE( pxTCB );
 
-	/* Remove the event list form the event flag.  Interrupts do not access
-	event flags. */
-	pxUnblockedTCB = listGET_LIST_ITEM_OWNER( pxEventListItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-	configASSERT( pxUnblockedTCB );
-	( void ) uxListRemove( pxEventListItem );
+		if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+		{
+			listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxTCB->uxPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 
-	/* Remove the task from the delayed list and add it to the ready list.  The
-	scheduler is suspended so interrupts will not be accessing the ready
-	lists. */
-	( void ) uxListRemove( &( pxUnblockedTCB->xStateListItem ) );
-	prvAddTaskToReadyList( pxUnblockedTCB );
+		if( ( pxTCB->uxPriority != uxPriorityUsedOnEntry ) && ( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE ) )
+		{
+			if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+			{
+				portRESET_READY_PRIORITY( uxPriorityUsedOnEntry, uxTopReadyPriority );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+			prvMoveTaskBetweenReadyLists( pxTCB );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_TASK_BUDGETS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TASK_POOLS == 1 )
 
-	if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+	static TCB_t *prvTaskPoolAllocate( const configSTACK_DEPTH_TYPE usStackDepth, TaskPool_t **ppxPool )
 	{
-		/* The unblocked task has a priority above that of the calling task, so
-		a context switch is required.  This function is called with the
-		scheduler suspended so xYieldPending is set so the context switch
-		occurs immediately that the scheduler is resumed (unsuspended). */
-		xYieldPending = pdTRUE;
+	TaskPool_t *pxPool;
+	TCB_t *pxTCB = NULL;
+
+		*ppxPool = NULL;
+
+		taskENTER_CRITICAL();
+		{
+			/* The pools are ordered by depth so the first that fits and has a
+			free pair is the smallest. */
+			for( pxPool = pxTaskPools; ( pxPool != NULL ) && ( pxTCB == NULL ); pxPool = pxPool->pxNext )
+			{
+				if( ( pxPool->usStackDepth >= usStackDepth ) && ( pxPool->uxFreeTCBs > ( UBaseType_t ) 0U ) )
+				{
+					pxPool->uxFreeTCBs--;
+					pxTCB = pxPool->ppxFreeTCBs[ pxPool->uxFreeTCBs ];
+					*ppxPool = pxPool;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		return pxTCB;
 	}
-}
+	/*-----------------------------------------------------------*/
+
+	static void prvTaskPoolRelease( TCB_t * const pxTCB )
+	{
+	TaskPool_t * const pxPool = pxTCB->pxTaskPool;
+
+		taskENTER_CRITICAL();
+		{
+			pxPool->ppxFreeTCBs[ pxPool->uxFreeTCBs ] = pxTCB;
+			pxPool->uxFreeTCBs++;
+		}
+		taskEXIT_CRITICAL();
+	}
+
+#endif /* configUSE_TASK_POOLS */
 /*-----------------------------------------------------------*/
 
-void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut )
-{
-	configASSERT( pxTimeOut );
-	taskENTER_CRITICAL();
+#if( configUSE_BASIC_TASKS == 1 )
+
+	static void prvBasicTaskSetDormant( TCB_t * const pxTCB )
 	{
-		pxTimeOut->xOverflowCount = xNumOfOverflows;
-		pxTimeOut->xTimeOnEntering = xTickCount;
+		/* Waiting indefinitely for a notification is what makes
+		xTaskNotify() and vTaskResume() move the task back to its ready
+		list. */
+		pxTCB->ucNotifyState[ tskDEFAULT_INDEX_TO_NOTIFY ] = taskWAITING_NOTIFICATION;
+		vListInsertEnd( &xSuspendedTaskList, &( pxTCB->xStateListItem ) );
 	}
-	taskEXIT_CRITICAL();
-}
+	/*-----------------------------------------------------------*/
+
+	static void prvBasicTaskEntry( void *pvParameters )
+	{
+	TCB_t * const pxTCB = ( TCB_t * ) pvParameters;
+
+		pxTCB->pxBasicTaskCode( pxTCB->pvBasicTaskParameters );
+
+		taskENTER_CRITICAL();
+		{
+			/* Nothing can hold a mutex on behalf of a task that is not
+			running. */
+			#if( configUSE_MUTEXES == 1 )
+			{
+				configASSERT( pxTCB->uxMutexesHeld == ( tskTCB_NESTING_TYPE ) 0U );
+			}
+			#endif /* configUSE_MUTEXES */
+
+			pxSharedStackOwners[ pxTCB->uxSharedStack ] = NULL;
+
+			if( pxTCB->ucNotifyState[ tskDEFAULT_INDEX_TO_NOTIFY ] == taskNOTIFICATION_RECEIVED )
+			{
+				/* Activated again while it ran, so leave the task ready.  It
+				is given a new context when next selected. */
+				mtCOVERAGE_TEST_MARKER();
+			}
+			else
+			{
+				if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+				{
+					taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				prvBasicTaskSetDormant( pxTCB );
+				taskRECORD_STATE_CHANGE( pxTCB );
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		/* The stack is no longer owned, so the context saved here is
+		discarded. */
+		portYIELD_WITHIN_API();
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvSelectBasicTask( void )
+	{
+	TCB_t * const pxTCB = pxCurrentTCB;
+	StackType_t *pxTopOfStack;
+
+		if( taskIS_BASIC_TASK( pxTCB ) != pdFALSE )
+		{
+			if( pxSharedStackOwners[ pxTCB->uxSharedStack ] == NULL )
+			{
+				/* Start a new run at the top of the shared stack. */
+				pxSharedStackOwners[ pxTCB->uxSharedStack ] = pxTCB;
+				pxTCB->ucNotifyState[ tskDEFAULT_INDEX_TO_NOTIFY ] = taskNOT_WAITING_NOTIFICATION;
+
+				pxTopOfStack = &( pxTCB->pxStack[ configBASIC_TASK_STACK_DEPTH - ( configSTACK_DEPTH_TYPE ) 1 ] );
+				pxTopOfStack = ( StackType_t * ) ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack ) & ( ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) ); /*lint !e923 !e9033 !e9078 MISRA exception.  Avoiding casts between pointers and integers is not practical.  Size differences accounted for using portPOINTER_SIZE_TYPE type. */
+
+				#if( portHAS_STACK_OVERFLOW_CHECKING == 1 )
+				{
+					pxTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTCB->pxStack, prvBasicTaskEntry, ( void * ) pxTCB );
+				}
+				#else /* portHAS_STACK_OVERFLOW_CHECKING */
+				{
+					pxTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, prvBasicTaskEntry, ( void * ) pxTCB );
+				}
+				#endif /* portHAS_STACK_OVERFLOW_CHECKING */
+			}
+			else if( pxSharedStackOwners[ pxTCB->uxSharedStack ] != pxTCB )
+			{
+				/* A preempted run on the stack must complete before another
+				can start.  Its task was created at the same priority, so can
+				run in place of the task selected. */
+				pxCurrentTCB = pxSharedStackOwners[ pxTCB->uxSharedStack ];
+			}
+			else
+			{
+				/* Resuming a preempted run. */
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_BASIC_TASKS */
 /*-----------------------------------------------------------*/
 
-void vTaskInternalSetTimeOutState( TimeOut_t * const pxTimeOut )
-{
-	/* For internal use only as it does not use a critical section. */
-	pxTimeOut->xOverflowCount = xNumOfOverflows;
-	pxTimeOut->xTimeOnEntering = xTickCount;
-}
+#if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) )
+
+	TaskHandle_t xTaskGetCurrentTaskHandle( void )
+	{
+	TaskHandle_t xReturn;
+
+		/* A critical section is not required as this is not called from
+		an interrupt and the current TCB will always be the same for any
+		individual execution thread. */
+		xReturn = pxCurrentTCB;
+
+		return xReturn;
+	}
+
+#endif /* ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-BaseType_t xTaskCheckForTimeOut( TimeOut_t * const pxTimeOut, TickType_t * const pxTicksToWait )
-{
-BaseType_t xReturn;
+#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
 
-	configASSERT( pxTimeOut );
-	configASSERT( pxTicksToWait );
+	BaseType_t xTaskGetSchedulerState( void )
+	{
+	BaseType_t xReturn;
 
-	taskENTER_CRITICAL();
+		if( xSchedulerRunning == pdFALSE )
+		{
+			xReturn = taskSCHEDULER_NOT_STARTED;
+		}
+		else
+		{
+			if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+			{
+				xReturn = taskSCHEDULER_RUNNING;
+			}
+			else
+			{
+				xReturn = taskSCHEDULER_SUSPENDED;
+			}
+		}
+
+		return xReturn;
+	}
+
+#endif /* ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+	BaseType_t xTaskPriorityInherit( TaskHandle_t const pxMutexHolder )
 	{
-		/* Minor optimisation.  The tick count cannot change in this block. */
-		const TickType_t xConstTickCount = xTickCount;
-		const TickType_t xElapsedTime = xConstTickCount - pxTimeOut->xTimeOnEntering;
+	TCB_t * const pxMutexHolderTCB = pxMutexHolder;
+	BaseType_t xReturn = pdFALSE;
 
-		#if( INCLUDE_xTaskAbortDelay == 1 )
-			if( pxCurrentTCB->ucDelayAborted != ( uint8_t ) pdFALSE )
+		/* If the mutex was given back by an interrupt while the queue was
+		locked then the mutex holder might now be NULL.  _RB_ Is this still
+		needed as interrupts can no longer use mutexes? */
+		if( pxMutexHolder != NULL )
+		{
+			/* If the holder of the mutex has a priority below the priority of
+			the task attempting to obtain the mutex then it will temporarily
+			inherit the priority of the task attempting to obtain the mutex. */
+			if( pxMutexHolderTCB->uxPriority < pxCurrentTCB->uxPriority )
 			{
-				/* The delay was aborted, which is not the same as a time out,
-				but has the same result. */
-				pxCurrentTCB->ucDelayAborted = pdFALSE;
+				/* Adjust the mutex holder state to account for its new
+				priority.  Only reset the event list item value if the value is
+				not being used for anything else. */
+				if( ( listGET_LIST_ITEM_VALUE( &( pxMutexHolderTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+				{
+					listSET_LIST_ITEM_VALUE( &( pxMutexHolderTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* If the task being modified is in the ready state it will need
+				to be moved into a new list. */
+				if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxMutexHolderTCB->uxPriority ] ), &( pxMutexHolderTCB->xStateListItem ) ) != pdFALSE )
+				{
+					if( uxListRemove( &( pxMutexHolderTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+					{
+						/* It is known that the task is in its ready list so
+						there is no need to check again and the port level
+						reset macro can be called directly. */
+						portRESET_READY_PRIORITY( pxMutexHolderTCB->uxPriority, uxTopReadyPriority );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					/* Inherit the priority before being moved into the new list. */
+					pxMutexHolderTCB->uxPriority = pxCurrentTCB->uxPriority;
+					prvMoveTaskBetweenReadyLists( pxMutexHolderTCB );
+				}
+				else
+				{
+					/* Just inherit the priority. */
+					pxMutexHolderTCB->uxPriority = pxCurrentTCB->uxPriority;
+					taskRECORD_STATE_CHANGE( pxMutexHolderTCB );
+				}
+
+				traceTASK_PRIORITY_INHERIT( pxMutexHolderTCB, pxCurrentTCB->uxPriority );
+
+				/* Inheritance occurred. */
 				xReturn = pdTRUE;
 			}
 			else
-		#endif
-
-		#if ( INCLUDE_vTaskSuspend == 1 )
-			if( *pxTicksToWait == portMAX_DELAY )
 			{
-				/* If INCLUDE_vTaskSuspend is set to 1 and the block time
-				specified is the maximum block time then the task should block
-				indefinitely, and therefore never time out. */
-				xReturn = pdFALSE;
+				if( pxMutexHolderTCB->uxBasePriority < pxCurrentTCB->uxPriority )
+				{
+					/* The base priority of the mutex holder is lower than the
+					priority of the task attempting to take the mutex, but the
+					current priority of the mutex holder is not lower than the
+					priority of the task attempting to take the mutex.
+					Therefore the mutex holder must have already inherited a
+					priority, but inheritance would have occurred if that had
+					not been the case. */
+					xReturn = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
-			else
-		#endif
-
-		if( ( xNumOfOverflows != pxTimeOut->xOverflowCount ) && ( xConstTickCount >= pxTimeOut->xTimeOnEntering ) ) /*lint !e525 Indentation preferred as is to make code within pre-processor directives clearer. */
-		{
-			/* The tick count is greater than the time at which
-			vTaskSetTimeout() was called, but has also overflowed since
-			vTaskSetTimeOut() was called.  It must have wrapped all the way
-			around and gone past again. This passed since vTaskSetTimeout()
-			was called. */
-			xReturn = pdTRUE;
-		}
-		else if( xElapsedTime < *pxTicksToWait ) /*lint !e961 Explicit casting is only redundant with some compilers, whereas others require it to prevent integer conversion errors. */
-		{
-			/* Not a genuine timeout. Adjust parameters for time remaining. */
-			*pxTicksToWait -= xElapsedTime;
-			vTaskInternalSetTimeOutState( pxTimeOut );
-			xReturn = pdFALSE;
 		}
 		else
 		{
-			*pxTicksToWait = 0;
-			xReturn = pdTRUE;
+			mtCOVERAGE_TEST_MARKER();
 		}
-	}
-	taskEXIT_CRITICAL();
 
-	return xReturn;
-}
-/*-----------------------------------------------------------*/
+		return xReturn;
+	}
 
-void vTaskMissedYield( void )
-{
-	xYieldPending = pdTRUE;
-}
+#endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( configUSE_MUTEXES == 1 )
 
-	UBaseType_t uxTaskGetTaskNumber( TaskHandle_t xTask )
+	BaseType_t xTaskPriorityDisinherit( TaskHandle_t const pxMutexHolder )
 	{
-	UBaseType_t uxReturn;
-	TCB_t const *pxTCB;
+	TCB_t * const pxTCB = pxMutexHolder;
+	UBaseType_t uxPriorityToUse;
+	BaseType_t xReturn = pdFALSE;
 
-		if( xTask != NULL )
-		{
-			pxTCB = xTask;
-			uxReturn = pxTCB->uxTaskNumber;
-		}
-		else
+		if( pxMutexHolder != NULL )
 		{
-			uxReturn = 0U;
-		}
+			/* A task can only have an inherited priority if it holds the mutex.
+			If the mutex is held by a task then it cannot be given from an
+			interrupt, and if a mutex is given by the holding task then it must
+			be the running state task. */
+			configASSERT( pxTCB == pxCurrentTCB );
+			configASSERT( pxTCB->uxMutexesHeld );
+			( pxTCB->uxMutexesHeld )--;
 
-		return uxReturn;
-	}
+			/* Has the holder of the mutex inherited the priority of another
+			task? */
+			if( pxTCB->uxPriority != pxTCB->uxBasePriority )
+			{
+				/* Only disinherit if no other mutexes are held. */
+				if( pxTCB->uxMutexesHeld == ( UBaseType_t ) 0 )
+				{
+					uxPriorityToUse = pxTCB->uxBasePriority;
 
-#endif /* configUSE_TRACE_FACILITY */
-/*-----------------------------------------------------------*/
+					#if( configUSE_TASK_RENDEZVOUS == 1 )
+					{
+						/* Keep the priority of any task calling the holder. */
+						uxPriorityToUse = prvRendezvousGetInheritedPriority( pxTCB, uxPriorityToUse );
+					}
+					#endif /* configUSE_TASK_RENDEZVOUS */
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+					/* A task can only have an inherited priority if it holds
+					the mutex.  If the mutex is held by a task then it cannot be
+					given from an interrupt, and if a mutex is given by the
+					holding task then it must be the running state task.  Remove
+					the holding task from the ready/delayed list. */
+					if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+					{
+						taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
 
-	void vTaskSetTaskNumber( TaskHandle_t xTask, const UBaseType_t uxHandle )
-	{
-	TCB_t * pxTCB;
+					/* Disinherit the priority before adding the task into the
+					new	ready list. */
+					traceTASK_PRIORITY_DISINHERIT( pxTCB, uxPriorityToUse );
+					pxTCB->uxPriority = uxPriorityToUse;
 
-		if( xTask != NULL )
+					/* Reset the event list item value.  It cannot be in use for
+					any other purpose if this task is running, and it must be
+					running to give back the mutex. */
+					listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+					prvMoveTaskBetweenReadyLists( pxTCB );
+
+					/* Return true to indicate that a context switch is required.
+					This is only actually required in the corner case whereby
+					multiple mutexes were held and the mutexes were given back
+					in an order different to that in which they were taken.
+					If a context switch did not occur when the first mutex was
+					returned, even if a task was waiting on it, then a context
+					switch should occur when the last mutex is returned whether
+					a task is waiting on it or not. */
+					xReturn = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
 		{
-			pxTCB = xTask;
-			pxTCB->uxTaskNumber = uxHandle;
+			mtCOVERAGE_TEST_MARKER();
 		}
-	}
-
-#endif /* configUSE_TRACE_FACILITY */
 
-/*
- * -----------------------------------------------------------
- * The Idle task.
- * ----------------------------------------------------------
- *
- * The portTASK_FUNCTION() macro is used to allow port/compiler specific
- * language extensions.  The equivalent prototype for this function is:
- *
- * void prvIdleTask( void *pvParameters );
- *
- */
-static portTASK_FUNCTION( prvIdleTask, pvParameters )
-{
-	/* Stop warnings. */
-	( void ) pvParameters;
+		return xReturn;
+	}
 
-	/** THIS IS THE RTOS IDLE TASK - WHICH IS CREATED AUTOMATICALLY WHEN THE
-	SCHEDULER IS STARTED. **/
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
 
-	/* In case a task that has a secure context deletes itself, in which case
-	the idle task is responsible for deleting the task's secure context, if
-	any. */
-	portALLOCATE_SECURE_CONTEXT( configMINIMAL_SECURE_STACK_SIZE );
+#if ( configUSE_MUTEXES == 1 )
 
-	for( ;; )
+	void vTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder, UBaseType_t uxHighestPriorityWaitingTask )
 	{
-		/* See if any tasks have deleted themselves - if so then the idle task
-		is responsible for freeing the deleted task's TCB and stack. */
-		prvCheckTasksWaitingTermination();
-
-		#if ( configUSE_PREEMPTION == 0 )
-		{
-			/* If we are not using preemption we keep forcing a task switch to
-			see if any other task has become available.  If we are using
-			preemption we don't need to do this as any task becoming available
-			will automatically get the processor anyway. */
-			taskYIELD();
-		}
-		#endif /* configUSE_PREEMPTION */
+	TCB_t * const pxTCB = pxMutexHolder;
+	UBaseType_t uxPriorityUsedOnEntry, uxPriorityToUse;
+	const UBaseType_t uxOnlyOneMutexHeld = ( UBaseType_t ) 1;
 
-		#if ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) )
+		if( pxMutexHolder != NULL )
 		{
-			/* When using preemption tasks of equal priority will be
-			timesliced.  If a task that is sharing the idle priority is ready
-			to run then the idle task should yield before the end of the
-			timeslice.
+			/* If pxMutexHolder is not NULL then the holder must hold at least
+			one mutex. */
+			configASSERT( pxTCB->uxMutexesHeld );
 
-			A critical region is not required here as we are just reading from
-			the list, and an occasional incorrect value will not matter.  If
-			the ready list at the idle priority contains more than one task
-			then a task other than the idle task is ready to execute. */
-			if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) 1 )
+			/* Determine the priority to which the priority of the task that
+			holds the mutex should be set.  This will be the greater of the
+			holding task's base priority and the priority of the highest
+			priority task that is waiting to obtain the mutex. */
+			if( pxTCB->uxBasePriority < uxHighestPriorityWaitingTask )
 			{
-				taskYIELD();
+				uxPriorityToUse = uxHighestPriorityWaitingTask;
 			}
 			else
 			{
-				mtCOVERAGE_TEST_MARKER();
+				uxPriorityToUse = pxTCB->uxBasePriority;
 			}
-		}
-		#endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) ) */
-
-		#if ( configUSE_IDLE_HOOK == 1 )
-		{
-			extern void vApplicationIdleHook( void );
-
-			/* Call the user defined function from within the idle task.  This
-			allows the application designer to add background functionality
-			without the overhead of a separate task.
-			NOTE: vApplicationIdleHook() MUST NOT, UNDER ANY CIRCUMSTANCES,
-			CALL A FUNCTION THAT MIGHT BLOCK. */
-			vApplicationIdleHook();
-		}
-		#endif /* configUSE_IDLE_HOOK */
-
-		/* This conditional compilation should use inequality to 0, not equality
-		to 1.  This is to ensure portSUPPRESS_TICKS_AND_SLEEP() is called when
-		user defined low power mode	implementations require
-		configUSE_TICKLESS_IDLE to be set to a value other than 1. */
-		#if ( configUSE_TICKLESS_IDLE != 0 )
-		{
-		TickType_t xExpectedIdleTime;
 
-			/* It is not desirable to suspend then resume the scheduler on
-			each iteration of the idle task.  Therefore, a preliminary
-			test of the expected idle time is performed without the
-			scheduler suspended.  The result here is not necessarily
-			valid. */
-			xExpectedIdleTime = prvGetExpectedIdleTime();
+			#if( configUSE_TASK_RENDEZVOUS == 1 )
+			{
+				/* Nor below the priority of any task calling the holder. */
+				uxPriorityToUse = prvRendezvousGetInheritedPriority( pxTCB, uxPriorityToUse );
+			}
+			#endif /* configUSE_TASK_RENDEZVOUS */
 
-			if( xExpectedIdleTime >= configEXPECTED_IDLE_TIME_BEFORE_SLEEP )
+			/* Does the priority need to change? */
+			if( pxTCB->uxPriority != uxPriorityToUse )
 			{
-				vTaskSuspendAll();
+				/* Only disinherit if no other mutexes are held.  This is a
+				simplification in the priority inheritance implementation.  If
+				the task that holds the mutex is also holding other mutexes then
+				the other mutexes may have caused the priority inheritance. */
+				if( pxTCB->uxMutexesHeld == uxOnlyOneMutexHeld )
 				{
-					/* Now the scheduler is suspended, the expected idle
-					time can be sampled again, and this time its value can
-					be used. */
-					configASSERT( xNextTaskUnblockTime >= xTickCount );
-					xExpectedIdleTime = prvGetExpectedIdleTime();
+					/* If a task has timed out because it already holds the
+					mutex it was trying to obtain then it cannot of inherited
+					its own priority. */
+					configASSERT( pxTCB != pxCurrentTCB );
+
+					/* Disinherit the priority, remembering the previous
+					priority to facilitate determining the subject task's
+					state. */
+					traceTASK_PRIORITY_DISINHERIT( pxTCB, pxTCB->uxBasePriority );
+					uxPriorityUsedOnEntry = pxTCB->uxPriority;
+					pxTCB->uxPriority = uxPriorityToUse;
+					taskRECORD_STATE_CHANGE( pxTCB );
 
-					/* Define the following macro to set xExpectedIdleTime to 0
-					if the application does not want
-					portSUPPRESS_TICKS_AND_SLEEP() to be called. */
-					configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING( xExpectedIdleTime );
+					/* Only reset the event list item value if the value is not
+					being used for anything else. */
+					if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+					{
+						listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxPriorityToUse ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
 
-					if( xExpectedIdleTime >= configEXPECTED_IDLE_TIME_BEFORE_SLEEP )
+					/* If the running task is not the task that holds the mutex
+					then the task that holds the mutex could be in either the
+					Ready, Blocked or Suspended states.  Only remove the task
+					from its current state list if it is in the Ready state as
+					the task's priority is going to change and there is one
+					Ready list per priority. */
+					if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
 					{
-						traceLOW_POWER_IDLE_BEGIN();
-						portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime );
-						traceLOW_POWER_IDLE_END();
+						if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+						{
+							/* It is known that the task is in its ready list so
+							there is no need to check again and the port level
+							reset macro can be called directly. */
+							portRESET_READY_PRIORITY( pxTCB->uxPriority, uxTopReadyPriority );
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+
+						prvMoveTaskBetweenReadyLists( pxTCB );
 					}
 					else
 					{
 						mtCOVERAGE_TEST_MARKER();
 					}
 				}
-				( void ) xTaskResumeAll();
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
 		}
-		#endif /* configUSE_TICKLESS_IDLE */
-	}
-}
-/*-----------------------------------------------------------*/
-
-#if( configUSE_TICKLESS_IDLE != 0 )
-
-	eSleepModeStatus eTaskConfirmSleepModeStatus( void )
-	{
-	/* The idle task exists in addition to the application tasks. */
-	const UBaseType_t uxNonApplicationTasks = 1;
-	eSleepModeStatus eReturn = eStandardSleep;
-
-		if( listCURRENT_LIST_LENGTH( &xPendingReadyList ) != 0 )
-		{
-			/* A task was made ready while the scheduler was suspended. */
-			eReturn = eAbortSleep;
-		}
-		else if( xYieldPending != pdFALSE )
-		{
-			/* A yield was pended while the scheduler was suspended. */
-			eReturn = eAbortSleep;
-		}
 		else
 		{
-			/* If all the tasks are in the suspended list (which might mean they
-			have an infinite block time rather than actually being suspended)
-			then it is safe to turn all clocks off and just wait for external
-			interrupts. */
-			if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == ( uxCurrentNumberOfTasks - uxNonApplicationTasks ) )
-			{
-				eReturn = eNoTasksWaitingTimeout;
-			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
+			mtCOVERAGE_TEST_MARKER();
 		}
-
-		return eReturn;
 	}
 
-#endif /* configUSE_TICKLESS_IDLE */
+#endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
-#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
+#if ( portCRITICAL_NESTING_IN_TCB == 1 )
 
-	void vTaskSetThreadLocalStoragePointer( TaskHandle_t xTaskToSet, BaseType_t xIndex, void *pvValue )
+	void vTaskEnterCritical( void )
 	{
-	TCB_t *pxTCB;
+		portDISABLE_INTERRUPTS();
 
-		if( xIndex < configNUM_THREAD_LOCAL_STORAGE_POINTERS )
+		if( xSchedulerRunning != pdFALSE )
 		{
-			pxTCB = prvGetTCBFromHandle( xTaskToSet );
-			pxTCB->pvThreadLocalStoragePointers[ xIndex ] = pvValue;
-		}
-	}
-
-#endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
-/*-----------------------------------------------------------*/
-
-#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
+			#if ( configNUM_CORES > 1 )
+			{
+				/* The locks are only taken by the outermost critical section.
+				The task lock is always taken before the ISR lock. */
+				if( pxCurrentTCB->uxCriticalNesting == 0U )
+				{
+					portGET_TASK_LOCK();
+					portGET_ISR_LOCK();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configNUM_CORES */
 
-	void *pvTaskGetThreadLocalStoragePointer( TaskHandle_t xTaskToQuery, BaseType_t xIndex )
-	{
-	void *pvReturn = NULL;
-	TCB_t *pxTCB;
+			( pxCurrentTCB->uxCriticalNesting )++;
 
-		if( xIndex < configNUM_THREAD_LOCAL_STORAGE_POINTERS )
-		{
-			pxTCB = prvGetTCBFromHandle( xTaskToQuery );
-			pvReturn = pxTCB->pvThreadLocalStoragePointers[ xIndex ];
+			/* This is not the interrupt safe version of the enter critical
+			function so	assert() if it is being called from an interrupt
+			context.  Only API functions that end in "FromISR" can be used in an
+			interrupt.  Only assert if the critical nesting count is 1 to
+			protect against recursive calls if the assert function also uses a
+			critical section. */
+			if( pxCurrentTCB->uxCriticalNesting == 1 )
+			{
+				portASSERT_IF_IN_ISR();
+			}
 		}
 		else
 		{
-			pvReturn = NULL;
+			mtCOVERAGE_TEST_MARKER();
 		}
-
-		return pvReturn;
-	}
-
-#endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
-/*-----------------------------------------------------------*/
-
-#if ( portUSING_MPU_WRAPPERS == 1 )
-
-	void vTaskAllocateMPURegions( TaskHandle_t xTaskToModify, const MemoryRegion_t * const xRegions )
-	{
-	TCB_t *pxTCB;
-
-		/* If null is passed in here then we are modifying the MPU settings of
-		the calling task. */
-		pxTCB = prvGetTCBFromHandle( xTaskToModify );
-
-		vPortStoreTaskMPUSettings( &( pxTCB->xMPUSettings ), xRegions, NULL, 0 );
-	}
-
-#endif /* portUSING_MPU_WRAPPERS */
-/*-----------------------------------------------------------*/
-
-static void prvInitialiseTaskLists( void )
-{
-UBaseType_t uxPriority;
-
-	for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configMAX_PRIORITIES; uxPriority++ )
-	{
-		vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
-	}
-
-	vListInitialise( &xDelayedTaskList1 );
-	vListInitialise( &xDelayedTaskList2 );
-	vListInitialise( &xPendingReadyList );
-
-	#if ( INCLUDE_vTaskDelete == 1 )
-	{
-		vListInitialise( &xTasksWaitingTermination );
-	}
-	#endif /* INCLUDE_vTaskDelete */
-
-	#if ( INCLUDE_vTaskSuspend == 1 )
-	{
-		vListInitialise( &xSuspendedTaskList );
 	}
-	#endif /* INCLUDE_vTaskSuspend */
-
-	/* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
-	using list2. */
-	pxDelayedTaskList = &xDelayedTaskList1;
-	pxOverflowDelayedTaskList = &xDelayedTaskList2;
-}
-/*-----------------------------------------------------------*/
-
-static void prvCheckTasksWaitingTermination( void )
-{
-
-	/** THIS FUNCTION IS CALLED FROM THE RTOS IDLE TASK **/
-
-	#if ( INCLUDE_vTaskDelete == 1 )
-	{
-		TCB_t *pxTCB;
-
-		/* uxDeletedTasksWaitingCleanUp is used to prevent taskENTER_CRITICAL()
-		being called too often in the idle task. */
-		while( uxDeletedTasksWaitingCleanUp > ( UBaseType_t ) 0U )
-		{
-			taskENTER_CRITICAL();
-			{
-				pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-				( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-				--uxCurrentNumberOfTasks;
-				--uxDeletedTasksWaitingCleanUp;
-			}
-			taskEXIT_CRITICAL();
 
-			prvDeleteTCB( pxTCB );
-		}
-	}
-	#endif /* INCLUDE_vTaskDelete */
-}
+#endif /* portCRITICAL_NESTING_IN_TCB */
 /*-----------------------------------------------------------*/
 
-#if( configUSE_TRACE_FACILITY == 1 )
+#if ( portCRITICAL_NESTING_IN_TCB == 1 )
 
-	void vTaskGetInfo( TaskHandle_t xTask, TaskStatus_t *pxTaskStatus, BaseType_t xGetFreeStackSpace, eTaskState eState )
+	void vTaskExitCritical( void )
 	{
-	TCB_t *pxTCB;
-
-		/* xTask is NULL then get the state of the calling task. */
-		pxTCB = prvGetTCBFromHandle( xTask );
-
-		pxTaskStatus->xHandle = ( TaskHandle_t ) pxTCB;
-		pxTaskStatus->pcTaskName = ( const char * ) &( pxTCB->pcTaskName [ 0 ] );
-		pxTaskStatus->uxCurrentPriority = pxTCB->uxPriority;
-		pxTaskStatus->pxStackBase = pxTCB->pxStack;
-		pxTaskStatus->xTaskNumber = pxTCB->uxTCBNumber;
-
-		#if ( configUSE_MUTEXES == 1 )
-		{
-			pxTaskStatus->uxBasePriority = pxTCB->uxBasePriority;
-		}
-		#else
-		{
-			pxTaskStatus->uxBasePriority = 0;
-		}
-		#endif
-
-		#if ( configGENERATE_RUN_TIME_STATS == 1 )
-		{
-			pxTaskStatus->ulRunTimeCounter = pxTCB->ulRunTimeCounter;
-		}
-		#else
-		{
-			pxTaskStatus->ulRunTimeCounter = 0;
-		}
-		#endif
-
-		/* Obtaining the task state is a little fiddly, so is only done if the
-		value of eState passed into this function is eInvalid - otherwise the
-		state is just set to whatever is passed in. */
-		if( eState != eInvalid )
+		if( xSchedulerRunning != pdFALSE )
 		{
-			if( pxTCB == pxCurrentTCB )
-			{
-				pxTaskStatus->eCurrentState = eRunning;
-			}
-			else
+			if( pxCurrentTCB->uxCriticalNesting > 0U )
 			{
-				pxTaskStatus->eCurrentState = eState;
+				( pxCurrentTCB->uxCriticalNesting )--;
 
-				#if ( INCLUDE_vTaskSuspend == 1 )
+				if( pxCurrentTCB->uxCriticalNesting == 0U )
 				{
-					/* If the task is in the suspended list then there is a
-					chance it is actually just blocked indefinitely - so really
-					it should be reported as being in the Blocked state. */
-					if( eState == eSuspended )
+					#if ( configNUM_CORES > 1 )
 					{
-						vTaskSuspendAll();
+					BaseType_t xYieldCurrentTask;
+
+						/* A yield requested while the locks were held was
+						deferred by vTaskYieldWithinAPI().  Latch it before
+						interrupts are re-enabled. */
+						xYieldCurrentTask = ( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE ) ? xYieldPending : pdFALSE;
+
+						portRELEASE_ISR_LOCK();
+						portRELEASE_TASK_LOCK();
+						portENABLE_INTERRUPTS();
+
+						if( xYieldCurrentTask != pdFALSE )
 						{
-							if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
-							{
-								pxTaskStatus->eCurrentState = eBlocked;
-							}
+							portYIELD();
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
 						}
-						( void ) xTaskResumeAll();
 					}
+					#else
+					{
+						portENABLE_INTERRUPTS();
+					}
+					#endif /* configNUM_CORES */
 				}
-				#endif /* INCLUDE_vTaskSuspend */
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
 			}
 		}
 		else
 		{
-			pxTaskStatus->eCurrentState = eTaskGetState( pxTCB );
+			mtCOVERAGE_TEST_MARKER();
 		}
+	}
 
-		/* Obtaining the stack space takes some time, so the xGetFreeStackSpace
-		parameter is provided to allow it to be skipped. */
-		if( xGetFreeStackSpace != pdFALSE )
+#endif /* portCRITICAL_NESTING_IN_TCB */
+/*-----------------------------------------------------------*/
+
+#if ( configNUM_CORES > 1 )
+
+	void vTaskYieldWithinAPI( void )
+	{
+		if( ( xSchedulerRunning != pdFALSE ) && ( pxCurrentTCB->uxCriticalNesting > 0U ) )
 		{
-			#if ( portSTACK_GROWTH > 0 )
-			{
-				pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxEndOfStack );
-			}
-			#else
-			{
-				pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxStack );
-			}
-			#endif
+			/* The kernel locks cannot be held across a context switch, so
+			the yield is performed when the critical section is exited.
+			Interrupts are disabled so the calling core cannot change. */
+			xYieldPending = pdTRUE;
 		}
 		else
 		{
-			pxTaskStatus->usStackHighWaterMark = 0;
+			portYIELD();
 		}
 	}
 
-#endif /* configUSE_TRACE_FACILITY */
+#endif /* configNUM_CORES */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( portCRITICAL_NESTING_IN_TCB == 1 )
 
-	static UBaseType_t prvListTasksWithinSingleList( TaskStatus_t *pxTaskStatusArray, List_t *pxList, eTaskState eState )
+	UBaseType_t uxTaskGetCriticalNesting( void )
 	{
-	configLIST_VOLATILE TCB_t *pxNextTCB, *pxFirstTCB;
-	UBaseType_t uxTask = 0;
+		/* Called by the port from the trap handler, after a context switch,
+		to apply the interrupt mask of the task being switched in. */
+		return pxCurrentTCB->uxCriticalNesting;
+	}
 
-		if( listCURRENT_LIST_LENGTH( pxList ) > ( UBaseType_t ) 0 )
+#endif /* portCRITICAL_NESTING_IN_TCB */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_CORE_AFFINITY == 1 )
+
+	void vTaskCoreAffinitySet( const TaskHandle_t xTask, UBaseType_t uxCoreAffinityMask )
+	{
+	TCB_t *pxTCB;
+
+		taskENTER_CRITICAL();
 		{
-			listGET_OWNER_OF_NEXT_ENTRY( pxFirstTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+			/* If null is passed in here then it is the affinity of the calling
+			task that is being changed. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+			pxTCB->uxCoreAffinityMask = uxCoreAffinityMask;
 
-			/* Populate an TaskStatus_t structure within the
-			pxTaskStatusArray array for each task that is referenced from
-			pxList.  See the definition of TaskStatus_t in task.h for the
-			meaning of each TaskStatus_t structure member. */
-			do
+			if( xSchedulerRunning != pdFALSE )
 			{
-				listGET_OWNER_OF_NEXT_ENTRY( pxNextTCB, pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-				vTaskGetInfo( ( TaskHandle_t ) pxNextTCB, &( pxTaskStatusArray[ uxTask ] ), pdTRUE, eState );
-				uxTask++;
-			} while( pxNextTCB != pxFirstTCB );
+				if( taskTASK_IS_RUNNING( pxTCB ) )
+				{
+					/* The task must leave the core it is running on if that core
+					is no longer in its affinity mask. */
+					if( taskCORE_IS_ALLOWED( pxTCB, pxTCB->xTaskRunState ) == pdFALSE )
+					{
+						if( pxTCB->xTaskRunState == ( BaseType_t ) portGET_CORE_ID() )
+						{
+							portYIELD_WITHIN_API();
+						}
+						else
+						{
+							portYIELD_CORE( pxTCB->xTaskRunState );
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+				{
+					/* A ready task may now be able to preempt a core it was
+					not allowed to use before. */
+					if( taskTASK_PREEMPTS_CURRENT( pxTCB ) != pdFALSE )
+					{
+						taskYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
-		else
+		taskEXIT_CRITICAL();
+	}
+
+#endif /* configUSE_CORE_AFFINITY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_CORE_AFFINITY == 1 )
+
+	UBaseType_t uxTaskCoreAffinityGet( const TaskHandle_t xTask )
+	{
+	const TCB_t *pxTCB;
+	UBaseType_t uxCoreAffinityMask;
+
+		taskENTER_CRITICAL();
 		{
-			mtCOVERAGE_TEST_MARKER();
+			pxTCB = prvGetTCBFromHandle( xTask );
+			uxCoreAffinityMask = pxTCB->uxCoreAffinityMask;
 		}
+		taskEXIT_CRITICAL();
 
-		return uxTask;
+		return uxCoreAffinityMask;
 	}
 
-#endif /* configUSE_TRACE_FACILITY */
+#endif /* configUSE_CORE_AFFINITY */
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) )
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
 
-	static configSTACK_DEPTH_TYPE prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte )
+	static char *prvWriteNameToBuffer( char *pcBuffer, const char *pcTaskName )
 	{
-	uint32_t ulCount = 0U;
+	size_t x;
 
-		while( *pucStackByte == ( uint8_t ) tskSTACK_FILL_BYTE )
+		/* Start by copying the entire string. */
+		strcpy( pcBuffer, pcTaskName );
+
+		/* Pad the end of the string with spaces to ensure columns line up when
+		printed out. */
+		for( x = strlen( pcBuffer ); x < ( size_t ) ( configMAX_TASK_NAME_LEN - 1 ); x++ )
 		{
-			pucStackByte -= portSTACK_GROWTH;
-			ulCount++;
+			pcBuffer[ x ] = ' ';
 		}
 
-		ulCount /= ( uint32_t ) sizeof( StackType_t ); /*lint !e961 Casting is not redundant on smaller architectures. */
+		/* Terminate. */
+		pcBuffer[ x ] = ( char ) 0x00;
 
-		return ( configSTACK_DEPTH_TYPE ) ulCount;
+		/* Return the new end of string. */
+		return &( pcBuffer[ x ] );
 	}
 
-#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 ) ) */
+#endif /* ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_uxTaskGetStackHighWaterMark2 == 1 )
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
-	/* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are the
-	same except for their return type.  Using configSTACK_DEPTH_TYPE allows the
-	user to determine the return type.  It gets around the problem of the value
-	overflowing on 8-bit types without breaking backward compatibility for
-	applications that expect an 8-bit return type. */
-	configSTACK_DEPTH_TYPE uxTaskGetStackHighWaterMark2( TaskHandle_t xTask )
+	void vTaskList( char * pcWriteBuffer )
 	{
-	TCB_t *pxTCB;
-	uint8_t *pucEndOfStack;
-	configSTACK_DEPTH_TYPE uxReturn;
+	TaskStatus_t *pxTaskStatusArray;
+	UBaseType_t uxArraySize, x;
+	char cStatus;
 
-		/* uxTaskGetStackHighWaterMark() and uxTaskGetStackHighWaterMark2() are
-		the same except for their return type.  Using configSTACK_DEPTH_TYPE
-		allows the user to determine the return type.  It gets around the
-		problem of the value overflowing on 8-bit types without breaking
-		backward compatibility for applications that expect an 8-bit return
-		type. */
+		/*
+		 * PLEASE NOTE:
+		 *
+		 * This function is provided for convenience only, and is used by many
+		 * of the demo applications.  Do not consider it to be part of the
+		 * scheduler.
+		 *
+		 * vTaskList() calls uxTaskGetSystemState(), then formats part of the
+		 * uxTaskGetSystemState() output into a human readable table that
+		 * displays task names, states and stack usage.
+		 *
+		 * vTaskList() has a dependency on the sprintf() C library function that
+		 * might bloat the code size, use a lot of stack, and provide different
+		 * results on different platforms.  An alternative, tiny, third party,
+		 * and limited functionality implementation of sprintf() is provided in
+		 * many of the FreeRTOS/Demo sub-directories in a file called
+		 * printf-stdarg.c (note printf-stdarg.c does not provide a full
+		 * snprintf() implementation!).
+		 *
+		 * It is recommended that production systems call uxTaskGetSystemState()
+		 * directly to get access to raw stats data, rather than indirectly
+		 * through a call to vTaskList().
+		 */
 
-		pxTCB = prvGetTCBFromHandle( xTask );
 
-		#if portSTACK_GROWTH < 0
-		{
-			pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
-		}
-		#else
+		/* Make sure the write buffer does not contain a string. */
+		*pcWriteBuffer = ( char ) 0x00;
+
+		/* Take a snapshot of the number of tasks in case it changes while this
+		function is executing. */
+		uxArraySize = uxCurrentNumberOfTasks;
+
+		/* Allocate an array index for each task.  NOTE!  if
+		configSUPPORT_DYNAMIC_ALLOCATION is set to 0 then pvPortMalloc() will
+		equate to NULL. */
+		pxTaskStatusArray = pvPortMalloc( uxCurrentNumberOfTasks * sizeof( TaskStatus_t ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack and this allocation allocates a struct that has the alignment requirements of a pointer. */
+
+		if( pxTaskStatusArray != NULL )
 		{
-			pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
-		}
-		#endif
+			/* Generate the (binary) data. */
+			uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, NULL );
 
-		uxReturn = prvTaskCheckFreeStackSpace( pucEndOfStack );
+			/* Create a human readable table from the binary data. */
+			for( x = 0; x < uxArraySize; x++ )
+			{
+				switch( pxTaskStatusArray[ x ].eCurrentState )
+				{
+					case eRunning:		cStatus = tskRUNNING_CHAR;
+										break;
 
-		return uxReturn;
-	}
+					case eReady:		cStatus = tskREADY_CHAR;
+										break;
 
-#endif /* INCLUDE_uxTaskGetStackHighWaterMark2 */
-/*-----------------------------------------------------------*/
+					case eBlocked:		cStatus = tskBLOCKED_CHAR;
+										break;
 
-#if ( INCLUDE_uxTaskGetStackHighWaterMark == 1 )
+					case eSuspended:	cStatus = tskSUSPENDED_CHAR;
+										break;
 
-	UBaseType_t uxTaskGetStackHighWaterMark( TaskHandle_t xTask )
-	{
-	TCB_t *pxTCB;
-	uint8_t *pucEndOfStack;
-	UBaseType_t uxReturn;
+					case eDeleted:		cStatus = tskDELETED_CHAR;
+										break;
 
-		pxTCB = prvGetTCBFromHandle( xTask );
+					case eInvalid:		/* Fall through. */
+					default:			/* Should not get here, but it is included
+										to prevent static checking errors. */
+										cStatus = ( char ) 0x00;
+										break;
+				}
+
+				/* Write the task name to the string, padding with spaces so it
+				can be printed in tabular form more easily. */
+				pcWriteBuffer = prvWriteNameToBuffer( pcWriteBuffer, pxTaskStatusArray[ x ].pcTaskName );
 
-		#if portSTACK_GROWTH < 0
+				/* Write the rest of the string. */
+				sprintf( pcWriteBuffer, "\t%c\t%u\t%u\t%u\r\n", cStatus, ( unsigned int ) pxTaskStatusArray[ x ].uxCurrentPriority, ( unsigned int ) pxTaskStatusArray[ x ].usStackHighWaterMark, ( unsigned int ) pxTaskStatusArray[ x ].xTaskNumber ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
+				pcWriteBuffer += strlen( pcWriteBuffer ); /*lint !e9016 Pointer arithmetic ok on char pointers especially as in this case where it best denotes the intent of the code. */
+			}
+
+			/* Free the array again.  NOTE!  If configSUPPORT_DYNAMIC_ALLOCATION
+			is 0 then vPortFree() will be #defined to nothing. */
+			vPortFree( pxTaskStatusArray );
+		}
+		else
 		{
-			pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
+			mtCOVERAGE_TEST_MARKER();
 		}
-		#else
+	}
+
+#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
+/*----------------------------------------------------------*/
+
+#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+	void vTaskGetRunTimeStats( char *pcWriteBuffer )
+	{
+	TaskStatus_t *pxTaskStatusArray;
+	UBaseType_t uxArraySize, x;
+	uint32_t ulTotalTime, ulStatsAsPercentage;
+
+		#if( configUSE_TRACE_FACILITY != 1 )
 		{
-			pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
+			#error configUSE_TRACE_FACILITY must also be set to 1 in FreeRTOSConfig.h to use vTaskGetRunTimeStats().
 		}
 		#endif
 
-		uxReturn = ( UBaseType_t ) prvTaskCheckFreeStackSpace( pucEndOfStack );
-
-		return uxReturn;
-	}
+		/*
+		 * PLEASE NOTE:
+		 *
+		 * This function is provided for convenience only, and is used by many
+		 * of the demo applications.  Do not consider it to be part of the
+		 * scheduler.
+		 *
+		 * vTaskGetRunTimeStats() calls uxTaskGetSystemState(), then formats part
+		 * of the uxTaskGetSystemState() output into a human readable table that
+		 * displays the amount of time each task has spent in the Running state
+		 * in both absolute and percentage terms.
+		 *
+		 * vTaskGetRunTimeStats() has a dependency on the sprintf() C library
+		 * function that might bloat the code size, use a lot of stack, and
+		 * provide different results on different platforms.  An alternative,
+		 * tiny, third party, and limited functionality implementation of
+		 * sprintf() is provided in many of the FreeRTOS/Demo sub-directories in
+		 * a file called printf-stdarg.c (note printf-stdarg.c does not provide
+		 * a full snprintf() implementation!).
+		 *
+		 * It is recommended that production systems call uxTaskGetSystemState()
+		 * directly to get access to raw stats data, rather than indirectly
+		 * through a call to vTaskGetRunTimeStats().
+		 */
 
-#endif /* INCLUDE_uxTaskGetStackHighWaterMark */
-/*-----------------------------------------------------------*/
+		/* Make sure the write buffer does not contain a string. */
+		*pcWriteBuffer = ( char ) 0x00;
 
-#if ( INCLUDE_vTaskDelete == 1 )
+		/* Take a snapshot of the number of tasks in case it changes while this
+		function is executing. */
+		uxArraySize = uxCurrentNumberOfTasks;
 
-	static void prvDeleteTCB( TCB_t *pxTCB )
-	{
-		/* This call is required specifically for the TriCore port.  It must be
-		above the vPortFree() calls.  The call is also used by ports/demos that
-		want to allocate and clean RAM statically. */
-		portCLEAN_UP_TCB( pxTCB );
+		/* Allocate an array index for each task.  NOTE!  If
+		configSUPPORT_DYNAMIC_ALLOCATION is set to 0 then pvPortMalloc() will
+		equate to NULL. */
+		pxTaskStatusArray = pvPortMalloc( uxCurrentNumberOfTasks * sizeof( TaskStatus_t ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack and this allocation allocates a struct that has the alignment requirements of a pointer. */
 
-		/* Free up the memory allocated by the scheduler for the task.  It is up
-		to the task to free any memory allocated at the application level. */
-		#if ( configUSE_NEWLIB_REENTRANT == 1 )
+		if( pxTaskStatusArray != NULL )
 		{
-			_reclaim_reent( &( pxTCB->xNewLib_reent ) );
-		}
-		#endif /* configUSE_NEWLIB_REENTRANT */
+			/* Generate the (binary) data. */
+			uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, &ulTotalTime );
 
-		#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( portUSING_MPU_WRAPPERS == 0 ) )
-		{
-			/* The task can only have been allocated dynamically - free both
-			the stack and TCB. */
-			vPortFree( pxTCB->pxStack );
-			vPortFree( pxTCB );
-		}
-		#elif( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
-		{
-			/* The task could have been allocated statically or dynamically, so
-			check what was statically allocated before trying to free the
-			memory. */
-			if( pxTCB->ucStaticallyAllocated == tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
-			{
-				/* Both the stack and TCB were allocated dynamically, so both
-				must be freed. */
-				vPortFree( pxTCB->pxStack );
-				vPortFree( pxTCB );
-			}
-			else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
+			/* For percentage calculations. */
+			ulTotalTime /= 100UL;
+
+			/* Avoid divide by zero errors. */
+			if( ulTotalTime > 0UL )
 			{
-				/* Only the stack was statically allocated, so the TCB is the
-				only memory that must be freed. */
-				vPortFree( pxTCB );
+				/* Create a human readable table from the binary data. */
+				for( x = 0; x < uxArraySize; x++ )
+				{
+					/* What percentage of the total run time has the task used?
+					This will always be rounded down to the nearest integer.
+					ulTotalRunTimeDiv100 has already been divided by 100. */
+					ulStatsAsPercentage = pxTaskStatusArray[ x ].ulRunTimeCounter / ulTotalTime;
+
+					/* Write the task name to the string, padding with
+					spaces so it can be printed in tabular form more
+					easily. */
+					pcWriteBuffer = prvWriteNameToBuffer( pcWriteBuffer, pxTaskStatusArray[ x ].pcTaskName );
+
+					if( ulStatsAsPercentage > 0UL )
+					{
+						#ifdef portLU_PRINTF_SPECIFIER_REQUIRED
+						{
+							sprintf( pcWriteBuffer, "\t%lu\t\t%lu%%\r\n", pxTaskStatusArray[ x ].ulRunTimeCounter, ulStatsAsPercentage );
+						}
+						#else
+						{
+							/* sizeof( int ) == sizeof( long ) so a smaller
+							printf() library can be used. */
+							sprintf( pcWriteBuffer, "\t%u\t\t%u%%\r\n", ( unsigned int ) pxTaskStatusArray[ x ].ulRunTimeCounter, ( unsigned int ) ulStatsAsPercentage ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
+						}
+						#endif
+					}
+					else
+					{
+						/* If the percentage is zero here then the task has
+						consumed less than 1% of the total run time. */
+						#ifdef portLU_PRINTF_SPECIFIER_REQUIRED
+						{
+							sprintf( pcWriteBuffer, "\t%lu\t\t<1%%\r\n", pxTaskStatusArray[ x ].ulRunTimeCounter );
+						}
+						#else
+						{
+							/* sizeof( int ) == sizeof( long ) so a smaller
+							printf() library can be used. */
+							sprintf( pcWriteBuffer, "\t%u\t\t<1%%\r\n", ( unsigned int ) pxTaskStatusArray[ x ].ulRunTimeCounter ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
+						}
+						#endif
+					}
+
+					pcWriteBuffer += strlen( pcWriteBuffer ); /*lint !e9016 Pointer arithmetic ok on char pointers especially as in this case where it best denotes the intent of the code. */
+				}
 			}
 			else
 			{
-				/* Neither the stack nor the TCB were allocated dynamically, so
-				nothing needs to be freed. */
-				configASSERT( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_AND_TCB	);
 				mtCOVERAGE_TEST_MARKER();
 			}
+
+			/* Free the array again.  NOTE!  If configSUPPORT_DYNAMIC_ALLOCATION
+			is 0 then vPortFree() will be #defined to nothing. */
+			vPortFree( pxTaskStatusArray );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
 		}
-		#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 	}
 
-#endif /* INCLUDE_vTaskDelete */
+#endif /* ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-static void prvResetNextTaskUnblockTime( void )
+TickType_t uxTaskResetEventItemValue( void )
 {
-TCB_t *pxTCB;
+TickType_t uxReturn;
 
-	if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
-	{
-		/* The new current delayed list is empty.  Set xNextTaskUnblockTime to
-		the maximum possible value so it is	extremely unlikely that the
-		if( xTickCount >= xNextTaskUnblockTime ) test will pass until
-		there is an item in the delayed list. */
-		xNextTaskUnblockTime = portMAX_DELAY;
-	}
-	else
-	{
-		/* The new current delayed list is not empty, get the value of
-		the item at the head of the delayed list.  This is the time at
-		which the task at the head of the delayed list should be removed
-		from the Blocked state. */
-		( pxTCB ) = listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-		xNextTaskUnblockTime = listGET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ) );
-	}
+	uxReturn = listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ) );
+
+	/* Reset the event list item to its normal value - so it can be used with
+	queues and semaphores. */
+	listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+	return uxReturn;
 }
 /*-----------------------------------------------------------*/
 
-#if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) )
+#if ( configUSE_MUTEXES == 1 )
 
-	TaskHandle_t xTaskGetCurrentTaskHandle( void )
+	TaskHandle_t pvTaskIncrementMutexHeldCount( void )
 	{
-	TaskHandle_t xReturn;
-
-		/* A critical section is not required as this is not called from
-		an interrupt and the current TCB will always be the same for any
-		individual execution thread. */
-		xReturn = pxCurrentTCB;
+		/* If xSemaphoreCreateMutex() is called before any tasks have been created
+		then pxCurrentTCB will be NULL. */
+		if( pxCurrentTCB != NULL )
+		{
+			( pxCurrentTCB->uxMutexesHeld )++;
+		}
 
-		return xReturn;
+		return pxCurrentTCB;
 	}
 
-#endif /* ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) ) */
+#endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
-#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+#if ( configUSE_CEILING_MUTEXES == 1 )
 
-	BaseType_t xTaskGetSchedulerState( void )
+	static void prvSetRunningTaskPriority( TCB_t * const pxTCB, const UBaseType_t uxNewPriority )
 	{
-	BaseType_t xReturn;
-
-		if( xSchedulerRunning == pdFALSE )
+		/* The task is running, so is in its ready list and its event list item
+		is not in use. */
+		if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
 		{
-			xReturn = taskSCHEDULER_NOT_STARTED;
+			taskRESET_READY_PRIORITY( pxTCB->uxPriority );
 		}
 		else
 		{
-			if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
-			{
-				xReturn = taskSCHEDULER_RUNNING;
-			}
-			else
-			{
-				xReturn = taskSCHEDULER_SUSPENDED;
-			}
+			mtCOVERAGE_TEST_MARKER();
 		}
 
-		return xReturn;
+		pxTCB->uxPriority = uxNewPriority;
+		listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+		prvMoveTaskBetweenReadyLists( pxTCB );
 	}
+	/*-----------------------------------------------------------*/
 
-#endif /* ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) ) */
-/*-----------------------------------------------------------*/
-
-#if ( configUSE_MUTEXES == 1 )
-
-	BaseType_t xTaskPriorityInherit( TaskHandle_t const pxMutexHolder )
-	{
-	TCB_t * const pxMutexHolderTCB = pxMutexHolder;
-	BaseType_t xReturn = pdFALSE;
-
-		/* If the mutex was given back by an interrupt while the queue was
-		locked then the mutex holder might now be NULL.  _RB_ Is this still
-		needed as interrupts can no longer use mutexes? */
-		if( pxMutexHolder != NULL )
-		{
-			/* If the holder of the mutex has a priority below the priority of
-			the task attempting to obtain the mutex then it will temporarily
-			inherit the priority of the task attempting to obtain the mutex. */
-			if( pxMutexHolderTCB->uxPriority < pxCurrentTCB->uxPriority )
-			{
-				/* Adjust the mutex holder state to account for its new
-				priority.  Only reset the event list item value if the value is
-				not being used for anything else. */
-				if( ( listGET_LIST_ITEM_VALUE( &( pxMutexHolderTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
-				{
-					listSET_LIST_ITEM_VALUE( &( pxMutexHolderTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
-
-				/* If the task being modified is in the ready state it will need
-				to be moved into a new list. */
-				if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxMutexHolderTCB->uxPriority ] ), &( pxMutexHolderTCB->xStateListItem ) ) != pdFALSE )
-				{
-					if( uxListRemove( &( pxMutexHolderTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
-					{
-						/* It is known that the task is in its ready list so
-						there is no need to check again and the port level
-						reset macro can be called directly. */
-						portRESET_READY_PRIORITY( pxMutexHolderTCB->uxPriority, uxTopReadyPriority );
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-
-					/* Inherit the priority before being moved into the new list. */
-					pxMutexHolderTCB->uxPriority = pxCurrentTCB->uxPriority;
-					prvAddTaskToReadyList( pxMutexHolderTCB );
-				}
-				else
-				{
-					/* Just inherit the priority. */
-					pxMutexHolderTCB->uxPriority = pxCurrentTCB->uxPriority;
-				}
+	UBaseType_t uxTaskPriorityRaiseToCeiling( UBaseType_t uxCeilingPriority )
+	{
+	UBaseType_t uxPriorityBeforeCeiling = tskIDLE_PRIORITY;
 
-				traceTASK_PRIORITY_INHERIT( pxMutexHolderTCB, pxCurrentTCB->uxPriority );
+		/* Called from a critical section by the task that has just taken the
+		mutex.  pxCurrentTCB is NULL if the mutex is taken before any tasks
+		have been created. */
+		if( pxCurrentTCB != NULL )
+		{
+			/* A task with a base priority above the ceiling could be
+			preempted by nothing while holding the mutex, which means the
+			ceiling was set too low for the tasks that use it. */
+			configASSERT( pxCurrentTCB->uxBasePriority <= uxCeilingPriority );
 
-				/* Inheritance occurred. */
-				xReturn = pdTRUE;
+			uxPriorityBeforeCeiling = pxCurrentTCB->uxPriority;
+
+			/* The task might already be above the ceiling if it has inherited
+			a priority through another mutex. */
+			if( pxCurrentTCB->uxPriority < uxCeilingPriority )
+			{
+				traceTASK_PRIORITY_INHERIT( pxCurrentTCB, uxCeilingPriority );
+				prvSetRunningTaskPriority( pxCurrentTCB, uxCeilingPriority );
 			}
 			else
 			{
-				if( pxMutexHolderTCB->uxBasePriority < pxCurrentTCB->uxPriority )
-				{
-					/* The base priority of the mutex holder is lower than the
-					priority of the task attempting to take the mutex, but the
-					current priority of the mutex holder is not lower than the
-					priority of the task attempting to take the mutex.
-					Therefore the mutex holder must have already inherited a
-					priority, but inheritance would have occurred if that had
-					not been the case. */
-					xReturn = pdTRUE;
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
+				mtCOVERAGE_TEST_MARKER();
 			}
 		}
 		else
@@ -4113,70 +8658,42 @@ TCB_t *pxTCB;
 			mtCOVERAGE_TEST_MARKER();
 		}
 
-		return xReturn;
+		return uxPriorityBeforeCeiling;
 	}
+	/*-----------------------------------------------------------*/
 
-#endif /* configUSE_MUTEXES */
-/*-----------------------------------------------------------*/
-
-#if ( configUSE_MUTEXES == 1 )
-
-	BaseType_t xTaskPriorityDisinherit( TaskHandle_t const pxMutexHolder )
+	BaseType_t xTaskPriorityRestoreFromCeiling( TaskHandle_t const pxMutexHolder, UBaseType_t uxCeilingPriority, UBaseType_t uxPriorityBeforeCeiling )
 	{
 	TCB_t * const pxTCB = pxMutexHolder;
+	UBaseType_t uxPriorityToUse;
 	BaseType_t xReturn = pdFALSE;
 
 		if( pxMutexHolder != NULL )
 		{
-			/* A task can only have an inherited priority if it holds the mutex.
-			If the mutex is held by a task then it cannot be given from an
-			interrupt, and if a mutex is given by the holding task then it must
-			be the running state task. */
+			/* As xTaskPriorityDisinherit(), only the holder can give the
+			mutex back. */
 			configASSERT( pxTCB == pxCurrentTCB );
 			configASSERT( pxTCB->uxMutexesHeld );
 			( pxTCB->uxMutexesHeld )--;
 
-			/* Has the holder of the mutex inherited the priority of another
-			task? */
-			if( pxTCB->uxPriority != pxTCB->uxBasePriority )
+			if( pxTCB->uxMutexesHeld == ( UBaseType_t ) 0 )
 			{
-				/* Only disinherit if no other mutexes are held. */
-				if( pxTCB->uxMutexesHeld == ( UBaseType_t ) 0 )
-				{
-					/* A task can only have an inherited priority if it holds
-					the mutex.  If the mutex is held by a task then it cannot be
-					given from an interrupt, and if a mutex is given by the
-					holding task then it must be the running state task.  Remove
-					the holding task from the ready/delayed list. */
-					if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
-					{
-						taskRESET_READY_PRIORITY( pxTCB->uxPriority );
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-
-					/* Disinherit the priority before adding the task into the
-					new	ready list. */
-					traceTASK_PRIORITY_DISINHERIT( pxTCB, pxTCB->uxBasePriority );
-					pxTCB->uxPriority = pxTCB->uxBasePriority;
-
-					/* Reset the event list item value.  It cannot be in use for
-					any other purpose if this task is running, and it must be
-					running to give back the mutex. */
-					listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-					prvAddTaskToReadyList( pxTCB );
+				/* No other mutexes are held so nothing else can be raising the
+				task's priority. */
+				uxPriorityToUse = pxTCB->uxBasePriority;
+			}
+			else if( pxTCB->uxPriority == uxCeilingPriority )
+			{
+				/* Go back to the priority the task had when it took this mutex,
+				which will be the ceiling of the ceiling mutex it took before
+				this one if any.  That only holds if ceiling mutexes are given
+				back in the reverse order to that in which they were taken. */
+				uxPriorityToUse = uxPriorityBeforeCeiling;
 
-					/* Return true to indicate that a context switch is required.
-					This is only actually required in the corner case whereby
-					multiple mutexes were held and the mutexes were given back
-					in an order different to that in which they were taken.
-					If a context switch did not occur when the first mutex was
-					returned, even if a task was waiting on it, then a context
-					switch should occur when the last mutex is returned whether
-					a task is waiting on it or not. */
-					xReturn = pdTRUE;
+				if( uxPriorityToUse < pxTCB->uxBasePriority )
+				{
+					/* The base priority was raised while the mutex was held. */
+					uxPriorityToUse = pxTCB->uxBasePriority;
 				}
 				else
 				{
@@ -4184,6 +8701,28 @@ TCB_t *pxTCB;
 				}
 			}
 			else
+			{
+				/* The priority has been raised further by another mutex, which
+				will restore it when it is given back. */
+				uxPriorityToUse = pxTCB->uxPriority;
+			}
+
+			#if( configUSE_TASK_RENDEZVOUS == 1 )
+			{
+				/* Keep the priority of any task calling the holder. */
+				uxPriorityToUse = prvRendezvousGetInheritedPriority( pxTCB, uxPriorityToUse );
+			}
+			#endif /* configUSE_TASK_RENDEZVOUS */
+
+			if( uxPriorityToUse != pxTCB->uxPriority )
+			{
+				traceTASK_PRIORITY_DISINHERIT( pxTCB, uxPriorityToUse );
+				prvSetRunningTaskPriority( pxTCB, uxPriorityToUse );
+
+				/* A task the holder was keeping out may now be able to run. */
+				xReturn = pdTRUE;
+			}
+			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
@@ -4196,94 +8735,110 @@ TCB_t *pxTCB;
 		return xReturn;
 	}
 
-#endif /* configUSE_MUTEXES */
+#endif /* configUSE_CEILING_MUTEXES */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_MUTEXES == 1 )
+#if( configUSE_TASK_NOTIFICATIONS == 1 )
 
-	void vTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder, UBaseType_t uxHighestPriorityWaitingTask )
+	uint32_t ulTaskGenericNotifyTake( UBaseType_t uxIndexToWait, BaseType_t xClearCountOnExit, TickType_t xTicksToWait )
 	{
-	TCB_t * const pxTCB = pxMutexHolder;
-	UBaseType_t uxPriorityUsedOnEntry, uxPriorityToUse;
-	const UBaseType_t uxOnlyOneMutexHeld = ( UBaseType_t ) 1;
+	uint32_t ulReturn;
 
-		if( pxMutexHolder != NULL )
-		{
-			/* If pxMutexHolder is not NULL then the holder must hold at least
-			one mutex. */
-			configASSERT( pxTCB->uxMutexesHeld );
+		configASSERT( uxIndexToWait < configTASK_NOTIFICATION_ARRAY_ENTRIES );
 
-			/* Determine the priority to which the priority of the task that
-			holds the mutex should be set.  This will be the greater of the
-			holding task's base priority and the priority of the highest
-			priority task that is waiting to obtain the mutex. */
-			if( pxTCB->uxBasePriority < uxHighestPriorityWaitingTask )
+		taskENTER_CRITICAL();
+		{
+			/* Only block if the notification count is not already non-zero. */
+			if( pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] == 0UL )
 			{
-				uxPriorityToUse = uxHighestPriorityWaitingTask;
+				/* Mark this task as waiting for a notification. */
+				pxCurrentTCB->ucNotifyState[ uxIndexToWait ] = taskWAITING_NOTIFICATION;
+
+				if( xTicksToWait > ( TickType_t ) 0 )
+				{
+					prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+					traceTASK_NOTIFY_TAKE_BLOCK();
+
+					/* All ports are written to allow a yield in a critical
+					section (some will yield immediately, others wait until the
+					critical section exits) - but it is not something that
+					application code should ever do. */
+					portYIELD_WITHIN_API();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
 			else
 			{
-				uxPriorityToUse = pxTCB->uxBasePriority;
+				mtCOVERAGE_TEST_MARKER();
 			}
+		}
+		taskEXIT_CRITICAL();
 
-			/* Does the priority need to change? */
-			if( pxTCB->uxPriority != uxPriorityToUse )
+		taskENTER_CRITICAL();
+		{
+			traceTASK_NOTIFY_TAKE();
+			ulReturn = pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ];
+
+			if( ulReturn != 0UL )
 			{
-				/* Only disinherit if no other mutexes are held.  This is a
-				simplification in the priority inheritance implementation.  If
-				the task that holds the mutex is also holding other mutexes then
-				the other mutexes may have caused the priority inheritance. */
-				if( pxTCB->uxMutexesHeld == uxOnlyOneMutexHeld )
+				if( xClearCountOnExit != pdFALSE )
 				{
-					/* If a task has timed out because it already holds the
-					mutex it was trying to obtain then it cannot of inherited
-					its own priority. */
-					configASSERT( pxTCB != pxCurrentTCB );
+					pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] = 0UL;
+				}
+				else
+				{
+					pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] = ulReturn - ( uint32_t ) 1;
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 
-					/* Disinherit the priority, remembering the previous
-					priority to facilitate determining the subject task's
-					state. */
-					traceTASK_PRIORITY_DISINHERIT( pxTCB, pxTCB->uxBasePriority );
-					uxPriorityUsedOnEntry = pxTCB->uxPriority;
-					pxTCB->uxPriority = uxPriorityToUse;
+			pxCurrentTCB->ucNotifyState[ uxIndexToWait ] = taskNOT_WAITING_NOTIFICATION;
+		}
+		taskEXIT_CRITICAL();
 
-					/* Only reset the event list item value if the value is not
-					being used for anything else. */
-					if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
-					{
-						listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxPriorityToUse ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+		return ulReturn;
+	}
 
-					/* If the running task is not the task that holds the mutex
-					then the task that holds the mutex could be in either the
-					Ready, Blocked or Suspended states.  Only remove the task
-					from its current state list if it is in the Ready state as
-					the task's priority is going to change and there is one
-					Ready list per priority. */
-					if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
-					{
-						if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
-						{
-							/* It is known that the task is in its ready list so
-							there is no need to check again and the port level
-							reset macro can be called directly. */
-							portRESET_READY_PRIORITY( pxTCB->uxPriority, uxTopReadyPriority );
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
+#endif /* configUSE_TASK_NOTIFICATIONS */
+/*-----------------------------------------------------------*/
 
-						prvAddTaskToReadyList( pxTCB );
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
+#if( configUSE_TASK_NOTIFICATIONS == 1 )
+
+	BaseType_t xTaskGenericNotifyWait( UBaseType_t uxIndexToWait, uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait )
+	{
+	BaseType_t xReturn;
+
+		configASSERT( uxIndexToWait < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+
+		taskENTER_CRITICAL();
+		{
+			/* Only block if a notification is not already pending. */
+			if( pxCurrentTCB->ucNotifyState[ uxIndexToWait ] != taskNOTIFICATION_RECEIVED )
+			{
+				/* Clear bits in the task's notification value as bits may get
+				set	by the notifying task or interrupt.  This can be used to
+				clear the value to zero. */
+				pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] &= ~ulBitsToClearOnEntry;
+
+				/* Mark this task as waiting for a notification. */
+				pxCurrentTCB->ucNotifyState[ uxIndexToWait ] = taskWAITING_NOTIFICATION;
+
+				if( xTicksToWait > ( TickType_t ) 0 )
+				{
+					prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+					traceTASK_NOTIFY_WAIT_BLOCK();
+
+					/* All ports are written to allow a yield in a critical
+					section (some will yield immediately, others wait until the
+					critical section exits) - but it is not something that
+					application code should ever do. */
+					portYIELD_WITHIN_API();
 				}
 				else
 				{
@@ -4292,61 +8847,145 @@ TCB_t *pxTCB;
 			}
 			else
 			{
-				mtCOVERAGE_TEST_MARKER();
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		taskENTER_CRITICAL();
+		{
+			traceTASK_NOTIFY_WAIT();
+
+			if( pulNotificationValue != NULL )
+			{
+				/* Output the current notification value, which may or may not
+				have changed. */
+				*pulNotificationValue = pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ];
+			}
+
+			/* If ucNotifyValue is set then either the task never entered the
+			blocked state (because a notification was already pending) or the
+			task unblocked because of a notification.  Otherwise the task
+			unblocked because of a timeout. */
+			if( pxCurrentTCB->ucNotifyState[ uxIndexToWait ] != taskNOTIFICATION_RECEIVED )
+			{
+				/* A notification was not received. */
+				xReturn = pdFALSE;
+			}
+			else
+			{
+				/* A notification was already pending or a notification was
+				received while the task was waiting. */
+				pxCurrentTCB->ulNotifiedValue[ uxIndexToWait ] &= ~ulBitsToClearOnExit;
+				xReturn = pdTRUE;
 			}
+
+			pxCurrentTCB->ucNotifyState[ uxIndexToWait ] = taskNOT_WAITING_NOTIFICATION;
 		}
-		else
-		{
-			mtCOVERAGE_TEST_MARKER();
-		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
 	}
 
-#endif /* configUSE_MUTEXES */
+#endif /* configUSE_TASK_NOTIFICATIONS */
 /*-----------------------------------------------------------*/
 
-#if ( portCRITICAL_NESTING_IN_TCB == 1 )
+#if( configUSE_TASK_NOTIFICATIONS == 1 )
 
-	void vTaskEnterCritical( void )
+	BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue )
 	{
-		portDISABLE_INTERRUPTS();
+	TCB_t * pxTCB;
+	BaseType_t xReturn = pdPASS;
+	uint8_t ucOriginalNotifyState;
 
-		if( xSchedulerRunning != pdFALSE )
-		{
-			( pxCurrentTCB->uxCriticalNesting )++;
+		configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+		configASSERT( xTaskToNotify );
+		pxTCB = xTaskToNotify;
 
-			/* This is not the interrupt safe version of the enter critical
-			function so	assert() if it is being called from an interrupt
-			context.  Only API functions that end in "FromISR" can be used in an
-			interrupt.  Only assert if the critical nesting count is 1 to
-			protect against recursive calls if the assert function also uses a
-			critical section. */
-			if( pxCurrentTCB->uxCriticalNesting == 1 )
+		taskENTER_CRITICAL();
+		{
+			if( pulPreviousNotificationValue != NULL )
 			{
-				portASSERT_IF_IN_ISR();
+				*pulPreviousNotificationValue = pxTCB->ulNotifiedValue[ uxIndexToNotify ];
 			}
-		}
-		else
-		{
-			mtCOVERAGE_TEST_MARKER();
-		}
-	}
 
-#endif /* portCRITICAL_NESTING_IN_TCB */
-/*-----------------------------------------------------------*/
+			ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
 
-#if ( portCRITICAL_NESTING_IN_TCB == 1 )
+			pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
 
-	void vTaskExitCritical( void )
-	{
-		if( xSchedulerRunning != pdFALSE )
-		{
-			if( pxCurrentTCB->uxCriticalNesting > 0U )
+			switch( eAction )
 			{
-				( pxCurrentTCB->uxCriticalNesting )--;
+				case eSetBits	:
+					pxTCB->ulNotifiedValue[ uxIndexToNotify ] |= ulValue;
+					break;
 
-				if( pxCurrentTCB->uxCriticalNesting == 0U )
+				case eIncrement	:
+					( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
+					break;
+
+				case eSetValueWithOverwrite	:
+					pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
+					break;
+
+				case eSetValueWithoutOverwrite :
+					if( ucOriginalNotifyState != taskNOTIFICATION_RECEIVED )
+					{
+						pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
+					}
+					else
+					{
+						/* The value could not be written to the task. */
+						xReturn = pdFAIL;
+					}
+					break;
+
+				case eNoAction:
+					/* The task is being notified without its notify value being
+					updated. */
+					break;
+
+				default:
+					/* Should not get here if all enums are handled.
+					Artificially force an assert by testing a value the
+					compiler can't assume is const. */
+					configASSERT( pxTCB->ulNotifiedValue[ uxIndexToNotify ] == ~0UL );
+
+					break;
+			}
+
+			traceTASK_NOTIFY();
+
+			/* If the task is in the blocked state specifically to wait for a
+			notification then unblock it now. */
+			if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
+			{
+				( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+				prvAddTaskToReadyList( pxTCB );
+
+				/* The task should not have been on an event list. */
+				configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+
+				#if( configUSE_TICKLESS_IDLE != 0 )
+				{
+					/* If a task is blocked waiting for a notification then
+					xNextTaskUnblockTime might be set to the blocked task's time
+					out time.  If the task is unblocked for a reason other than
+					a timeout xNextTaskUnblockTime is normally left unchanged,
+					because it will automatically get reset to a new value when
+					the tick count equals xNextTaskUnblockTime.  However if
+					tickless idling is used it might be more important to enter
+					sleep mode at the earliest possible time - so reset
+					xNextTaskUnblockTime here to ensure it is updated at the
+					earliest possible time. */
+					prvResetNextTaskUnblockTime();
+				}
+				#endif
+
+				if( taskTASK_PREEMPTS_CURRENT( pxTCB ) )
 				{
-					portENABLE_INTERRUPTS();
+					/* The notified task has a priority above the currently
+					executing task so a yield is required. */
+					taskYIELD_IF_USING_PREEMPTION();
 				}
 				else
 				{
@@ -4358,797 +8997,764 @@ TCB_t *pxTCB;
 				mtCOVERAGE_TEST_MARKER();
 			}
 		}
-		else
-		{
-			mtCOVERAGE_TEST_MARKER();
-		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
 	}
 
-#endif /* portCRITICAL_NESTING_IN_TCB */
+#endif /* configUSE_TASK_NOTIFICATIONS */
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+#if( configUSE_TASK_NOTIFICATIONS == 1 )
 
-	static char *prvWriteNameToBuffer( char *pcBuffer, const char *pcTaskName )
+	BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue, BaseType_t *pxHigherPriorityTaskWoken )
 	{
-	size_t x;
-
-		/* Start by copying the entire string. */
-		strcpy( pcBuffer, pcTaskName );
-
-		/* Pad the end of the string with spaces to ensure columns line up when
-		printed out. */
-		for( x = strlen( pcBuffer ); x < ( size_t ) ( configMAX_TASK_NAME_LEN - 1 ); x++ )
-		{
-			pcBuffer[ x ] = ' ';
-		}
-
-		/* Terminate. */
-		pcBuffer[ x ] = ( char ) 0x00;
-
-		/* Return the new end of string. */
-		return &( pcBuffer[ x ] );
-	}
-
-#endif /* ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) */
-/*-----------------------------------------------------------*/
+	TCB_t * pxTCB;
+	uint8_t ucOriginalNotifyState;
+	BaseType_t xReturn = pdPASS;
+	UBaseType_t uxSavedInterruptStatus;
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+		configASSERT( xTaskToNotify );
 
-	void vTaskList( char * pcWriteBuffer )
-	{
-	TaskStatus_t *pxTaskStatusArray;
-	UBaseType_t uxArraySize, x;
-	char cStatus;
+		/* RTOS ports that support interrupt nesting have the concept of a
+		maximum	system call (or maximum API call) interrupt priority.
+		Interrupts that are	above the maximum system call priority are keep
+		permanently enabled, even when the RTOS kernel is in a critical section,
+		but cannot make any calls to FreeRTOS API functions.  If configASSERT()
+		is defined in FreeRTOSConfig.h then
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+		failure if a FreeRTOS API function is called from an interrupt that has
+		been assigned a priority above the configured maximum system call
+		priority.  Only FreeRTOS functions that end in FromISR can be called
+		from interrupts	that have been assigned a priority at or (logically)
+		below the maximum system call interrupt priority.  FreeRTOS maintains a
+		separate interrupt safe API to ensure interrupt entry is as fast and as
+		simple as possible.  More information (albeit Cortex-M specific) is
+		provided on the following link:
+		http://www.freertos.org/RTOS-Cortex-M3-M4.html */
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
 
-		/*
-		 * PLEASE NOTE:
-		 *
-		 * This function is provided for convenience only, and is used by many
-		 * of the demo applications.  Do not consider it to be part of the
-		 * scheduler.
-		 *
-		 * vTaskList() calls uxTaskGetSystemState(), then formats part of the
-		 * uxTaskGetSystemState() output into a human readable table that
-		 * displays task names, states and stack usage.
-		 *
-		 * vTaskList() has a dependency on the sprintf() C library function that
-		 * might bloat the code size, use a lot of stack, and provide different
-		 * results on different platforms.  An alternative, tiny, third party,
-		 * and limited functionality implementation of sprintf() is provided in
-		 * many of the FreeRTOS/Demo sub-directories in a file called
-		 * printf-stdarg.c (note printf-stdarg.c does not provide a full
-		 * snprintf() implementation!).
-		 *
-		 * It is recommended that production systems call uxTaskGetSystemState()
-		 * directly to get access to raw stats data, rather than indirectly
-		 * through a call to vTaskList().
-		 */
+		pxTCB = xTaskToNotify;
 
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			if( pulPreviousNotificationValue != NULL )
+			{
+				*pulPreviousNotificationValue = pxTCB->ulNotifiedValue[ uxIndexToNotify ];
+			}
 
-		/* Make sure the write buffer does not contain a string. */
-		*pcWriteBuffer = ( char ) 0x00;
+			ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
+			pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
 
-		/* Take a snapshot of the number of tasks in case it changes while this
-		function is executing. */
-		uxArraySize = uxCurrentNumberOfTasks;
+			switch( eAction )
+			{
+				case eSetBits	:
+					pxTCB->ulNotifiedValue[ uxIndexToNotify ] |= ulValue;
+					break;
 
-		/* Allocate an array index for each task.  NOTE!  if
-		configSUPPORT_DYNAMIC_ALLOCATION is set to 0 then pvPortMalloc() will
-		equate to NULL. */
-		pxTaskStatusArray = pvPortMalloc( uxCurrentNumberOfTasks * sizeof( TaskStatus_t ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack and this allocation allocates a struct that has the alignment requirements of a pointer. */
+				case eIncrement	:
+					( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
+					break;
 
-		if( pxTaskStatusArray != NULL )
-		{
-			/* Generate the (binary) data. */
-			uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, NULL );
+				case eSetValueWithOverwrite	:
+					pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
+					break;
 
-			/* Create a human readable table from the binary data. */
-			for( x = 0; x < uxArraySize; x++ )
-			{
-				switch( pxTaskStatusArray[ x ].eCurrentState )
-				{
-					case eRunning:		cStatus = tskRUNNING_CHAR;
-										break;
+				case eSetValueWithoutOverwrite :
+					if( ucOriginalNotifyState != taskNOTIFICATION_RECEIVED )
+					{
+						pxTCB->ulNotifiedValue[ uxIndexToNotify ] = ulValue;
+					}
+					else
+					{
+						/* The value could not be written to the task. */
+						xReturn = pdFAIL;
+					}
+					break;
 
-					case eReady:		cStatus = tskREADY_CHAR;
-										break;
+				case eNoAction :
+					/* The task is being notified without its notify value being
+					updated. */
+					break;
 
-					case eBlocked:		cStatus = tskBLOCKED_CHAR;
-										break;
+				default:
+					/* Should not get here if all enums are handled.
+					Artificially force an assert by testing a value the
+					compiler can't assume is const. */
+					configASSERT( pxTCB->ulNotifiedValue[ uxIndexToNotify ] == ~0UL );
+					break;
+			}
 
-					case eSuspended:	cStatus = tskSUSPENDED_CHAR;
-										break;
+			traceTASK_NOTIFY_FROM_ISR();
 
-					case eDeleted:		cStatus = tskDELETED_CHAR;
-										break;
+			/* If the task is in the blocked state specifically to wait for a
+			notification then unblock it now. */
+			if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
+			{
+				/* The task should not have been on an event list. */
+				configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
 
-					case eInvalid:		/* Fall through. */
-					default:			/* Should not get here, but it is included
-										to prevent static checking errors. */
-										cStatus = ( char ) 0x00;
-										break;
+				if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+				{
+					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+					prvAddTaskToReadyList( pxTCB );
+				}
+				else
+				{
+					/* The delayed and ready lists cannot be accessed, so hold
+					this task pending until the scheduler is resumed. */
+					vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
+					taskRECORD_WAKE_TIME( pxTCB );
 				}
 
-				/* Write the task name to the string, padding with spaces so it
-				can be printed in tabular form more easily. */
-				pcWriteBuffer = prvWriteNameToBuffer( pcWriteBuffer, pxTaskStatusArray[ x ].pcTaskName );
+				if( taskTASK_PREEMPTS_CURRENT( pxTCB ) )
+				{
+					/* The notified task has a priority above the currently
+					executing task so a yield is required. */
+					if( pxHigherPriorityTaskWoken != NULL )
+					{
+						*pxHigherPriorityTaskWoken = pdTRUE;
+					}
 
-				/* Write the rest of the string. */
-				sprintf( pcWriteBuffer, "\t%c\t%u\t%u\t%u\r\n", cStatus, ( unsigned int ) pxTaskStatusArray[ x ].uxCurrentPriority, ( unsigned int ) pxTaskStatusArray[ x ].usStackHighWaterMark, ( unsigned int ) pxTaskStatusArray[ x ].xTaskNumber ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
-				pcWriteBuffer += strlen( pcWriteBuffer ); /*lint !e9016 Pointer arithmetic ok on char pointers especially as in this case where it best denotes the intent of the code. */
+					/* Mark that a yield is pending in case the user is not
+					using the "xHigherPriorityTaskWoken" parameter to an ISR
+					safe FreeRTOS function. */
+					xYieldPending = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
-
-			/* Free the array again.  NOTE!  If configSUPPORT_DYNAMIC_ALLOCATION
-			is 0 then vPortFree() will be #defined to nothing. */
-			vPortFree( pxTaskStatusArray );
-		}
-		else
-		{
-			mtCOVERAGE_TEST_MARKER();
 		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return xReturn;
 	}
 
-#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
-/*----------------------------------------------------------*/
+#endif /* configUSE_TASK_NOTIFICATIONS */
+/*-----------------------------------------------------------*/
 
-#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+#if( configUSE_TASK_NOTIFICATIONS == 1 )
 
-	void vTaskGetRunTimeStats( char *pcWriteBuffer )
+	void vTaskGenericNotifyGiveFromISR( TaskHandle_t xTaskToNotify, UBaseType_t uxIndexToNotify, BaseType_t *pxHigherPriorityTaskWoken )
 	{
-	TaskStatus_t *pxTaskStatusArray;
-	UBaseType_t uxArraySize, x;
-	uint32_t ulTotalTime, ulStatsAsPercentage;
-
-		#if( configUSE_TRACE_FACILITY != 1 )
-		{
-			#error configUSE_TRACE_FACILITY must also be set to 1 in FreeRTOSConfig.h to use vTaskGetRunTimeStats().
-		}
-		#endif
-
-		/*
-		 * PLEASE NOTE:
-		 *
-		 * This function is provided for convenience only, and is used by many
-		 * of the demo applications.  Do not consider it to be part of the
-		 * scheduler.
-		 *
-		 * vTaskGetRunTimeStats() calls uxTaskGetSystemState(), then formats part
-		 * of the uxTaskGetSystemState() output into a human readable table that
-		 * displays the amount of time each task has spent in the Running state
-		 * in both absolute and percentage terms.
-		 *
-		 * vTaskGetRunTimeStats() has a dependency on the sprintf() C library
-		 * function that might bloat the code size, use a lot of stack, and
-		 * provide different results on different platforms.  An alternative,
-		 * tiny, third party, and limited functionality implementation of
-		 * sprintf() is provided in many of the FreeRTOS/Demo sub-directories in
-		 * a file called printf-stdarg.c (note printf-stdarg.c does not provide
-		 * a full snprintf() implementation!).
-		 *
-		 * It is recommended that production systems call uxTaskGetSystemState()
-		 * directly to get access to raw stats data, rather than indirectly
-		 * through a call to vTaskGetRunTimeStats().
-		 */
+	TCB_t * pxTCB;
+	uint8_t ucOriginalNotifyState;
+	UBaseType_t uxSavedInterruptStatus;
 
-		/* Make sure the write buffer does not contain a string. */
-		*pcWriteBuffer = ( char ) 0x00;
+		configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+		configASSERT( xTaskToNotify );
 
-		/* Take a snapshot of the number of tasks in case it changes while this
-		function is executing. */
-		uxArraySize = uxCurrentNumberOfTasks;
+		/* RTOS ports that support interrupt nesting have the concept of a
+		maximum	system call (or maximum API call) interrupt priority.
+		Interrupts that are	above the maximum system call priority are keep
+		permanently enabled, even when the RTOS kernel is in a critical section,
+		but cannot make any calls to FreeRTOS API functions.  If configASSERT()
+		is defined in FreeRTOSConfig.h then
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+		failure if a FreeRTOS API function is called from an interrupt that has
+		been assigned a priority above the configured maximum system call
+		priority.  Only FreeRTOS functions that end in FromISR can be called
+		from interrupts	that have been assigned a priority at or (logically)
+		below the maximum system call interrupt priority.  FreeRTOS maintains a
+		separate interrupt safe API to ensure interrupt entry is as fast and as
+		simple as possible.  More information (albeit Cortex-M specific) is
+		provided on the following link:
+		http://www.freertos.org/RTOS-Cortex-M3-M4.html */
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
 
-		/* Allocate an array index for each task.  NOTE!  If
-		configSUPPORT_DYNAMIC_ALLOCATION is set to 0 then pvPortMalloc() will
-		equate to NULL. */
-		pxTaskStatusArray = pvPortMalloc( uxCurrentNumberOfTasks * sizeof( TaskStatus_t ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack and this allocation allocates a struct that has the alignment requirements of a pointer. */
+		pxTCB = xTaskToNotify;
 
-		if( pxTaskStatusArray != NULL )
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
 		{
-			/* Generate the (binary) data. */
-			uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, &ulTotalTime );
+			ucOriginalNotifyState = pxTCB->ucNotifyState[ uxIndexToNotify ];
+			pxTCB->ucNotifyState[ uxIndexToNotify ] = taskNOTIFICATION_RECEIVED;
 
-			/* For percentage calculations. */
-			ulTotalTime /= 100UL;
+			/* 'Giving' is equivalent to incrementing a count in a counting
+			semaphore. */
+			( pxTCB->ulNotifiedValue[ uxIndexToNotify ] )++;
 
-			/* Avoid divide by zero errors. */
-			if( ulTotalTime > 0UL )
+			traceTASK_NOTIFY_GIVE_FROM_ISR();
+
+			/* If the task is in the blocked state specifically to wait for a
+			notification then unblock it now. */
+			if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
 			{
-				/* Create a human readable table from the binary data. */
-				for( x = 0; x < uxArraySize; x++ )
-				{
-					/* What percentage of the total run time has the task used?
-					This will always be rounded down to the nearest integer.
-					ulTotalRunTimeDiv100 has already been divided by 100. */
-					ulStatsAsPercentage = pxTaskStatusArray[ x ].ulRunTimeCounter / ulTotalTime;
+				/* The task should not have been on an event list. */
+				configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
 
-					/* Write the task name to the string, padding with
-					spaces so it can be printed in tabular form more
-					easily. */
-					pcWriteBuffer = prvWriteNameToBuffer( pcWriteBuffer, pxTaskStatusArray[ x ].pcTaskName );
+				if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+				{
+					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+					prvAddTaskToReadyList( pxTCB );
+				}
+				else
+				{
+					/* The delayed and ready lists cannot be accessed, so hold
+					this task pending until the scheduler is resumed. */
+					vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
+					taskRECORD_WAKE_TIME( pxTCB );
+				}
 
-					if( ulStatsAsPercentage > 0UL )
-					{
-						#ifdef portLU_PRINTF_SPECIFIER_REQUIRED
-						{
-							sprintf( pcWriteBuffer, "\t%lu\t\t%lu%%\r\n", pxTaskStatusArray[ x ].ulRunTimeCounter, ulStatsAsPercentage );
-						}
-						#else
-						{
-							/* sizeof( int ) == sizeof( long ) so a smaller
-							printf() library can be used. */
-							sprintf( pcWriteBuffer, "\t%u\t\t%u%%\r\n", ( unsigned int ) pxTaskStatusArray[ x ].ulRunTimeCounter, ( unsigned int ) ulStatsAsPercentage ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
-						}
-						#endif
-					}
-					else
+				if( taskTASK_PREEMPTS_CURRENT( pxTCB ) )
+				{
+					/* The notified task has a priority above the currently
+					executing task so a yield is required. */
+					if( pxHigherPriorityTaskWoken != NULL )
 					{
-						/* If the percentage is zero here then the task has
-						consumed less than 1% of the total run time. */
-						#ifdef portLU_PRINTF_SPECIFIER_REQUIRED
-						{
-							sprintf( pcWriteBuffer, "\t%lu\t\t<1%%\r\n", pxTaskStatusArray[ x ].ulRunTimeCounter );
-						}
-						#else
-						{
-							/* sizeof( int ) == sizeof( long ) so a smaller
-							printf() library can be used. */
-							sprintf( pcWriteBuffer, "\t%u\t\t<1%%\r\n", ( unsigned int ) pxTaskStatusArray[ x ].ulRunTimeCounter ); /*lint !e586 sprintf() allowed as this is compiled with many compilers and this is a utility function only - not part of the core kernel implementation. */
-						}
-						#endif
+						*pxHigherPriorityTaskWoken = pdTRUE;
 					}
 
-					pcWriteBuffer += strlen( pcWriteBuffer ); /*lint !e9016 Pointer arithmetic ok on char pointers especially as in this case where it best denotes the intent of the code. */
+					/* Mark that a yield is pending in case the user is not
+					using the "xHigherPriorityTaskWoken" parameter in an ISR
+					safe FreeRTOS function. */
+					xYieldPending = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
 				}
 			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
-
-			/* Free the array again.  NOTE!  If configSUPPORT_DYNAMIC_ALLOCATION
-			is 0 then vPortFree() will be #defined to nothing. */
-			vPortFree( pxTaskStatusArray );
 		}
-		else
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
+
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TASK_NOTIFICATIONS == 1 )
+
+	BaseType_t xTaskGenericNotifyStateClear( TaskHandle_t xTask, UBaseType_t uxIndexToClear )
+	{
+	TCB_t *pxTCB;
+	BaseType_t xReturn;
+
+		configASSERT( uxIndexToClear < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+
+		/* If null is passed in here then it is the calling task that is having
+		its notification state cleared. */
+		pxTCB = prvGetTCBFromHandle( xTask );
+
+		taskENTER_CRITICAL();
 		{
-			mtCOVERAGE_TEST_MARKER();
+			if( pxTCB->ucNotifyState[ uxIndexToClear ] == taskNOTIFICATION_RECEIVED )
+			{
+				pxTCB->ucNotifyState[ uxIndexToClear ] = taskNOT_WAITING_NOTIFICATION;
+				xReturn = pdPASS;
+			}
+			else
+			{
+				xReturn = pdFAIL;
+			}
 		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
 	}
 
-#endif /* ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) ) */
+#endif /* configUSE_TASK_NOTIFICATIONS */
 /*-----------------------------------------------------------*/
 
-TickType_t uxTaskResetEventItemValue( void )
-{
-TickType_t uxReturn;
-
-	uxReturn = listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ) );
-
-	/* Reset the event list item to its normal value - so it can be used with
-	queues and semaphores. */
-	listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+#if( configUSE_TASK_RENDEZVOUS == 1 )
 
-	return uxReturn;
-}
-/*-----------------------------------------------------------*/
+	static void prvRendezvousTransfer( TCB_t * const pxCaller, TCB_t * const pxReceiver )
+	{
+	size_t xLength = pxCaller->xRendezvousLength;
 
-#if ( configUSE_MUTEXES == 1 )
+		if( xLength > pxReceiver->xRendezvousBufferSize )
+		{
+			xLength = pxReceiver->xRendezvousBufferSize;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 
-	TaskHandle_t pvTaskIncrementMutexHeldCount( void )
-	{
-		/* If xSemaphoreCreateMutex() is called before any tasks have been created
-		then pxCurrentTCB will be NULL. */
-		if( pxCurrentTCB != NULL )
+		if( xLength > ( size_t ) 0 )
 		{
-			( pxCurrentTCB->uxMutexesHeld )++;
+			( void ) memcpy( pxReceiver->pvRendezvousBuffer, pxCaller->pvRendezvousMessage, xLength ); /*lint !e9087 !e9079 The buffers are byte arrays as far as this function is concerned. */
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
 		}
 
-		return pxCurrentTCB;
-	}
+		traceTASK_RENDEZVOUS_RECEIVE( pxCaller );
 
-#endif /* configUSE_MUTEXES */
-/*-----------------------------------------------------------*/
+		pxReceiver->xRendezvousLength = xLength;
+		pxReceiver->pxRendezvousPartner = pxCaller;
+		pxReceiver->ucRendezvousState = taskRENDEZVOUS_CALL_RECEIVED;
 
-#if( configUSE_TASK_NOTIFICATIONS == 1 )
+		/* The caller stays blocked, with the time out it started with, until
+		the reply arrives.  Its event list item, which is not otherwise in use,
+		is held in the receiver's list of calls to reply to, so the call can be
+		failed if the receiver is deleted first, and so the caller is taken out
+		of the list if it times out first. */
+		pxCaller->ucRendezvousState = taskRENDEZVOUS_WAITING_FOR_REPLY;
+		vListInsertEnd( &( pxReceiver->xRendezvousServed ), &( pxCaller->xEventListItem ) );
+	}
+	/*-----------------------------------------------------------*/
 
-	uint32_t ulTaskNotifyTake( BaseType_t xClearCountOnExit, TickType_t xTicksToWait )
+	static BaseType_t prvRendezvousReleaseCallers( List_t * const pxList )
 	{
-	uint32_t ulReturn;
+	TCB_t *pxCaller;
+	BaseType_t xReturn = pdFALSE;
 
-		taskENTER_CRITICAL();
+		while( listLIST_IS_EMPTY( pxList ) == pdFALSE )
 		{
-			/* Only block if the notification count is not already non-zero. */
-			if( pxCurrentTCB->ulNotifiedValue == 0UL )
-			{
-				/* Mark this task as waiting for a notification. */
-				pxCurrentTCB->ucNotifyState = taskWAITING_NOTIFICATION;
-
-				if( xTicksToWait > ( TickType_t ) 0 )
-				{
-					prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
-					traceTASK_NOTIFY_TAKE_BLOCK();
+			pxCaller = listGET_OWNER_OF_HEAD_ENTRY( pxList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+			( void ) uxListRemove( &( pxCaller->xEventListItem ) );
+			( void ) uxListRemove( &( pxCaller->xStateListItem ) );
+			pxCaller->pxRendezvousPartner = NULL;
+			prvAddTaskToReadyList( pxCaller );
 
-					/* All ports are written to allow a yield in a critical
-					section (some will yield immediately, others wait until the
-					critical section exits) - but it is not something that
-					application code should ever do. */
-					portYIELD_WITHIN_API();
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
+			if( taskTASK_PREEMPTS_CURRENT( pxCaller ) )
+			{
+				xReturn = pdTRUE;
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
 		}
-		taskEXIT_CRITICAL();
 
-		taskENTER_CRITICAL();
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	static UBaseType_t prvRendezvousGetInheritedPriority( const TCB_t * const pxTCB, UBaseType_t uxPriority )
+	{
+	const List_t *pxList;
+	const ListItem_t *pxItem;
+	const TCB_t *pxCaller;
+	BaseType_t x;
+
+		/* The callers are not kept in priority order, as their priorities can
+		change while they wait, so every one is looked at.  There are rarely
+		more than a few. */
+		for( x = 0; x < 2; x++ )
 		{
-			traceTASK_NOTIFY_TAKE();
-			ulReturn = pxCurrentTCB->ulNotifiedValue;
+			if( x == 0 )
+			{
+				pxList = &( pxTCB->xRendezvousCallers );
+			}
+			else
+			{
+				pxList = &( pxTCB->xRendezvousServed );
+			}
 
-			if( ulReturn != 0UL )
+			for( pxItem = listGET_HEAD_ENTRY( pxList ); pxItem != listGET_END_MARKER( pxList ); pxItem = listGET_NEXT( pxItem ) )
 			{
-				if( xClearCountOnExit != pdFALSE )
+				pxCaller = listGET_LIST_ITEM_OWNER( pxItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+				if( pxCaller->uxPriority > uxPriority )
 				{
-					pxCurrentTCB->ulNotifiedValue = 0UL;
+					uxPriority = pxCaller->uxPriority;
 				}
 				else
 				{
-					pxCurrentTCB->ulNotifiedValue = ulReturn - ( uint32_t ) 1;
+					mtCOVERAGE_TEST_MARKER();
 				}
 			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
-
-			pxCurrentTCB->ucNotifyState = taskNOT_WAITING_NOTIFICATION;
 		}
-		taskEXIT_CRITICAL();
 
-		return ulReturn;
+		return uxPriority;
 	}
+	/*-----------------------------------------------------------*/
 
-#endif /* configUSE_TASK_NOTIFICATIONS */
-/*-----------------------------------------------------------*/
+	static BaseType_t prvRendezvousUpdatePriority( TCB_t * const pxReceiver )
+	{
+	UBaseType_t uxPriorityToUse, uxPriorityUsedOnEntry;
+	BaseType_t xReturn = pdFALSE;
 
-#if( configUSE_TASK_NOTIFICATIONS == 1 )
+		uxPriorityToUse = prvRendezvousGetInheritedPriority( pxReceiver, pxReceiver->uxBasePriority );
 
-	BaseType_t xTaskNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait )
-	{
-	BaseType_t xReturn;
+		/* As vTaskPriorityDisinheritAfterTimeout(), a priority inherited
+		through a mutex is only dropped by xTaskPriorityDisinherit() once the
+		last mutex has been given back, so while a mutex is held the priority
+		is only raised here. */
+		if( ( pxReceiver->uxMutexesHeld != ( tskTCB_NESTING_TYPE ) 0U ) && ( pxReceiver->uxPriority > uxPriorityToUse ) )
+		{
+			uxPriorityToUse = pxReceiver->uxPriority;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 
-		taskENTER_CRITICAL();
+		if( pxReceiver->uxPriority != uxPriorityToUse )
 		{
-			/* Only block if a notification is not already pending. */
-			if( pxCurrentTCB->ucNotifyState != taskNOTIFICATION_RECEIVED )
+			if( uxPriorityToUse > pxReceiver->uxPriority )
 			{
-				/* Clear bits in the task's notification value as bits may get
-				set	by the notifying task or interrupt.  This can be used to
-				clear the value to zero. */
-				pxCurrentTCB->ulNotifiedValue &= ~ulBitsToClearOnEntry;
+				traceTASK_PRIORITY_INHERIT( pxReceiver, uxPriorityToUse );
+			}
+			else
+			{
+				traceTASK_PRIORITY_DISINHERIT( pxReceiver, uxPriorityToUse );
+			}
 
-				/* Mark this task as waiting for a notification. */
-				pxCurrentTCB->ucNotifyState = taskWAITING_NOTIFICATION;
+			uxPriorityUsedOnEntry = pxReceiver->uxPriority;
+			pxReceiver->uxPriority = uxPriorityToUse;
+			taskRECORD_STATE_CHANGE( pxReceiver );
 
-				if( xTicksToWait > ( TickType_t ) 0 )
-				{
-					prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
-					traceTASK_NOTIFY_WAIT_BLOCK();
+			/* Only reset the event list item value if the value is not being
+			used for anything else. */
+			if( ( listGET_LIST_ITEM_VALUE( &( pxReceiver->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+			{
+				listSET_LIST_ITEM_VALUE( &( pxReceiver->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxPriorityToUse ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 
-					/* All ports are written to allow a yield in a critical
-					section (some will yield immediately, others wait until the
-					critical section exits) - but it is not something that
-					application code should ever do. */
-					portYIELD_WITHIN_API();
+			/* The receiver could be in any state, but only the Ready state
+			has one list per priority. */
+			if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxReceiver->xStateListItem ) ) != pdFALSE )
+			{
+				if( uxListRemove( &( pxReceiver->xStateListItem ) ) == ( UBaseType_t ) 0 )
+				{
+					portRESET_READY_PRIORITY( uxPriorityUsedOnEntry, uxTopReadyPriority );
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
+
+				prvMoveTaskBetweenReadyLists( pxReceiver );
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
-		}
-		taskEXIT_CRITICAL();
 
-		taskENTER_CRITICAL();
+			xReturn = pdTRUE;
+		}
+		else
 		{
-			traceTASK_NOTIFY_WAIT();
+			mtCOVERAGE_TEST_MARKER();
+		}
 
-			if( pulNotificationValue != NULL )
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvRendezvousAbandonCall( TCB_t * const pxCaller )
+	{
+	TCB_t * const pxReceiver = pxCaller->pxRendezvousPartner;
+	BaseType_t xReturn = pdFALSE;
+
+		/* Only a caller has a partner while it is waiting. */
+		if( ( pxReceiver != NULL ) &&
+			( ( pxCaller->ucRendezvousState == taskRENDEZVOUS_WAITING_TO_SEND ) ||
+			  ( pxCaller->ucRendezvousState == taskRENDEZVOUS_WAITING_FOR_REPLY ) ) )
+		{
+			if( listLIST_ITEM_CONTAINER( &( pxCaller->xEventListItem ) ) != NULL )
 			{
-				/* Output the current notification value, which may or may not
-				have changed. */
-				*pulNotificationValue = pxCurrentTCB->ulNotifiedValue;
+				( void ) uxListRemove( &( pxCaller->xEventListItem ) );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
 			}
 
-			/* If ucNotifyValue is set then either the task never entered the
-			blocked state (because a notification was already pending) or the
-			task unblocked because of a notification.  Otherwise the task
-			unblocked because of a timeout. */
-			if( pxCurrentTCB->ucNotifyState != taskNOTIFICATION_RECEIVED )
+			pxCaller->pxRendezvousPartner = NULL;
+
+			if( ( prvRendezvousUpdatePriority( pxReceiver ) != pdFALSE ) && ( pxReceiver == pxCurrentTCB ) )
 			{
-				/* A notification was not received. */
-				xReturn = pdFALSE;
+				xReturn = pdTRUE;
 			}
 			else
 			{
-				/* A notification was already pending or a notification was
-				received while the task was waiting. */
-				pxCurrentTCB->ulNotifiedValue &= ~ulBitsToClearOnExit;
-				xReturn = pdTRUE;
+				mtCOVERAGE_TEST_MARKER();
 			}
-
-			pxCurrentTCB->ucNotifyState = taskNOT_WAITING_NOTIFICATION;
 		}
-		taskEXIT_CRITICAL();
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 
 		return xReturn;
 	}
+	/*-----------------------------------------------------------*/
 
-#endif /* configUSE_TASK_NOTIFICATIONS */
-/*-----------------------------------------------------------*/
-
-#if( configUSE_TASK_NOTIFICATIONS == 1 )
-
-	BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue )
+	BaseType_t xTaskRendezvousCall( TaskHandle_t xReceiver, const void *pvRequest, size_t xRequestLength, void *pvReplyBuffer, size_t xReplyBufferSize, size_t *pxReplyLength, TickType_t xTicksToWait )
 	{
-	TCB_t * pxTCB;
-	BaseType_t xReturn = pdPASS;
-	uint8_t ucOriginalNotifyState;
+	TCB_t * const pxReceiver = xReceiver;
+	BaseType_t xReturn;
 
-		configASSERT( xTaskToNotify );
-		pxTCB = xTaskToNotify;
+		configASSERT( pxReceiver );
+		configASSERT( pxReceiver != pxCurrentTCB );
+		configASSERT( xTicksToWait > ( TickType_t ) 0 );
+		#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+		{
+			configASSERT( xTaskGetSchedulerState() != taskSCHEDULER_SUSPENDED );
+		}
+		#endif
 
 		taskENTER_CRITICAL();
 		{
-			if( pulPreviousNotificationValue != NULL )
-			{
-				*pulPreviousNotificationValue = pxTCB->ulNotifiedValue;
-			}
-
-			ucOriginalNotifyState = pxTCB->ucNotifyState;
-
-			pxTCB->ucNotifyState = taskNOTIFICATION_RECEIVED;
-
-			switch( eAction )
-			{
-				case eSetBits	:
-					pxTCB->ulNotifiedValue |= ulValue;
-					break;
-
-				case eIncrement	:
-					( pxTCB->ulNotifiedValue )++;
-					break;
-
-				case eSetValueWithOverwrite	:
-					pxTCB->ulNotifiedValue = ulValue;
-					break;
-
-				case eSetValueWithoutOverwrite :
-					if( ucOriginalNotifyState != taskNOTIFICATION_RECEIVED )
-					{
-						pxTCB->ulNotifiedValue = ulValue;
-					}
-					else
-					{
-						/* The value could not be written to the task. */
-						xReturn = pdFAIL;
-					}
-					break;
-
-				case eNoAction:
-					/* The task is being notified without its notify value being
-					updated. */
-					break;
-
-				default:
-					/* Should not get here if all enums are handled.
-					Artificially force an assert by testing a value the
-					compiler can't assume is const. */
-					configASSERT( pxTCB->ulNotifiedValue == ~0UL );
+			traceTASK_RENDEZVOUS_CALL( pxReceiver );
 
-					break;
-			}
-
-			traceTASK_NOTIFY();
+			pxCurrentTCB->pvRendezvousMessage = pvRequest;
+			pxCurrentTCB->xRendezvousLength = xRequestLength;
+			pxCurrentTCB->pvRendezvousBuffer = pvReplyBuffer;
+			pxCurrentTCB->xRendezvousBufferSize = xReplyBufferSize;
 
-			/* If the task is in the blocked state specifically to wait for a
-			notification then unblock it now. */
-			if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
+			if( pxReceiver->ucRendezvousState == taskRENDEZVOUS_WAITING_FOR_CALL )
 			{
-				( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-				prvAddTaskToReadyList( pxTCB );
-
-				/* The task should not have been on an event list. */
-				configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+				/* The receiver is waiting, so copy the request straight into
+				its buffer and unblock it.  It may also have timed out but not
+				yet run, in which case it is already in a ready list. */
+				prvRendezvousTransfer( pxCurrentTCB, pxReceiver );
 
-				#if( configUSE_TICKLESS_IDLE != 0 )
+				if( uxListRemove( &( pxReceiver->xStateListItem ) ) == ( UBaseType_t ) 0 )
 				{
-					/* If a task is blocked waiting for a notification then
-					xNextTaskUnblockTime might be set to the blocked task's time
-					out time.  If the task is unblocked for a reason other than
-					a timeout xNextTaskUnblockTime is normally left unchanged,
-					because it will automatically get reset to a new value when
-					the tick count equals xNextTaskUnblockTime.  However if
-					tickless idling is used it might be more important to enter
-					sleep mode at the earliest possible time - so reset
-					xNextTaskUnblockTime here to ensure it is updated at the
-					earliest possible time. */
+					taskRESET_READY_PRIORITY( pxReceiver->uxPriority );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* The receiver works on behalf of the caller until it
+				replies. */
+				( void ) prvRendezvousUpdatePriority( pxReceiver );
+				prvAddTaskToReadyList( pxReceiver );
+
+				#if( configUSE_TICKLESS_IDLE != 0 )
+				{
+					/* As xTaskGenericNotify(), the receiver may have set
+					xNextTaskUnblockTime. */
 					prvResetNextTaskUnblockTime();
 				}
 				#endif
 
-				if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+				/* The caller is about to block, so give the processor
+				straight to the receiver. */
+				pxRendezvousHandoffTCB = pxReceiver;
+			}
+			else
+			{
+				/* Wait for the receiver, which will copy the request straight
+				out of pvRequest. */
+				pxCurrentTCB->ucRendezvousState = taskRENDEZVOUS_WAITING_TO_SEND;
+				vListInsert( &( pxReceiver->xRendezvousCallers ), &( pxCurrentTCB->xEventListItem ) );
+
+				/* A receiver that is busy elsewhere runs at the priority of
+				the callers waiting for it, so it cannot keep them waiting
+				behind tasks of a lower priority. */
+				( void ) prvRendezvousUpdatePriority( pxReceiver );
+			}
+
+			pxCurrentTCB->pxRendezvousPartner = pxReceiver;
+			prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+
+			/* All ports are written to allow a yield in a critical section
+			(some will yield immediately, others wait until the critical
+			section exits) - but it is not something that application code
+			should ever do. */
+			portYIELD_WITHIN_API();
+		}
+		taskEXIT_CRITICAL();
+
+		taskENTER_CRITICAL();
+		{
+			if( pxCurrentTCB->ucRendezvousState == taskRENDEZVOUS_REPLY_RECEIVED )
+			{
+				if( pxReplyLength != NULL )
 				{
-					/* The notified task has a priority above the currently
-					executing task so a yield is required. */
-					taskYIELD_IF_USING_PREEMPTION();
+					*pxReplyLength = pxCurrentTCB->xRendezvousLength;
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
+
+				xReturn = pdPASS;
 			}
 			else
 			{
-				mtCOVERAGE_TEST_MARKER();
+				/* The call timed out, was aborted by xTaskAbortDelay(), or
+				its receiver was deleted.  Each of those takes the event list
+				item out of the receiver's list, whether the call had been
+				received or not, so a late reply cannot find the task, and
+				each stops the receiver inheriting the task's priority. */
+				configASSERT( listLIST_ITEM_CONTAINER( &( pxCurrentTCB->xEventListItem ) ) == NULL );
+				xReturn = pdFAIL;
 			}
+
+			pxCurrentTCB->pxRendezvousPartner = NULL;
+			pxCurrentTCB->ucRendezvousState = taskRENDEZVOUS_IDLE;
 		}
 		taskEXIT_CRITICAL();
 
 		return xReturn;
 	}
+	/*-----------------------------------------------------------*/
 
-#endif /* configUSE_TASK_NOTIFICATIONS */
-/*-----------------------------------------------------------*/
-
-#if( configUSE_TASK_NOTIFICATIONS == 1 )
-
-	BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue, BaseType_t *pxHigherPriorityTaskWoken )
+	BaseType_t xTaskRendezvousReceive( void *pvBuffer, size_t xBufferSize, size_t *pxReceivedLength, TaskHandle_t *pxCaller, TickType_t xTicksToWait )
 	{
-	TCB_t * pxTCB;
-	uint8_t ucOriginalNotifyState;
-	BaseType_t xReturn = pdPASS;
-	UBaseType_t uxSavedInterruptStatus;
-
-		configASSERT( xTaskToNotify );
-
-		/* RTOS ports that support interrupt nesting have the concept of a
-		maximum	system call (or maximum API call) interrupt priority.
-		Interrupts that are	above the maximum system call priority are keep
-		permanently enabled, even when the RTOS kernel is in a critical section,
-		but cannot make any calls to FreeRTOS API functions.  If configASSERT()
-		is defined in FreeRTOSConfig.h then
-		portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-		failure if a FreeRTOS API function is called from an interrupt that has
-		been assigned a priority above the configured maximum system call
-		priority.  Only FreeRTOS functions that end in FromISR can be called
-		from interrupts	that have been assigned a priority at or (logically)
-		below the maximum system call interrupt priority.  FreeRTOS maintains a
-		separate interrupt safe API to ensure interrupt entry is as fast and as
-		simple as possible.  More information (albeit Cortex-M specific) is
-		provided on the following link:
-		http://www.freertos.org/RTOS-Cortex-M3-M4.html */
-		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+	TCB_t *pxCallerTCB;
+	BaseType_t xReturn;
 
-		pxTCB = xTaskToNotify;
+		configASSERT( pxCaller );
 
-		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		taskENTER_CRITICAL();
 		{
-			if( pulPreviousNotificationValue != NULL )
+			pxCurrentTCB->pvRendezvousBuffer = pvBuffer;
+			pxCurrentTCB->xRendezvousBufferSize = xBufferSize;
+
+			if( listLIST_IS_EMPTY( &( pxCurrentTCB->xRendezvousCallers ) ) == pdFALSE )
 			{
-				*pulPreviousNotificationValue = pxTCB->ulNotifiedValue;
+				/* Take the call of the highest priority caller. */
+				pxCallerTCB = listGET_OWNER_OF_HEAD_ENTRY( &( pxCurrentTCB->xRendezvousCallers ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+				( void ) uxListRemove( &( pxCallerTCB->xEventListItem ) );
+				prvRendezvousTransfer( pxCallerTCB, pxCurrentTCB );
+
+				/* The priority of the caller is normally inherited already,
+				from when it started to wait. */
+				( void ) prvRendezvousUpdatePriority( pxCurrentTCB );
 			}
-
-			ucOriginalNotifyState = pxTCB->ucNotifyState;
-			pxTCB->ucNotifyState = taskNOTIFICATION_RECEIVED;
-
-			switch( eAction )
+			else if( xTicksToWait > ( TickType_t ) 0 )
 			{
-				case eSetBits	:
-					pxTCB->ulNotifiedValue |= ulValue;
-					break;
-
-				case eIncrement	:
-					( pxTCB->ulNotifiedValue )++;
-					break;
-
-				case eSetValueWithOverwrite	:
-					pxTCB->ulNotifiedValue = ulValue;
-					break;
-
-				case eSetValueWithoutOverwrite :
-					if( ucOriginalNotifyState != taskNOTIFICATION_RECEIVED )
-					{
-						pxTCB->ulNotifiedValue = ulValue;
-					}
-					else
-					{
-						/* The value could not be written to the task. */
-						xReturn = pdFAIL;
-					}
-					break;
-
-				case eNoAction :
-					/* The task is being notified without its notify value being
-					updated. */
-					break;
-
-				default:
-					/* Should not get here if all enums are handled.
-					Artificially force an assert by testing a value the
-					compiler can't assume is const. */
-					configASSERT( pxTCB->ulNotifiedValue == ~0UL );
-					break;
+				pxCurrentTCB->ucRendezvousState = taskRENDEZVOUS_WAITING_FOR_CALL;
+				prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+				portYIELD_WITHIN_API();
 			}
-
-			traceTASK_NOTIFY_FROM_ISR();
-
-			/* If the task is in the blocked state specifically to wait for a
-			notification then unblock it now. */
-			if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
+			else
 			{
-				/* The task should not have been on an event list. */
-				configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
-
-				if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
-				{
-					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-					prvAddTaskToReadyList( pxTCB );
-				}
-				else
-				{
-					/* The delayed and ready lists cannot be accessed, so hold
-					this task pending until the scheduler is resumed. */
-					vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
-				}
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
 
-				if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+		taskENTER_CRITICAL();
+		{
+			if( pxCurrentTCB->ucRendezvousState == taskRENDEZVOUS_CALL_RECEIVED )
+			{
+				if( pxReceivedLength != NULL )
 				{
-					/* The notified task has a priority above the currently
-					executing task so a yield is required. */
-					if( pxHigherPriorityTaskWoken != NULL )
-					{
-						*pxHigherPriorityTaskWoken = pdTRUE;
-					}
-
-					/* Mark that a yield is pending in case the user is not
-					using the "xHigherPriorityTaskWoken" parameter to an ISR
-					safe FreeRTOS function. */
-					xYieldPending = pdTRUE;
+					*pxReceivedLength = pxCurrentTCB->xRendezvousLength;
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
+
+				*pxCaller = pxCurrentTCB->pxRendezvousPartner;
+				xReturn = pdPASS;
 			}
+			else
+			{
+				*pxCaller = NULL;
+				xReturn = pdFAIL;
+			}
+
+			pxCurrentTCB->pxRendezvousPartner = NULL;
+			pxCurrentTCB->ucRendezvousState = taskRENDEZVOUS_IDLE;
 		}
-		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+		taskEXIT_CRITICAL();
 
 		return xReturn;
 	}
+	/*-----------------------------------------------------------*/
 
-#endif /* configUSE_TASK_NOTIFICATIONS */
-/*-----------------------------------------------------------*/
-
-#if( configUSE_TASK_NOTIFICATIONS == 1 )
-
-	void vTaskNotifyGiveFromISR( TaskHandle_t xTaskToNotify, BaseType_t *pxHigherPriorityTaskWoken )
+	BaseType_t xTaskRendezvousReply( TaskHandle_t xCaller, const void *pvReply, size_t xReplyLength )
 	{
-	TCB_t * pxTCB;
-	uint8_t ucOriginalNotifyState;
-	UBaseType_t uxSavedInterruptStatus;
-
-		configASSERT( xTaskToNotify );
-
-		/* RTOS ports that support interrupt nesting have the concept of a
-		maximum	system call (or maximum API call) interrupt priority.
-		Interrupts that are	above the maximum system call priority are keep
-		permanently enabled, even when the RTOS kernel is in a critical section,
-		but cannot make any calls to FreeRTOS API functions.  If configASSERT()
-		is defined in FreeRTOSConfig.h then
-		portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-		failure if a FreeRTOS API function is called from an interrupt that has
-		been assigned a priority above the configured maximum system call
-		priority.  Only FreeRTOS functions that end in FromISR can be called
-		from interrupts	that have been assigned a priority at or (logically)
-		below the maximum system call interrupt priority.  FreeRTOS maintains a
-		separate interrupt safe API to ensure interrupt entry is as fast and as
-		simple as possible.  More information (albeit Cortex-M specific) is
-		provided on the following link:
-		http://www.freertos.org/RTOS-Cortex-M3-M4.html */
-		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+	TCB_t * const pxCaller = xCaller;
+	BaseType_t xReturn;
+	BaseType_t xYieldRequired = pdFALSE;
 
-		pxTCB = xTaskToNotify;
+		configASSERT( pxCaller );
 
-		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		taskENTER_CRITICAL();
 		{
-			ucOriginalNotifyState = pxTCB->ucNotifyState;
-			pxTCB->ucNotifyState = taskNOTIFICATION_RECEIVED;
-
-			/* 'Giving' is equivalent to incrementing a count in a counting
-			semaphore. */
-			( pxTCB->ulNotifiedValue )++;
-
-			traceTASK_NOTIFY_GIVE_FROM_ISR();
-
-			/* If the task is in the blocked state specifically to wait for a
-			notification then unblock it now. */
-			if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
+			if( listIS_CONTAINED_WITHIN( &( pxCurrentTCB->xRendezvousServed ), &( pxCaller->xEventListItem ) ) != pdFALSE )
 			{
-				/* The task should not have been on an event list. */
-				configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+				traceTASK_RENDEZVOUS_REPLY( pxCaller );
+				( void ) uxListRemove( &( pxCaller->xEventListItem ) );
 
-				if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+				if( xReplyLength > pxCaller->xRendezvousBufferSize )
 				{
-					( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-					prvAddTaskToReadyList( pxTCB );
+					xReplyLength = pxCaller->xRendezvousBufferSize;
 				}
 				else
 				{
-					/* The delayed and ready lists cannot be accessed, so hold
-					this task pending until the scheduler is resumed. */
-					vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
+					mtCOVERAGE_TEST_MARKER();
 				}
 
-				if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+				if( xReplyLength > ( size_t ) 0 )
 				{
-					/* The notified task has a priority above the currently
-					executing task so a yield is required. */
-					if( pxHigherPriorityTaskWoken != NULL )
-					{
-						*pxHigherPriorityTaskWoken = pdTRUE;
-					}
+					( void ) memcpy( pxCaller->pvRendezvousBuffer, pvReply, xReplyLength ); /*lint !e9087 !e9079 The buffers are byte arrays as far as this function is concerned. */
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 
-					/* Mark that a yield is pending in case the user is not
-					using the "xHigherPriorityTaskWoken" parameter in an ISR
-					safe FreeRTOS function. */
-					xYieldPending = pdTRUE;
+				pxCaller->xRendezvousLength = xReplyLength;
+				pxCaller->ucRendezvousState = taskRENDEZVOUS_REPLY_RECEIVED;
+				pxCaller->pxRendezvousPartner = NULL;
+
+				/* The caller may also have timed out but not yet run, in
+				which case it is already in a ready list. */
+				if( uxListRemove( &( pxCaller->xStateListItem ) ) == ( UBaseType_t ) 0 )
+				{
+					taskRESET_READY_PRIORITY( pxCaller->uxPriority );
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
-			}
-		}
-		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
-	}
 
-#endif /* configUSE_TASK_NOTIFICATIONS */
+				prvAddTaskToReadyList( pxCaller );
 
-/*-----------------------------------------------------------*/
+				#if( configUSE_TICKLESS_IDLE != 0 )
+				{
+					prvResetNextTaskUnblockTime();
+				}
+				#endif
 
-#if( configUSE_TASK_NOTIFICATIONS == 1 )
+				xReturn = pdPASS;
+			}
+			else
+			{
+				xReturn = pdFAIL;
+			}
 
-	BaseType_t xTaskNotifyStateClear( TaskHandle_t xTask )
-	{
-	TCB_t *pxTCB;
-	BaseType_t xReturn;
+			/* Drop the priority inherited from the caller, down to that of
+			the highest priority task still calling. */
+			if( prvRendezvousUpdatePriority( pxCurrentTCB ) != pdFALSE )
+			{
+				xYieldRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 
-		/* If null is passed in here then it is the calling task that is having
-		its notification state cleared. */
-		pxTCB = prvGetTCBFromHandle( xTask );
+			if( ( xReturn != pdFALSE ) && ( pxCaller->uxPriority >= pxCurrentTCB->uxPriority ) )
+			{
+				/* Give the processor straight back to the caller. */
+				pxRendezvousHandoffTCB = pxCaller;
+				xYieldRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 
-		taskENTER_CRITICAL();
-		{
-			if( pxTCB->ucNotifyState == taskNOTIFICATION_RECEIVED )
+			if( xYieldRequired != pdFALSE )
 			{
-				pxTCB->ucNotifyState = taskNOT_WAITING_NOTIFICATION;
-				xReturn = pdPASS;
+				taskYIELD_IF_USING_PREEMPTION();
 			}
 			else
 			{
-				xReturn = pdFAIL;
+				mtCOVERAGE_TEST_MARKER();
 			}
 		}
 		taskEXIT_CRITICAL();
@@ -5156,7 +9762,7 @@ TickType_t uxReturn;
 		return xReturn;
 	}
 
-#endif /* configUSE_TASK_NOTIFICATIONS */
+#endif /* configUSE_TASK_RENDEZVOUS */
 /*-----------------------------------------------------------*/
 
 #if( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( INCLUDE_xTaskGetIdleTaskHandle == 1 ) )
@@ -5171,8 +9777,13 @@ TickType_t uxReturn;
 
 static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait, const BaseType_t xCanBlockIndefinitely )
 {
-TickType_t xTimeToWake;
-const TickType_t xConstTickCount = xTickCount;
+TickCount_t xTimeToWake;
+const TickCount_t xConstTickCount = xTickCount;
+
+	/* Basic tasks run to completion, so must never block. */
+	configASSERT( taskIS_BASIC_TASK( pxCurrentTCB ) == pdFALSE );
+
+	taskRECORD_STATE_CHANGE( pxCurrentTCB );
 
 	#if( INCLUDE_xTaskAbortDelay == 1 )
 	{
@@ -5215,17 +9826,19 @@ const TickType_t xConstTickCount = xTickCount;
 			/* The list item will be inserted in wake time order. */
 			listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
 
+			#if( configUSE_64_BIT_TICK_COUNT == 0 )
 			if( xTimeToWake < xConstTickCount )
 			{
 				/* Wake time has overflowed.  Place this item in the overflow
 				list. */
-				vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+				taskINSERT_DELAYED_TASK( pxOverflowDelayedTaskList, pxCurrentTCB );
 			}
 			else
+			#endif /* configUSE_64_BIT_TICK_COUNT */
 			{
 				/* The wake time has not overflowed, so the current block list
 				is used. */
-				vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+				taskINSERT_DELAYED_TASK( pxDelayedTaskList, pxCurrentTCB );
 
 				/* If the task entering the blocked state was placed at the
 				head of the list of blocked tasks then xNextTaskUnblockTime
@@ -5251,15 +9864,17 @@ const TickType_t xConstTickCount = xTickCount;
 		/* The list item will be inserted in wake time order. */
 		listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
 
+		#if( configUSE_64_BIT_TICK_COUNT == 0 )
 		if( xTimeToWake < xConstTickCount )
 		{
 			/* Wake time has overflowed.  Place this item in the overflow list. */
-			vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+			taskINSERT_DELAYED_TASK( pxOverflowDelayedTaskList, pxCurrentTCB );
 		}
 		else
+		#endif /* configUSE_64_BIT_TICK_COUNT */
 		{
 			/* The wake time has not overflowed, so the current block list is used. */
-			vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+			taskINSERT_DELAYED_TASK( pxDelayedTaskList, pxCurrentTCB );
 
 			/* If the task entering the blocked state was placed at the head of the
 			list of blocked tasks then xNextTaskUnblockTime needs to be updated
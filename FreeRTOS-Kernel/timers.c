@@ -69,6 +69,15 @@ defining trmTIMER_SERVICE_TASK_NAME in FreeRTOSConfig.h. */
 #define tmrSTATUS_IS_STATICALLY_ALLOCATED	( ( uint8_t ) 0x02 )
 #define tmrSTATUS_IS_AUTORELOAD				( ( uint8_t ) 0x04 )
 
+/* Commands carry the time at which they were issued as a TickType_t.  With a
+64-bit tick count that is a truncated view of a time in the recent past of
+xTimeNow, from which the full time is recovered. */
+#if( configUSE_64_BIT_TICK_COUNT == 1 )
+	#define tmrCOMMAND_TIME( xMessageValue, xTimeNow )	( ( xTimeNow ) - ( TickCount_t ) ( TickType_t ) ( ( TickType_t ) ( xTimeNow ) - ( xMessageValue ) ) )
+#else
+	#define tmrCOMMAND_TIME( xMessageValue, xTimeNow )	( xMessageValue )
+#endif
+
 /* The definition of the timers themselves. */
 typedef struct tmrTimerControl /* The old naming convention is used to prevent breaking kernel aware debuggers. */
 {
@@ -133,9 +142,11 @@ xActiveTimerList1 and xActiveTimerList2 could be at function scope but that
 breaks some kernel aware debuggers, and debuggers that reply on removing the
 static qualifier. */
 PRIVILEGED_DATA static List_t xActiveTimerList1;
-PRIVILEGED_DATA static List_t xActiveTimerList2;
 PRIVILEGED_DATA static List_t *pxCurrentTimerList;
-PRIVILEGED_DATA static List_t *pxOverflowTimerList;
+#if( configUSE_64_BIT_TICK_COUNT == 0 )
+	PRIVILEGED_DATA static List_t xActiveTimerList2;
+	PRIVILEGED_DATA static List_t *pxOverflowTimerList;
+#endif
 
 /* A queue that is used to send commands to the timer service task. */
 PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
@@ -178,25 +189,29 @@ static void prvProcessReceivedCommands( void ) PRIVILEGED_FUNCTION;
  * Insert the timer into either xActiveTimerList1, or xActiveTimerList2,
  * depending on if the expire time causes a timer counter overflow.
  */
-static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime ) PRIVILEGED_FUNCTION;
+static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickCount_t xNextExpiryTime, const TickCount_t xTimeNow, const TickCount_t xCommandTime ) PRIVILEGED_FUNCTION;
 
 /*
  * An active timer has reached its expire time.  Reload the timer if it is an
  * auto reload timer, then call its callback.
  */
-static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+static void prvProcessExpiredTimer( const TickCount_t xNextExpireTime, const TickCount_t xTimeNow ) PRIVILEGED_FUNCTION;
 
-/*
- * The tick count has overflowed.  Switch the timer lists after ensuring the
- * current timer list does not still reference some timers.
- */
-static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+#if( configUSE_64_BIT_TICK_COUNT == 0 )
+
+	/*
+	 * The tick count has overflowed.  Switch the timer lists after ensuring the
+	 * current timer list does not still reference some timers.
+	 */
+	static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+
+#endif
 
 /*
  * Obtain the current tick count, setting *pxTimerListsWereSwitched to pdTRUE
  * if a tick count overflow occurred since prvSampleTimeNow() was last called.
  */
-static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched ) PRIVILEGED_FUNCTION;
+static TickCount_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched ) PRIVILEGED_FUNCTION;
 
 /*
  * If the timer list contains any active timers then return the expire time of
@@ -204,13 +219,13 @@ static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched
  * timer list does not contain any timers then return 0 and set *pxListWasEmpty
  * to pdTRUE.
  */
-static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty ) PRIVILEGED_FUNCTION;
+static TickCount_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty ) PRIVILEGED_FUNCTION;
 
 /*
  * If a timer has expired, process it.  Otherwise, block the timer service task
  * until either a timer does expire or a command is received.
  */
-static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty ) PRIVILEGED_FUNCTION;
+static void prvProcessTimerOrBlockTask( const TickCount_t xNextExpireTime, BaseType_t xListWasEmpty ) PRIVILEGED_FUNCTION;
 
 /*
  * Called after a Timer_t structure has been allocated either statically or
@@ -465,7 +480,7 @@ Timer_t * pxTimer =  xTimer;
 TickType_t xReturn;
 
 	configASSERT( xTimer );
-	xReturn = listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) );
+	xReturn = ( TickType_t ) listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) );
 	return xReturn;
 }
 /*-----------------------------------------------------------*/
@@ -479,7 +494,7 @@ Timer_t *pxTimer = xTimer;
 }
 /*-----------------------------------------------------------*/
 
-static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow )
+static void prvProcessExpiredTimer( const TickCount_t xNextExpireTime, const TickCount_t xTimeNow )
 {
 BaseType_t xResult;
 Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
@@ -522,7 +537,7 @@ Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTi
 
 static portTASK_FUNCTION( prvTimerTask, pvParameters )
 {
-TickType_t xNextExpireTime;
+TickCount_t xNextExpireTime;
 BaseType_t xListWasEmpty;
 
 	/* Just to avoid compiler warnings. */
@@ -556,9 +571,9 @@ BaseType_t xListWasEmpty;
 }
 /*-----------------------------------------------------------*/
 
-static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty )
+static void prvProcessTimerOrBlockTask( const TickCount_t xNextExpireTime, BaseType_t xListWasEmpty )
 {
-TickType_t xTimeNow;
+TickCount_t xTimeNow;
 BaseType_t xTimerListsWereSwitched;
 
 	vTaskSuspendAll();
@@ -585,14 +600,18 @@ BaseType_t xTimerListsWereSwitched;
 				received - whichever comes first.  The following line cannot
 				be reached unless xNextExpireTime > xTimeNow, except in the
 				case when the current timer list is empty. */
-				if( xListWasEmpty != pdFALSE )
+				#if( configUSE_64_BIT_TICK_COUNT == 0 )
 				{
-					/* The current timer list is empty - is the overflow list
-					also empty? */
-					xListWasEmpty = listLIST_IS_EMPTY( pxOverflowTimerList );
+					if( xListWasEmpty != pdFALSE )
+					{
+						/* The current timer list is empty - is the overflow
+						list also empty? */
+						xListWasEmpty = listLIST_IS_EMPTY( pxOverflowTimerList );
+					}
 				}
+				#endif /* configUSE_64_BIT_TICK_COUNT */
 
-				vQueueWaitForMessageRestricted( xTimerQueue, ( xNextExpireTime - xTimeNow ), xListWasEmpty );
+				vQueueWaitForMessageRestricted( xTimerQueue, ( TickType_t ) ( xNextExpireTime - xTimeNow ), xListWasEmpty );
 
 				if( xTaskResumeAll() == pdFALSE )
 				{
@@ -616,9 +635,9 @@ BaseType_t xTimerListsWereSwitched;
 }
 /*-----------------------------------------------------------*/
 
-static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty )
+static TickCount_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty )
 {
-TickType_t xNextExpireTime;
+TickCount_t xNextExpireTime;
 
 	/* Timers are listed in expiry time order, with the head of the list
 	referencing the task that will expire first.  Obtain the time at which
@@ -635,14 +654,26 @@ TickType_t xNextExpireTime;
 	else
 	{
 		/* Ensure the task unblocks when the tick count rolls over. */
-		xNextExpireTime = ( TickType_t ) 0U;
+		xNextExpireTime = ( TickCount_t ) 0U;
 	}
 
 	return xNextExpireTime;
 }
 /*-----------------------------------------------------------*/
 
-static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched )
+#if( configUSE_64_BIT_TICK_COUNT == 1 )
+
+static TickCount_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched )
+{
+	/* The tick count does not overflow so there is only ever one list. */
+	*pxTimerListsWereSwitched = pdFALSE;
+
+	return xTaskGetTickCount64();
+}
+
+#else /* configUSE_64_BIT_TICK_COUNT */
+
+static TickCount_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched )
 {
 TickType_t xTimeNow;
 PRIVILEGED_DATA static TickType_t xLastTime = ( TickType_t ) 0U; /*lint !e956 Variable is only accessible to one task. */
@@ -663,15 +694,34 @@ PRIVILEGED_DATA static TickType_t xLastTime = ( TickType_t ) 0U; /*lint !e956 Va
 
 	return xTimeNow;
 }
+
+#endif /* configUSE_64_BIT_TICK_COUNT */
 /*-----------------------------------------------------------*/
 
-static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime )
+static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickCount_t xNextExpiryTime, const TickCount_t xTimeNow, const TickCount_t xCommandTime )
 {
 BaseType_t xProcessTimerNow = pdFALSE;
 
 	listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xNextExpiryTime );
 	listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
 
+	#if( configUSE_64_BIT_TICK_COUNT == 1 )
+	{
+		/* Neither the tick count nor the expiry time can have overflowed, so
+		an expiry time that is not in the future has been missed while the
+		command was waiting to be processed. */
+		if( xNextExpiryTime <= xTimeNow )
+		{
+			xProcessTimerNow = pdTRUE;
+		}
+		else
+		{
+			vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+		}
+
+		( void ) xCommandTime;
+	}
+	#else /* configUSE_64_BIT_TICK_COUNT */
 	if( xNextExpiryTime <= xTimeNow )
 	{
 		/* Has the expiry time elapsed between the command to start/reset a
@@ -701,6 +751,7 @@ BaseType_t xProcessTimerNow = pdFALSE;
 			vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
 		}
 	}
+	#endif /* configUSE_64_BIT_TICK_COUNT */
 
 	return xProcessTimerNow;
 }
@@ -711,7 +762,7 @@ static void	prvProcessReceivedCommands( void )
 DaemonTaskMessage_t xMessage;
 Timer_t *pxTimer;
 BaseType_t xTimerListsWereSwitched, xResult;
-TickType_t xTimeNow;
+TickCount_t xTimeNow, xCommandTime;
 
 	while( xQueueReceive( xTimerQueue, &xMessage, tmrNO_DELAY ) != pdFAIL ) /*lint !e603 xMessage does not have to be initialised as it is passed out, not in, and it is not used unless xQueueReceive() returns pdTRUE. */
 	{
@@ -774,7 +825,8 @@ TickType_t xTimeNow;
 				case tmrCOMMAND_START_DONT_TRACE :
 					/* Start or restart a timer. */
 					pxTimer->ucStatus |= tmrSTATUS_IS_ACTIVE;
-					if( prvInsertTimerInActiveList( pxTimer,  xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow, xMessage.u.xTimerParameters.xMessageValue ) != pdFALSE )
+					xCommandTime = tmrCOMMAND_TIME( xMessage.u.xTimerParameters.xMessageValue, xTimeNow );
+					if( prvInsertTimerInActiveList( pxTimer, xCommandTime + pxTimer->xTimerPeriodInTicks, xTimeNow, xCommandTime ) != pdFALSE )
 					{
 						/* The timer expired before it was added to the active
 						timer list.  Process it now. */
@@ -854,6 +906,8 @@ TickType_t xTimeNow;
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_64_BIT_TICK_COUNT == 0 )
+
 static void prvSwitchTimerLists( void )
 {
 TickType_t xNextExpireTime, xReloadTime;
@@ -911,6 +965,8 @@ BaseType_t xResult;
 	pxCurrentTimerList = pxOverflowTimerList;
 	pxOverflowTimerList = pxTemp;
 }
+
+#endif /* configUSE_64_BIT_TICK_COUNT */
 /*-----------------------------------------------------------*/
 
 static void prvCheckForValidListAndQueue( void )
@@ -923,9 +979,14 @@ static void prvCheckForValidListAndQueue( void )
 		if( xTimerQueue == NULL )
 		{
 			vListInitialise( &xActiveTimerList1 );
-			vListInitialise( &xActiveTimerList2 );
 			pxCurrentTimerList = &xActiveTimerList1;
-			pxOverflowTimerList = &xActiveTimerList2;
+
+			#if( configUSE_64_BIT_TICK_COUNT == 0 )
+			{
+				vListInitialise( &xActiveTimerList2 );
+				pxOverflowTimerList = &xActiveTimerList2;
+			}
+			#endif
 
 			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
 			{
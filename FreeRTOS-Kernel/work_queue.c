@@ -0,0 +1,361 @@
+/*
+ * FreeRTOS Kernel V10.2.1
+ * Copyright (C) 2019 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "atomic.h"
+#include "work_queue.h"
+
+/* Lint e961, e750 and e9021 are suppressed as a MISRA exception justified
+because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+for the header files above, but not in this file, in order to generate the
+correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750 !e9021 See comment above. */
+
+/* This entire source file will be skipped if the application is not configured
+to include work queue functionality.  This #if is closed at the very bottom of
+this file.  If you want to include work queues then ensure configUSE_WORK_QUEUES
+is set to 1 in FreeRTOSConfig.h. */
+#if( configUSE_WORK_QUEUES == 1 )
+
+/* Use the ordered accesses provided by the port where they exist.  Otherwise
+fall back to the implementations in atomic.h, which mask interrupts around the
+compare and swap and so are only atomic with respect to a single core. */
+#ifdef portATOMIC_COMPARE_AND_SWAP_U32
+	#define workqueueCOMPARE_AND_SWAP( pulDestination, ulComparand, ulExchange )	portATOMIC_COMPARE_AND_SWAP_U32( ( pulDestination ), ( ulComparand ), ( ulExchange ) )
+#else
+	#if( configNUM_CORES > 1 )
+		#error configUSE_WORK_QUEUES requires the port to define portATOMIC_COMPARE_AND_SWAP_U32 when configNUM_CORES is greater than 1
+	#endif
+
+	#define workqueueCOMPARE_AND_SWAP( pulDestination, ulComparand, ulExchange )	( Atomic_CompareAndSwap_u32( ( pulDestination ), ( ulExchange ), ( ulComparand ) ) == ATOMIC_COMPARE_AND_SWAP_SUCCESS )
+#endif
+
+#ifdef portATOMIC_LOAD_ACQUIRE_U32
+	#define workqueueLOAD_ACQUIRE( pulSource )					portATOMIC_LOAD_ACQUIRE_U32( pulSource )
+	#define workqueueSTORE_RELEASE( pulDestination, ulValue )	portATOMIC_STORE_RELEASE_U32( ( pulDestination ), ( ulValue ) )
+#else
+	static portFORCE_INLINE uint32_t prvLoadAcquire( volatile uint32_t *pulSource )
+	{
+	uint32_t ulValue = *pulSource;
+
+		portMEMORY_BARRIER();
+		return ulValue;
+	}
+
+	#define workqueueLOAD_ACQUIRE( pulSource )					prvLoadAcquire( pulSource )
+	#define workqueueSTORE_RELEASE( pulDestination, ulValue )	do { portMEMORY_BARRIER(); *( pulDestination ) = ( ulValue ); } while( 0 )
+#endif
+
+/*
+ * One deferred function call.  ulSequence records the state of the slot: it
+ * equals the submit position that can next claim the slot while the slot is
+ * free, and that position plus one once the item written into the slot has been
+ * published to the worker task.
+ */
+typedef struct WorkItemDefinition
+{
+	volatile uint32_t ulSequence;
+	WorkFunction_t pxFunction;
+	void *pvParameter1;
+	uint32_t ulParameter2;
+} WorkItem_t;
+
+typedef struct WorkQueueDefinition
+{
+	volatile uint32_t ulSubmitPosition;	/*< Next position to be claimed by a submitter.  Updated with a compare and swap. */
+	uint32_t ulDrainPosition;			/*< Next position to be executed.  Only accessed by the worker task. */
+	volatile uint32_t ulWorkerWaiting;	/*< Set to 1 by the worker task before it blocks, cleared by the submitter that will wake it. */
+	uint32_t ulMask;					/*< Number of items in the ring minus one. */
+	TaskHandle_t xWorkerTask;
+	WorkItem_t *pxItems;				/*< Points to the ring, which follows this structure in the same allocation. */
+} WorkQueue_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The task that executes the functions submitted to a work queue.
+ */
+static void prvWorkQueueTask( void *pvParameters ) PRIVILEGED_FUNCTION;
+
+/*
+ * Claim a slot in the ring, write the item into it, then publish it to the
+ * worker task.  Returns pdFAIL without waiting if the ring is full.
+ */
+static BaseType_t prvWorkQueuePush( WorkQueue_t * const pxWorkQueue, WorkFunction_t xFunctionToExecute, void *pvParameter1, uint32_t ulParameter2 ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called by a submitter after pushing an item.  Returns pdTRUE if the worker
+ * task had committed to blocking, in which case the caller must wake it.  Only
+ * one submitter can see pdTRUE for each time the worker blocks.
+ */
+static BaseType_t prvWorkQueueClaimWakeup( WorkQueue_t * const pxWorkQueue ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+WorkQueueHandle_t xWorkQueueCreate( const char * const pcName, UBaseType_t uxLength, UBaseType_t uxPriority, configSTACK_DEPTH_TYPE usStackDepth )
+{
+WorkQueue_t *pxWorkQueue;
+uint8_t *pucRingStorage;
+UBaseType_t ux;
+
+	/* The positions wrap at 2^32, so the ring must divide that evenly. */
+	configASSERT( uxLength > ( UBaseType_t ) 1U );
+	configASSERT( ( uxLength & ( uxLength - ( UBaseType_t ) 1U ) ) == ( UBaseType_t ) 0U );
+
+	/* Allocate the work queue structure and the ring in one block. */
+	pxWorkQueue = ( WorkQueue_t * ) pvPortMalloc( sizeof( WorkQueue_t ) + ( ( size_t ) uxLength * sizeof( WorkItem_t ) ) ); /*lint !e9087 !e9079 see comment above. */
+
+	if( pxWorkQueue != NULL )
+	{
+		pucRingStorage = ( uint8_t * ) pxWorkQueue;
+		pucRingStorage += sizeof( WorkQueue_t ); /*lint !e9016 Pointer arithmetic allowed on char types, especially when it assists conveying intent. */
+
+		pxWorkQueue->pxItems = ( WorkItem_t * ) pucRingStorage; /*lint !e9087 !e826 The ring follows the structure, which ends on a pointer boundary. */
+		pxWorkQueue->ulSubmitPosition = 0UL;
+		pxWorkQueue->ulDrainPosition = 0UL;
+		pxWorkQueue->ulWorkerWaiting = 0UL;
+		pxWorkQueue->ulMask = ( uint32_t ) uxLength - 1UL;
+
+		for( ux = ( UBaseType_t ) 0U; ux < uxLength; ux++ )
+		{
+			pxWorkQueue->pxItems[ ux ].ulSequence = ( uint32_t ) ux;
+		}
+
+		if( xTaskCreate( prvWorkQueueTask, pcName, usStackDepth, ( void * ) pxWorkQueue, uxPriority, &( pxWorkQueue->xWorkerTask ) ) != pdPASS )
+		{
+			vPortFree( pxWorkQueue );
+			pxWorkQueue = NULL;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pxWorkQueue;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xWorkQueueSubmit( WorkQueueHandle_t xWorkQueue, WorkFunction_t xFunctionToExecute, void *pvParameter1, uint32_t ulParameter2 )
+{
+WorkQueue_t * const pxWorkQueue = xWorkQueue;
+BaseType_t xReturn;
+
+	configASSERT( pxWorkQueue );
+	configASSERT( xFunctionToExecute );
+
+	xReturn = prvWorkQueuePush( pxWorkQueue, xFunctionToExecute, pvParameter1, ulParameter2 );
+
+	if( xReturn != pdFAIL )
+	{
+		if( prvWorkQueueClaimWakeup( pxWorkQueue ) != pdFALSE )
+		{
+			( void ) xTaskNotifyGive( pxWorkQueue->xWorkerTask );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xWorkQueueSubmitFromISR( WorkQueueHandle_t xWorkQueue, WorkFunction_t xFunctionToExecute, void *pvParameter1, uint32_t ulParameter2, BaseType_t *pxHigherPriorityTaskWoken )
+{
+WorkQueue_t * const pxWorkQueue = xWorkQueue;
+BaseType_t xReturn;
+
+	configASSERT( pxWorkQueue );
+	configASSERT( xFunctionToExecute );
+
+	xReturn = prvWorkQueuePush( pxWorkQueue, xFunctionToExecute, pvParameter1, ulParameter2 );
+
+	if( xReturn != pdFAIL )
+	{
+		if( prvWorkQueueClaimWakeup( pxWorkQueue ) != pdFALSE )
+		{
+			vTaskNotifyGiveFromISR( pxWorkQueue->xWorkerTask, pxHigherPriorityTaskWoken );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvWorkQueuePush( WorkQueue_t * const pxWorkQueue, WorkFunction_t xFunctionToExecute, void *pvParameter1, uint32_t ulParameter2 )
+{
+WorkItem_t *pxItem;
+uint32_t ulPosition, ulSequence;
+int32_t lDifference;
+
+	ulPosition = workqueueLOAD_ACQUIRE( &( pxWorkQueue->ulSubmitPosition ) );
+
+	for( ;; )
+	{
+		pxItem = &( pxWorkQueue->pxItems[ ulPosition & pxWorkQueue->ulMask ] );
+		ulSequence = workqueueLOAD_ACQUIRE( &( pxItem->ulSequence ) );
+		lDifference = ( int32_t ) ( ulSequence - ulPosition );
+
+		if( lDifference == 0 )
+		{
+			/* The slot is free.  Claim it by moving the submit position on,
+			unless another submitter got there first. */
+			if( workqueueCOMPARE_AND_SWAP( &( pxWorkQueue->ulSubmitPosition ), ulPosition, ulPosition + 1UL ) != pdFALSE )
+			{
+				break;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else if( lDifference < 0 )
+		{
+			/* The slot still holds the item submitted one lap ago, which the
+			worker has not executed yet, so the ring is full. */
+			return pdFAIL;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Another submitter claimed the position, try the next one. */
+		ulPosition = workqueueLOAD_ACQUIRE( &( pxWorkQueue->ulSubmitPosition ) );
+	}
+
+	pxItem->pxFunction = xFunctionToExecute;
+	pxItem->pvParameter1 = pvParameter1;
+	pxItem->ulParameter2 = ulParameter2;
+
+	/* Publish the item.  The release ensures the worker cannot see the new
+	sequence before it can see the item. */
+	workqueueSTORE_RELEASE( &( pxItem->ulSequence ), ulPosition + 1UL );
+
+	return pdPASS;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvWorkQueueClaimWakeup( WorkQueue_t * const pxWorkQueue )
+{
+	/* Only one submitter can clear the flag, so the worker is notified once
+	per time it blocks no matter how many items arrive in the meantime. */
+	return workqueueCOMPARE_AND_SWAP( &( pxWorkQueue->ulWorkerWaiting ), 1UL, 0UL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvWorkQueueTask( void *pvParameters )
+{
+WorkQueue_t * const pxWorkQueue = ( WorkQueue_t * ) pvParameters;
+WorkItem_t *pxItem;
+WorkFunction_t pxFunction;
+void *pvParameter1;
+uint32_t ulParameter2, ulPosition;
+
+	for( ;; )
+	{
+		/* Execute every item that has been published, in the order the
+		positions were claimed. */
+		for( ;; )
+		{
+			ulPosition = pxWorkQueue->ulDrainPosition;
+			pxItem = &( pxWorkQueue->pxItems[ ulPosition & pxWorkQueue->ulMask ] );
+
+			if( workqueueLOAD_ACQUIRE( &( pxItem->ulSequence ) ) != ( ulPosition + 1UL ) )
+			{
+				break;
+			}
+
+			pxFunction = pxItem->pxFunction;
+			pvParameter1 = pxItem->pvParameter1;
+			ulParameter2 = pxItem->ulParameter2;
+
+			/* Return the slot to the submitters before calling the function so
+			the function itself can submit to this work queue. */
+			workqueueSTORE_RELEASE( &( pxItem->ulSequence ), ulPosition + pxWorkQueue->ulMask + 1UL );
+			pxWorkQueue->ulDrainPosition = ulPosition + 1UL;
+
+			pxFunction( pvParameter1, ulParameter2 );
+		}
+
+		/* Commit to blocking.  The compare and swap is a full barrier, so
+		either the check of the next slot below sees an item published after
+		the drain loop exited, or the submitter of that item sees the flag set
+		and wakes this task. */
+		( void ) workqueueCOMPARE_AND_SWAP( &( pxWorkQueue->ulWorkerWaiting ), 0UL, 1UL );
+
+		ulPosition = pxWorkQueue->ulDrainPosition;
+		pxItem = &( pxWorkQueue->pxItems[ ulPosition & pxWorkQueue->ulMask ] );
+
+		if( workqueueLOAD_ACQUIRE( &( pxItem->ulSequence ) ) == ( ulPosition + 1UL ) )
+		{
+			/* An item arrived in the window.  Withdraw the flag and go round
+			again.  If a submitter has already cleared the flag its
+			notification is left pending and only causes one extra pass. */
+			( void ) workqueueCOMPARE_AND_SWAP( &( pxWorkQueue->ulWorkerWaiting ), 1UL, 0UL );
+		}
+		else
+		{
+			( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+to include work queue functionality.  If you want to include work queues then
+ensure configUSE_WORK_QUEUES is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_WORK_QUEUES == 1 */
+